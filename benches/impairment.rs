@@ -0,0 +1,133 @@
+//! Batched and pipelined client operations under WAN-like latency
+//!
+//! Runs an isolated server behind the loopback impairment proxy and times
+//! the same workload at several round trip times:
+//!
+//! ```bash
+//! cargo bench --bench impairment
+//! ```
+
+#[path = "../tests/common/impairment.rs"]
+mod impairment;
+
+use impairment::{Impairment, ImpairmentProxy};
+use pvxs_sys::{Context, NTScalarMetadataBuilder, Operation, OperationSet, PvxsError, Server};
+use std::time::{Duration, Instant};
+
+const TIMEOUT: f64 = 30.0;
+const PV_COUNT: usize = 100;
+const PIPELINE_DEPTH: usize = 8;
+
+fn sequential(ctx: &mut Context, names: &[String]) -> Result<Duration, PvxsError> {
+    let start = Instant::now();
+    for name in names {
+        ctx.get(name, TIMEOUT)?;
+    }
+    Ok(start.elapsed())
+}
+
+fn batched(ctx: &mut Context, names: &[String]) -> Result<Duration, PvxsError> {
+    let start = Instant::now();
+    let mut set = OperationSet::new()?;
+    let mut ops = Vec::with_capacity(names.len());
+    for name in names {
+        let op = ctx.start_get(name, TIMEOUT)?;
+        set.add(&op)?;
+        ops.push(op);
+    }
+    let finished = set.wait_all(TIMEOUT)?;
+    if finished.len() != names.len() {
+        return Err(PvxsError::new("Batch did not complete"));
+    }
+    Ok(start.elapsed())
+}
+
+fn pipelined(ctx: &mut Context, names: &[String], depth: usize) -> Result<Duration, PvxsError> {
+    let start = Instant::now();
+    let mut set = OperationSet::new()?;
+    let mut ops: Vec<Operation> = Vec::with_capacity(names.len());
+    let mut in_flight = 0;
+    let mut completed = 0;
+    let mut next = names.iter();
+    while completed < names.len() {
+        while in_flight < depth {
+            match next.next() {
+                Some(name) => {
+                    let op = ctx.start_get(name, TIMEOUT)?;
+                    set.add(&op)?;
+                    ops.push(op);
+                    in_flight += 1;
+                }
+                None => break,
+            }
+        }
+        let finished = set.wait_any(TIMEOUT)?.len();
+        if finished == 0 {
+            return Err(PvxsError::new("Pipeline stalled"));
+        }
+        in_flight -= finished;
+        completed += finished;
+    }
+    Ok(start.elapsed())
+}
+
+fn batched_puts(ctx: &mut Context, names: &[String]) -> Result<Duration, PvxsError> {
+    let start = Instant::now();
+    let mut set = OperationSet::new()?;
+    let mut ops = Vec::with_capacity(names.len());
+    for (i, name) in names.iter().enumerate() {
+        let op = ctx.start_put_double(name, i as f64, TIMEOUT)?;
+        set.add(&op)?;
+        ops.push(op);
+    }
+    set.wait_all(TIMEOUT)?;
+    Ok(start.elapsed())
+}
+
+fn run(label: &str, impairment: Impairment, names: &[String], server: &Server) -> Result<(), PvxsError> {
+    let proxy = ImpairmentProxy::start(server.tcp_port(), server.udp_port(), impairment)
+        .map_err(|e| PvxsError::new(format!("Failed to start proxy: {}", e)))?;
+    proxy.apply_client_env();
+    let mut ctx = Context::from_env()?;
+
+    // Connect every channel first so only the operations are timed
+    batched(&mut ctx, names)?;
+
+    let report = |name: &str, elapsed: Duration| {
+        println!(
+            "{:<14} {:<22} {:>10.1} ms {:>10.1} ops/s",
+            label,
+            name,
+            elapsed.as_secs_f64() * 1000.0,
+            names.len() as f64 / elapsed.as_secs_f64()
+        );
+    };
+    report("sequential get", sequential(&mut ctx, names)?);
+    report("batched get", batched(&mut ctx, names)?);
+    report(&format!("pipelined get (x{})", PIPELINE_DEPTH), pipelined(&mut ctx, names, PIPELINE_DEPTH)?);
+    report("batched put", batched_puts(&mut ctx, names)?);
+    Ok(())
+}
+
+fn main() -> Result<(), PvxsError> {
+    let names: Vec<String> = (0..PV_COUNT).map(|i| format!("bench:impairment:{}", i)).collect();
+    let mut server = Server::create_isolated()?;
+    for name in &names {
+        server.create_pv_double(name, 0.0, NTScalarMetadataBuilder::new())?;
+    }
+    server.start()?;
+
+    println!("{} PVs per run", PV_COUNT);
+    run("loopback", Impairment::new(), &names, &server)?;
+    run("30 ms RTT", Impairment::rtt(Duration::from_millis(30)).jitter(Duration::from_millis(3)), &names, &server)?;
+    run("80 ms RTT", Impairment::rtt(Duration::from_millis(80)).jitter(Duration::from_millis(8)), &names, &server)?;
+    run(
+        "80 ms, 1 MB/s",
+        Impairment::rtt(Duration::from_millis(80)).bandwidth(1_000_000),
+        &names,
+        &server,
+    )?;
+
+    server.stop()?;
+    Ok(())
+}
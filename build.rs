@@ -75,11 +75,26 @@ fn main() {
     println!("cargo:rerun-if-changed=src/lib.rs");
     println!("cargo:rerun-if-changed=src/bridge.rs");
     println!("cargo:rerun-if-changed=include/wrapper.h");
+    println!("cargo:rerun-if-changed=src/alarm_summary_wrapper.cpp");
+    println!("cargo:rerun-if-changed=src/array_recorder_wrapper.cpp");
     println!("cargo:rerun-if-changed=src/client_wrapper.cpp");
+    println!("cargo:rerun-if-changed=src/client_wrapper_admission.cpp");
     println!("cargo:rerun-if-changed=src/client_wrapper_async.cpp");
+    println!("cargo:rerun-if-changed=src/client_wrapper_breaker.cpp");
     println!("cargo:rerun-if-changed=src/client_wrapper_monitor.cpp");
     println!("cargo:rerun-if-changed=src/client_wrapper_rpc.cpp");
+    println!("cargo:rerun-if-changed=src/diagnostics_wrapper.cpp");
+    println!("cargo:rerun-if-changed=src/histogram_wrapper.cpp");
+    println!("cargo:rerun-if-changed=src/relay_wrapper.cpp");
     println!("cargo:rerun-if-changed=src/server_wrapper.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_autosave.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_computed.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_group.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_mapped.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_snapshot.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_staging.cpp");
+    println!("cargo:rerun-if-changed=src/server_wrapper_subscriptions.cpp");
+    println!("cargo:rerun-if-changed=src/trace_wrapper.cpp");
     println!("cargo:rerun-if-env-changed=EPICS_BASE");
     println!("cargo:rerun-if-env-changed=EPICS_HOST_ARCH");
     println!("cargo:rerun-if-env-changed=EPICS_PVXS");
@@ -116,11 +131,26 @@ fn main() {
     let include_dir = std::env::current_dir().unwrap().join("include");
     
     build
+        .file("src/alarm_summary_wrapper.cpp")
+        .file("src/array_recorder_wrapper.cpp")
+        .file("src/client_wrapper_admission.cpp")
         .file("src/client_wrapper_async.cpp")
+        .file("src/client_wrapper_breaker.cpp")
         .file("src/client_wrapper_monitor.cpp")
         .file("src/client_wrapper_rpc.cpp")
         .file("src/client_wrapper.cpp")
+        .file("src/diagnostics_wrapper.cpp")
+        .file("src/histogram_wrapper.cpp")
+        .file("src/relay_wrapper.cpp")
         .file("src/server_wrapper.cpp")
+        .file("src/server_wrapper_autosave.cpp")
+        .file("src/server_wrapper_computed.cpp")
+        .file("src/server_wrapper_group.cpp")
+        .file("src/server_wrapper_mapped.cpp")
+        .file("src/server_wrapper_snapshot.cpp")
+        .file("src/server_wrapper_staging.cpp")
+        .file("src/server_wrapper_subscriptions.cpp")
+        .file("src/trace_wrapper.cpp")
         .include(&include_dir)  // Add include directory first so wrapper.h is found
         .include(&epics_include)
         .include(epics_include.join("compiler").join(compiler_dir))
@@ -6,10 +6,22 @@
 #include <memory>
 #include <string>
 #include <stdexcept>
+#include <cstring>
 #include <optional>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <map>
+#include <list>
+#include <deque>
+#include <thread>
 #include "rust/cxx.h" // For rust::String and rust::Str types
 #include <pvxs/client.h>
 #include <pvxs/server.h>
+#include <pvxs/source.h>
 #include <pvxs/sharedpv.h>
 #include <pvxs/nt.h>
 
@@ -19,12 +31,14 @@ namespace pvxs_wrapper
     // Forward declarations
     class ContextWrapper;
     class OperationWrapper;
+    class OperationSetWrapper;
     class ValueWrapper;
     class ServerWrapper;
     class SharedPVWrapper;
     class StaticSourceWrapper;
     class MonitorWrapper;
     class MonitorBuilderWrapper;
+    class CircuitBreaker;
 
     /// Exception wrapper for Rust-friendly error handling
     class PvxsError : public std::runtime_error
@@ -105,6 +119,14 @@ namespace pvxs_wrapper
         // Get field as array of strings
         rust::Vec<rust::String> get_field_string_array(const std::string &field_name) const;
 
+        // Get field converted to a scalar type at its native width
+        template <typename T>
+        T get_field_as(const std::string &field_name) const;
+
+        // Get field converted to an array of a scalar type at its native width
+        template <typename E>
+        rust::Vec<E> get_field_array_as(const std::string &field_name) const;
+
         // Convert entire value to string representation
         std::string to_string() const;
 
@@ -113,21 +135,127 @@ namespace pvxs_wrapper
         const pvxs::Value &get() const { return value_; }
     };
 
+    /// Records wrapper activity into per-thread buffers for export as Chrome Trace Event JSON.
+    /// Recording takes no lock once a thread has its buffer; a full buffer drops further events.
+    class Tracer
+    {
+    private:
+        static std::atomic<bool> enabled_;
+
+        static void record(char phase, const char *category, const char *name, const std::string &pv, uint64_t id);
+
+    public:
+        static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+        // Start recording into fresh buffers (discards earlier events)
+        static void enable(size_t events_per_thread);
+        static void disable();
+        static void clear();
+
+        static void begin(const char *category, const char *name, const std::string &pv);
+        static void end(const char *category, const char *name);
+        static void instant(const char *category, const char *name, const std::string &pv);
+
+        // Spans which may finish on another thread, returns 0 when not recording
+        static uint64_t async_begin(const char *category, const char *name, const std::string &pv);
+        static void async_end(const char *category, const char *name, uint64_t id);
+
+        static std::string to_json();
+        static uint64_t dropped();
+    };
+
+    /// Begin/end pair on the calling thread for the lifetime of the object
+    class TraceSpan
+    {
+    private:
+        const char *category_;
+        const char *name_;
+        bool active_;
+
+    public:
+        TraceSpan(const char *category, const char *name, const std::string &pv)
+            : category_(category), name_(name), active_(Tracer::enabled())
+        {
+            if (active_) {
+                Tracer::begin(category, name, pv);
+            }
+        }
+        ~TraceSpan()
+        {
+            if (active_) {
+                Tracer::end(category_, name_);
+            }
+        }
+        TraceSpan(const TraceSpan &) = delete;
+        TraceSpan &operator=(const TraceSpan &) = delete;
+    };
+
+    /// Shared wake-up signal used to wait on many operations at once
+    struct CompletionSignal
+    {
+        std::mutex lock;
+        std::condition_variable cv;
+        uint64_t generation = 0;
+
+        // Wake every thread blocked on this signal
+        void notify();
+    };
+
+    /// Completion state filled in by the pvxs result() callback of an operation
+    struct OperationState
+    {
+        std::mutex lock;
+        std::condition_variable done_cv;
+        std::atomic<bool> done{false};
+        pvxs::Value value;
+        std::string error;
+        std::string peer;          // address of the server which answered, if any
+        bool disconnected = false; // failed because the connection was lost
+        std::vector<std::weak_ptr<CompletionSignal>> listeners;
+        const char *trace_name = nullptr; // async span to end on completion, if traced
+        uint64_t trace_id = 0;
+
+        // Open an async trace span which complete() closes
+        void trace(const char *name, const std::string &pv_name);
+
+        // Store the outcome of the operation and wake all waiters. Returns false, dropping the
+        // result, if the operation already finished (failed by its deadline or cancelled)
+        bool complete(pvxs::client::Result &&result);
+
+        // Finish the operation with an error and wake all waiters, unless it already finished
+        bool fail(const std::string &message);
+
+        // Block until completion or timeout (returns true if completed)
+        bool wait_for(double timeout);
+
+        // Register a signal to be notified on completion (notified immediately if already done)
+        void add_listener(const std::shared_ptr<CompletionSignal> &signal);
+
+        // Build a result() callback which completes the given state
+        static std::function<void(pvxs::client::Result &&)> handler(const std::shared_ptr<OperationState> &state);
+
+    private:
+        // Wake the listeners taken from a finished state (lock not held)
+        void wake(std::vector<std::weak_ptr<CompletionSignal>> &to_notify);
+    };
+
+    struct OperationHandle;
+
     /// Wraps pvxs::client::Operation for safe Rust access
     class OperationWrapper
     {
     private:
-        std::shared_ptr<pvxs::client::Operation> op_;
+        std::shared_ptr<OperationHandle> handle_;
+        std::shared_ptr<OperationState> state_;
 
     public:
         OperationWrapper() = default;
-        explicit OperationWrapper(std::shared_ptr<pvxs::client::Operation> &&op)
-            : op_(std::move(op)) {}
+        explicit OperationWrapper(std::shared_ptr<OperationHandle> handle);
 
         // Wait for operation to complete (blocking)
         std::unique_ptr<ValueWrapper> wait(double timeout) const;
 
-        // Cancel the operation
+        // Cancel the operation, which then fails unless it already finished
         bool cancel() const;
 
         // Check if operation is complete
@@ -141,6 +269,58 @@ namespace pvxs_wrapper
 
         // Get PV name
         std::string name() const;
+
+        // Get the shared completion state (internal use)
+        const std::shared_ptr<OperationState> &state() const { return state_; }
+    };
+
+    /// A set of operations which can be waited on together through one shared signal
+    class OperationSetWrapper
+    {
+    private:
+        std::shared_ptr<CompletionSignal> signal_;
+        std::vector<std::shared_ptr<OperationState>> ops_;
+        std::vector<bool> reported_;
+
+    public:
+        OperationSetWrapper() : signal_(std::make_shared<CompletionSignal>()) {}
+
+        // Add an operation, returns its index within the set
+        size_t add(const OperationWrapper &op);
+
+        // Number of operations in the set
+        size_t size() const { return ops_.size(); }
+
+        // Block until at least one operation not yet reported has finished, or the deadline passes.
+        // Returns the indices of newly finished operations (empty on timeout, or right away when
+        // every operation has already been reported)
+        rust::Vec<size_t> wait_any(uint64_t timeout_ms);
+
+        // Block until all operations have finished, or the deadline passes.
+        // Returns the indices of all finished operations
+        rust::Vec<size_t> wait_all(uint64_t timeout_ms);
+    };
+
+    /// Drops monitor updates whose selected fields repeat those of the previous update
+    class DuplicateFilter
+    {
+    private:
+        std::vector<std::string> fields_;
+        pvxs::Value previous_;
+        uint64_t passed_ = 0;
+        uint64_t suppressed_ = 0;
+
+    public:
+        explicit DuplicateFilter(std::vector<std::string> fields) : fields_(std::move(fields)) {}
+
+        // Returns true if the update should be dropped, otherwise remembers it for the next comparison
+        bool is_duplicate(const pvxs::Value &update);
+
+        // Forget the previous update, so the next one always passes (e.g. after a reconnect)
+        void reset() { previous_ = pvxs::Value(); }
+
+        uint64_t passed() const { return passed_; }
+        uint64_t suppressed() const { return suppressed_; }
     };
 
     /// Wraps pvxs::client::Subscription for safe Rust access
@@ -154,6 +334,11 @@ namespace pvxs_wrapper
         void (*rust_callback_)() = nullptr;  // Function pointer to Rust callback (no parameters)
         bool mask_connected_ = true;  // Default masks (filter out connection events)
         bool mask_disconnected_ = true;  // Default masks (filter out disconnection events)
+        int priority_ = 0;  // PVA channel priority used by start()
+        std::unique_ptr<DuplicateFilter> duplicates_;  // Optional consecutive-duplicate suppression
+
+        // Pop the next update which is not a suppressed duplicate
+        pvxs::Value pop_filtered();
 
     public:
         MonitorWrapper() = delete; // Must have context and PV name
@@ -191,6 +376,9 @@ namespace pvxs_wrapper
         // Get connection status
         bool is_connected() const;
         
+        // Set the PVA channel priority used when the subscription is started
+        void set_priority(int priority) { priority_ = priority; }
+
         // Set the Connect object (used by MonitorBuilder)
         void set_connect(std::shared_ptr<pvxs::client::Connect> &&connect) {
             connect_ = std::move(connect);
@@ -198,6 +386,14 @@ namespace pvxs_wrapper
         
         // Pop next value from subscription queue (PVXS-style)
         std::unique_ptr<ValueWrapper> pop();
+
+        // Drop updates whose given fields equal those of the previous update
+        void suppress_duplicates(std::vector<std::string> fields) {
+            duplicates_ = std::make_unique<DuplicateFilter>(std::move(fields));
+        }
+
+        // Duplicate suppression counters, nullptr when suppression is off
+        const DuplicateFilter *duplicate_filter() const { return duplicates_.get(); }
     };
 
     /// Builder pattern for creating monitors with callbacks (PVXS-style)
@@ -210,11 +406,18 @@ namespace pvxs_wrapper
         bool mask_disconnected_ = true; // Default: true = suppress disconnection events (per PVXS default)
         uint64_t callback_id_ = 0;
         void (*rust_callback_)() = nullptr;  // Function pointer to Rust callback (no parameters)
+        int priority_ = 0;  // PVA channel priority
+        bool suppress_duplicates_ = false;
+        std::vector<std::string> duplicate_fields_;
+        std::vector<std::pair<std::string, std::string>> record_options_; // pvRequest record[name=value]
+
+        // Build and start the subscription with every option set so far (shared by both exec variants)
+        std::unique_ptr<MonitorWrapper> build();
 
     public:
         MonitorBuilderWrapper() = delete;
-        MonitorBuilderWrapper(pvxs::client::Context &ctx, const std::string &pv_name)
-            : context_(ctx), pv_name_(pv_name) {}
+        MonitorBuilderWrapper(pvxs::client::Context &ctx, const std::string &pv_name, int priority = 0)
+            : context_(ctx), pv_name_(pv_name), priority_(priority) {}
 
         // Configure whether to include Connected events in queue
         void mask_connected(bool mask);
@@ -224,6 +427,15 @@ namespace pvxs_wrapper
         
         // Set event callback function pointer
         void set_event_callback(void (*callback)());
+
+        // Set the PVA channel priority (0 to 99, higher is served first)
+        void set_priority(int priority);
+
+        // Drop consecutive updates whose given fields are unchanged (defaults to value and alarm)
+        void suppress_duplicates(std::vector<std::string> fields);
+
+        // Add a pvRequest record option, e.g. ("dec", "10")
+        void record_option(const std::string &name, const std::string &value);
         
         // Execute and return a subscription without callback
         std::unique_ptr<MonitorWrapper> exec();
@@ -235,16 +447,249 @@ namespace pvxs_wrapper
         std::string name() const { return pv_name_; }
     };
 
+    /// Per-PV and per-server circuit breaker with a negative cache of names which never connected.
+    /// Calls for PVs whose circuit is open fail immediately instead of waiting out their timeout.
+    class CircuitBreaker
+    {
+    public:
+        struct Config
+        {
+            uint32_t failure_threshold = 3;   // consecutive failures before a circuit opens
+            uint64_t open_ms = 5000;          // fast-fail window before a half-open probe is allowed
+            uint64_t negative_ttl_ms = 30000; // how long a name which never connected is remembered
+            bool per_server = true;           // also trip all PVs last served by a failing server
+        };
+
+        enum class State : uint8_t
+        {
+            Closed = 0,
+            Open = 1,
+            HalfOpen = 2,
+            Unreachable = 3, // in the negative cache
+        };
+
+        explicit CircuitBreaker(const Config &config) : config_(config) {}
+
+        // Throws PvxsError if a call for this PV should fail fast.
+        // While half-open a single caller is admitted as the probe.
+        void admit(const std::string &pv_name);
+
+        // Record the outcome of an admitted call, taken from its completion state
+        void record(const std::string &pv_name, const OperationState &state);
+
+        // Record an admitted call which got no answer before its timeout
+        void record_timeout(const std::string &pv_name);
+
+        // Current state of the circuit guarding a PV
+        State state(const std::string &pv_name);
+
+        // Number of calls rejected without touching the network
+        uint64_t fast_fail_count() const { return fast_fails_; }
+
+        // Close every circuit and clear the negative cache
+        void reset();
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        struct Circuit
+        {
+            State state = State::Closed;
+            uint32_t failures = 0;
+            clock::time_point open_until;
+            clock::time_point probe_until; // a probe which never reports back expires
+        };
+
+        bool allows(const Circuit &circuit, clock::time_point now) const;
+        void enter(Circuit &circuit, clock::time_point now);
+        void fail(Circuit &circuit, clock::time_point now);
+
+        Config config_;
+        std::mutex lock_;
+        std::map<std::string, Circuit> pvs_;
+        std::map<std::string, Circuit> servers_;
+        std::map<std::string, std::string> pv_server_;            // last server which answered for a PV
+        std::map<std::string, clock::time_point> unreachable_;    // negative cache, name -> expiry
+        std::atomic<uint64_t> fast_fails_{0};
+    };
+
+    /// Caps the number of outstanding operations of a context, optionally per target server.
+    /// Synchronous callers over the limit block in the queue until a slot frees up or their timeout
+    /// passes; asynchronous operations wait in the same queue without blocking their caller.
+    class AdmissionController : public std::enable_shared_from_this<AdmissionController>
+    {
+    public:
+        struct Config
+        {
+            uint32_t max_in_flight = 0;  // per context, 0 for no limit
+            uint32_t max_per_server = 0; // per server, 0 for no limit
+        };
+
+        /// One admitted operation. The slot is given back on release() or destruction
+        class Ticket
+        {
+        private:
+            std::shared_ptr<AdmissionController> owner_;
+            std::string server_;
+            std::atomic<bool> released_{false};
+
+        public:
+            Ticket(std::shared_ptr<AdmissionController> owner, std::string server)
+                : owner_(std::move(owner)), server_(std::move(server)) {}
+            ~Ticket() { release(); }
+
+            void release();
+        };
+
+        struct Stats
+        {
+            uint64_t in_flight = 0;
+            uint64_t queued = 0;      // currently waiting
+            uint64_t admitted = 0;    // total admitted
+            uint64_t waited = 0;      // admitted after queueing
+            uint64_t timed_out = 0;   // gave up while queued
+            uint64_t total_wait_us = 0;
+            uint64_t max_wait_us = 0;
+        };
+
+        /// A caller queued for a slot. Synchronous callers block on cv, while start runs
+        /// asynchronous ones with their ticket on the thread which frees a slot up
+        struct Waiter
+        {
+            std::string server;
+            int priority = 0;
+            bool granted = false;
+            std::condition_variable cv;
+            std::function<void(std::shared_ptr<Ticket>)> start;
+            std::chrono::steady_clock::time_point queued_at;
+        };
+
+        explicit AdmissionController(const Config &config) : config_(config) {}
+
+        // Wait for a free slot for an operation on this PV. Waiters with a higher priority are
+        // admitted first, FIFO within the same priority. Throws PvxsError if none frees up within the timeout
+        std::shared_ptr<Ticket> acquire(const std::string &pv_name, double timeout, int priority = 0);
+
+        // Take a slot without blocking. start runs with the ticket right away if one is free, otherwise
+        // once one frees up, in the same order as acquire(). Returns the queue entry to withdraw(), or
+        // null if start already ran
+        std::shared_ptr<Waiter> enqueue(const std::string &pv_name, int priority,
+                                        std::function<void(std::shared_ptr<Ticket>)> start);
+
+        // Take a waiter out of the queue, false if it was granted a slot first
+        bool withdraw(const std::shared_ptr<Waiter> &waiter, bool timed_out);
+
+        // Remember which server answered for a PV, so later operations count against it
+        void learn(const std::string &pv_name, const std::string &peer);
+
+        Stats stats();
+
+    private:
+        bool fits(const std::string &server) const;
+        void take(const std::string &server);
+        void release(const std::string &server);
+        // Grant slots to queued waiters, highest priority first. Returns the asynchronous ones,
+        // to be started through launch() once lock_ is released
+        std::vector<std::shared_ptr<Waiter>> dispatch();
+        void launch(const std::vector<std::shared_ptr<Waiter>> &granted);
+        // Remember the wait of a waiter being granted a slot
+        void count_wait(const Waiter &waiter);
+
+        Config config_;
+        std::mutex lock_;
+        uint32_t in_flight_ = 0;
+        std::map<std::string, uint32_t> per_server_;
+        std::map<std::string, std::string> pv_server_;
+        std::map<int, std::list<std::shared_ptr<Waiter>>, std::greater<int>> queues_; // by priority, FIFO within each
+        size_t queued_ = 0;
+        Stats stats_;
+    };
+
+    /// An async operation from the moment it is requested. It may first wait in the admission queue
+    /// without blocking anyone, and is cancelled and fails once its deadline passes unless its result
+    /// arrived first. Only observed by the deadline timer, so dropping the handle still cancels it
+    struct OperationHandle
+    {
+        // Builds and executes the operation with the given result() callback
+        using Exec = std::function<std::shared_ptr<pvxs::client::Operation>(std::function<void(pvxs::client::Result &&)> &&)>;
+
+        std::mutex lock;
+        std::string pv_name;
+        std::shared_ptr<OperationState> state;
+        std::shared_ptr<pvxs::client::Operation> op;                 // null while queued for admission
+        std::shared_ptr<CircuitBreaker> breaker;                     // told about the timeout, null when disabled
+        std::shared_ptr<AdmissionController> admission;              // null when disabled
+        std::shared_ptr<AdmissionController::Waiter> waiter;         // place in the admission queue, if queued
+        std::shared_ptr<AdmissionController::Ticket> ticket;         // slot held while running
+
+        ~OperationHandle();
+
+        // Start with the slot granted by admission control, unless cancelled or expired meanwhile
+        void launch(std::shared_ptr<AdmissionController::Ticket> slot, const Exec &exec);
+
+        // Fail with a timeout if still queued or running
+        void expire();
+
+        // Cancel the operation, failing it unless it already finished
+        void cancel();
+
+        // Fail the operation unless it completes within timeout seconds
+        static void arm(const std::shared_ptr<OperationHandle> &handle, double timeout);
+    };
+
     /// Wraps pvxs::client::Context for safe Rust access
     class ContextWrapper
     {
     private:
+        friend class RpcWrapper;
+        friend struct OperationHandle;
+
         pvxs::client::Context context_;
+        std::shared_ptr<pvxs::client::Context> shared_;    // reference on the process-wide context, null if private
+        std::shared_ptr<CircuitBreaker> breaker_;          // null when disabled
+        std::shared_ptr<AdmissionController> admission_;   // null when disabled
+        int priority_ = 0;                                 // PVA channel and queue priority of new operations
+
+        // Consult the circuit breaker and wait for an admission slot (if enabled).
+        // Returns the slot to hold while the operation runs, or null without admission control
+        std::shared_ptr<AdmissionController::Ticket> admit(const std::string &pv_name, double timeout);
+
+        // Execute an operation builder and wait for its result, going through the circuit breaker and
+        // admission control if enabled. op names the operation in traces
+        template <typename Builder>
+        pvxs::Value exec_guarded(const char *operation, const std::string &pv_name, Builder &&builder, double timeout);
+
+        // Build a result() callback which completes the state, reports to the circuit breaker
+        // and gives back the admission slot (each if not null)
+        static std::function<void(pvxs::client::Result &&)> completion_handler(const std::string &pv_name,
+                                                                               const std::shared_ptr<OperationState> &state,
+                                                                               std::shared_ptr<CircuitBreaker> breaker,
+                                                                               std::shared_ptr<AdmissionController> admission,
+                                                                               std::shared_ptr<AdmissionController::Ticket> ticket);
+
+        // Start an async operation without blocking: right away, or once an admission slot frees up
+        // if the context is at its limit. Fails unless done within timeout seconds, queueing included
+        std::unique_ptr<OperationWrapper> start_async(const char *operation, const std::string &pv_name, double timeout,
+                                                      OperationHandle::Exec exec);
 
     public:
         // Create context from environment variables
         static std::unique_ptr<ContextWrapper> from_env();
 
+        // Get a handle on the process-wide context, created from environment variables on first use
+        // and closed when the last handle goes away. Circuit breaker, admission control and priority
+        // stay per handle. Returns a private context instead while sharing is disabled
+        static std::unique_ptr<ContextWrapper> shared();
+
+        // Enable or disable the process-wide context (enabled by default). Existing handles are not affected
+        static void set_sharing_enabled(bool enabled);
+
+        // Number of live handles on the process-wide context (0 if it does not exist)
+        static size_t shared_handle_count();
+
+        // Check if this handle refers to the process-wide context
+        bool is_shared() const { return shared_ != nullptr; }
+
         // Create context with explicit configuration
         explicit ContextWrapper(pvxs::client::Context &&ctx)
             : context_(std::move(ctx)) {}
@@ -285,30 +730,72 @@ namespace pvxs_wrapper
         // Perform a PUT operation (simplified - just set a string array)
         void put(const std::string &pv_name, const rust::Vec<rust::String> &value, double timeout);
 
+        // Perform a PUT of a scalar or shared_array value, converted by the server to the PV's type
+        template <typename T>
+        void put_value(const std::string &pv_name, const T &value, double timeout);
+
         // Get type information (INFO operation)
         std::unique_ptr<ValueWrapper> info(const std::string &pv_name, double timeout);
 
         // Create RPC builder
         std::unique_ptr<class RpcWrapper> rpc_create(const std::string &pv_name);
 
+        // Create a relay republishing a PV of this context through a local SharedPV
+        std::unique_ptr<class RelayWrapper> relay_create(const std::string &upstream, const SharedPVWrapper &target);
+
+        // Create an alarm summary engine subscribing through this context
+        std::unique_ptr<class AlarmSummaryWrapper> alarm_summary_create();
+
+        // Create a recorder writing the updates of an array PV to a file
+        std::unique_ptr<class ArrayRecorderWrapper> array_recorder_create(const std::string &pv_name, const std::string &path);
+
+        // Create a histogram of the values of a PV of this context
+        std::unique_ptr<class HistogramWrapper> histogram_create(const std::string &pv_name);
+
         // Create Monitor
         std::unique_ptr<MonitorWrapper> monitor(const std::string &pv_name);
         
         // Create MonitorBuilder (PVXS-style)
         std::unique_ptr<MonitorBuilderWrapper> monitor_builder(const std::string &pv_name);
+
+        // Enable the circuit breaker (replaces any previous one and its state)
+        void enable_circuit_breaker(const CircuitBreaker::Config &config);
+
+        // Disable the circuit breaker
+        void disable_circuit_breaker() { breaker_.reset(); }
+
+        // Get the circuit breaker (null when disabled)
+        const std::shared_ptr<CircuitBreaker> &circuit_breaker() const { return breaker_; }
+
+        // Enable admission control (operations already admitted keep their slots in the old controller)
+        void enable_admission_control(const AdmissionController::Config &config);
+
+        // Disable admission control
+        void disable_admission_control() { admission_.reset(); }
+
+        // Get the admission controller (null when disabled)
+        const std::shared_ptr<AdmissionController> &admission_controller() const { return admission_; }
+
+        // Set the priority of operations and monitors created from now on (0 to 99, higher is served first).
+        // Used as the PVA channel priority and to order the admission queue
+        void set_priority(int priority);
+
+        // Get the priority of new operations
+        int priority() const { return priority_; }
     };
 
     /// Wraps RPC operations for safe Rust access
     class RpcWrapper
     {
     private:
+        ContextWrapper &owner_;
         pvxs::client::Context &context_;
         std::string pv_name_;
         pvxs::Value arguments_;
 
     public:
-        RpcWrapper(pvxs::client::Context &ctx, const std::string &pv_name)
-            : context_(ctx), pv_name_(pv_name) {}
+        RpcWrapper(ContextWrapper &owner, const std::string &pv_name)
+            : owner_(owner), context_(owner.context_), pv_name_(pv_name) {}
 
         // Add arguments to the RPC call
         void arg_string(const std::string &name, const std::string &value);
@@ -325,6 +812,10 @@ namespace pvxs_wrapper
 
     // Factory functions for Rust (these will be exposed via cxx bridge)
     std::unique_ptr<ContextWrapper> create_context_from_env();
+    std::unique_ptr<ContextWrapper> create_context_shared();
+    void context_set_sharing_enabled(bool enabled);
+    size_t context_shared_handle_count();
+    bool context_is_shared(const ContextWrapper &ctx);
 
     // RPC operations bridge functions
     std::unique_ptr<RpcWrapper> context_rpc_create(
@@ -348,7 +839,43 @@ namespace pvxs_wrapper
     void context_put_string_array(ContextWrapper &ctx, rust::Str pv_name, rust::Vec<int16_t> value, double timeout);
     void context_put_string_array(ContextWrapper &ctx, rust::Str pv_name, rust::Vec<int16_t> value, double timeout);
     void context_put_string_array(ContextWrapper &ctx, rust::Str pv_name, rust::Vec<rust::String> value, double timeout);
+    void context_put_int8(ContextWrapper &ctx, rust::Str pv_name, int8_t value, double timeout);
+    void context_put_int8_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const int8_t> value, double timeout);
+    void context_put_uint8(ContextWrapper &ctx, rust::Str pv_name, uint8_t value, double timeout);
+    void context_put_uint8_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const uint8_t> value, double timeout);
+    void context_put_int16(ContextWrapper &ctx, rust::Str pv_name, int16_t value, double timeout);
+    void context_put_int16_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const int16_t> value, double timeout);
+    void context_put_uint16(ContextWrapper &ctx, rust::Str pv_name, uint16_t value, double timeout);
+    void context_put_uint16_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const uint16_t> value, double timeout);
+    void context_put_uint32(ContextWrapper &ctx, rust::Str pv_name, uint32_t value, double timeout);
+    void context_put_uint32_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const uint32_t> value, double timeout);
+    void context_put_int64(ContextWrapper &ctx, rust::Str pv_name, int64_t value, double timeout);
+    void context_put_int64_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const int64_t> value, double timeout);
+    void context_put_uint64(ContextWrapper &ctx, rust::Str pv_name, uint64_t value, double timeout);
+    void context_put_uint64_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const uint64_t> value, double timeout);
+    void context_put_float32(ContextWrapper &ctx, rust::Str pv_name, float value, double timeout);
+    void context_put_float32_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const float> value, double timeout);
+    void context_put_bool(ContextWrapper &ctx, rust::Str pv_name, bool value, double timeout);
+    void context_put_bool_array(ContextWrapper &ctx, rust::Str pv_name, rust::Slice<const bool> value, double timeout);
     std::unique_ptr<ValueWrapper> context_info(ContextWrapper &ctx, rust::Str pv_name, double timeout);
+
+    // Circuit breaker bridge functions
+    void context_enable_circuit_breaker(ContextWrapper &ctx, uint32_t failure_threshold, uint64_t open_ms,
+                                        uint64_t negative_ttl_ms, bool per_server);
+    void context_disable_circuit_breaker(ContextWrapper &ctx);
+    uint8_t context_circuit_state(const ContextWrapper &ctx, rust::Str pv_name);
+    uint64_t context_circuit_fast_fail_count(const ContextWrapper &ctx);
+    void context_circuit_reset(ContextWrapper &ctx);
+
+    // Admission control bridge functions
+    void context_enable_admission_control(ContextWrapper &ctx, uint32_t max_in_flight, uint32_t max_per_server);
+    void context_disable_admission_control(ContextWrapper &ctx);
+    void context_admission_stats(const ContextWrapper &ctx, uint64_t &in_flight, uint64_t &queued, uint64_t &admitted,
+                                 uint64_t &waited, uint64_t &timed_out, uint64_t &total_wait_us, uint64_t &max_wait_us);
+
+    // Operation priority bridge functions
+    void context_set_priority(ContextWrapper &ctx, int32_t priority);
+    int32_t context_get_priority(const ContextWrapper &ctx);
     // ============================================================================
     // Async operations for Rust
     std::unique_ptr<OperationWrapper> context_get_async(ContextWrapper &ctx, rust::Str pv_name, double timeout);
@@ -360,6 +887,14 @@ namespace pvxs_wrapper
     std::unique_ptr<ValueWrapper> operation_get_result(OperationWrapper &op);
     void operation_cancel(OperationWrapper &op);
     bool operation_wait_for_completion(OperationWrapper &op, uint64_t timeout_ms);
+    rust::String operation_name(const OperationWrapper &op);
+
+    // Operation sets for waiting on many operations at once
+    std::unique_ptr<OperationSetWrapper> operation_set_create();
+    size_t operation_set_add(OperationSetWrapper &set, const OperationWrapper &op);
+    size_t operation_set_size(const OperationSetWrapper &set);
+    rust::Vec<size_t> operation_set_wait_any(OperationSetWrapper &set, uint64_t timeout_ms);
+    rust::Vec<size_t> operation_set_wait_all(OperationSetWrapper &set, uint64_t timeout_ms);
 
     // Value accessors for Rust
     bool value_is_valid(const ValueWrapper &val);
@@ -371,6 +906,24 @@ namespace pvxs_wrapper
     rust::Vec<double> value_get_field_double_array(const ValueWrapper &val, rust::String field_name);
     rust::Vec<int32_t> value_get_field_int32_array(const ValueWrapper &val, rust::String field_name);
     rust::Vec<rust::String> value_get_field_string_array(const ValueWrapper &val, rust::String field_name);
+    int8_t value_get_field_int8(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<int8_t> value_get_field_int8_array(const ValueWrapper &val, rust::String field_name);
+    uint8_t value_get_field_uint8(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<uint8_t> value_get_field_uint8_array(const ValueWrapper &val, rust::String field_name);
+    int16_t value_get_field_int16(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<int16_t> value_get_field_int16_array(const ValueWrapper &val, rust::String field_name);
+    uint16_t value_get_field_uint16(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<uint16_t> value_get_field_uint16_array(const ValueWrapper &val, rust::String field_name);
+    uint32_t value_get_field_uint32(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<uint32_t> value_get_field_uint32_array(const ValueWrapper &val, rust::String field_name);
+    int64_t value_get_field_int64(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<int64_t> value_get_field_int64_array(const ValueWrapper &val, rust::String field_name);
+    uint64_t value_get_field_uint64(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<uint64_t> value_get_field_uint64_array(const ValueWrapper &val, rust::String field_name);
+    float value_get_field_float32(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<float> value_get_field_float32_array(const ValueWrapper &val, rust::String field_name);
+    bool value_get_field_bool(const ValueWrapper &val, rust::String field_name);
+    rust::Vec<bool> value_get_field_bool_array(const ValueWrapper &val, rust::String field_name);
 
     // Monitor operations for Rust
     std::unique_ptr<MonitorWrapper> context_monitor_create(ContextWrapper &ctx, rust::String pv_name);
@@ -383,12 +936,16 @@ namespace pvxs_wrapper
     bool monitor_is_connected(const MonitorWrapper &monitor);
     rust::String monitor_get_name(const MonitorWrapper &monitor);
     std::unique_ptr<ValueWrapper> monitor_pop(MonitorWrapper &monitor);
+    bool monitor_duplicate_stats(const MonitorWrapper &monitor, uint64_t &passed, uint64_t &suppressed);
 
     // MonitorBuilder operations for Rust
     std::unique_ptr<MonitorBuilderWrapper> context_monitor_builder_create(ContextWrapper &ctx, rust::String pv_name);
     void monitor_builder_mask_connected(MonitorBuilderWrapper &builder, bool mask);
     void monitor_builder_mask_disconnected(MonitorBuilderWrapper &builder, bool mask);
     void monitor_builder_set_event_callback(MonitorBuilderWrapper &builder, uintptr_t callback_ptr);
+    void monitor_builder_priority(MonitorBuilderWrapper &builder, int32_t priority);
+    void monitor_builder_suppress_duplicates(MonitorBuilderWrapper &builder, rust::Vec<rust::String> fields);
+    void monitor_builder_record_option(MonitorBuilderWrapper &builder, rust::Str name, rust::Str value);
     std::unique_ptr<MonitorWrapper> monitor_builder_exec(MonitorBuilderWrapper &builder);
     std::unique_ptr<MonitorWrapper> monitor_builder_exec_with_callback(MonitorBuilderWrapper &builder, uint64_t callback_id);
 
@@ -396,12 +953,267 @@ namespace pvxs_wrapper
     // Server-side wrappers
     // ============================================================================
 
+    class SubscriberHub;
+    class SendLimiter;
+
+    /// One monitor subscription served by a SubscriberHub
+    struct HubSubscriber
+    {
+        std::unique_ptr<pvxs::server::MonitorControlOp> control;
+        std::string peer;
+        std::weak_ptr<SubscriberHub> hub;
+        std::shared_ptr<SendLimiter> limiter; // null when send limits are off
+        pvxs::Value pending;                  // latest update held back from a slow subscriber
+        size_t queued = 0;                    // queue depth as last seen by the limiter
+
+        // Rate requested through pvRequest: record[dec=N] forwards one post out of N,
+        // record[interval=S] leaves at least S seconds between updates
+        uint64_t decimation = 1;
+        std::chrono::steady_clock::duration min_interval{0};
+        uint64_t posts = 0;                             // posts offered since subscribing
+        pvxs::Value skipped;                            // posts folded together since the last forwarded one
+        std::chrono::steady_clock::time_point last_sent;
+        std::chrono::steady_clock::time_point last_offered; // time of the last post, to pace trailing flushes
+        std::chrono::steady_clock::time_point tail_due;     // decimated posts are flushed then if nothing follows
+        bool flush_scheduled = false;                   // a trailing flush of skipped is pending
+
+        // Deadband requested through pvRequest: record[deadband=X] (absolute) or
+        // record[deadbandPercent=P] (relative to the last value sent) on a scalar value
+        double deadband = 0.0;
+        double deadband_percent = 0.0;
+        double last_value = 0.0;    // value of the last update sent
+        bool last_value_valid = false;
+
+        // Array slice requested through pvRequest: record[start=N], record[count=N] and
+        // record[stride=N] select which elements of an array value are sent
+        size_t slice_start = 0;
+        size_t slice_count = size_t(-1);
+        size_t slice_stride = 1;
+
+        bool rate_limited() const { return decimation > 1 || min_interval.count() > 0; }
+        bool has_deadband() const { return deadband > 0 || deadband_percent > 0; }
+        bool has_slice() const { return slice_start > 0 || slice_count != size_t(-1) || slice_stride > 1; }
+    };
+
+    /// Per-client send-queue accounting across all subscriptions of a server
+    class SendLimiter
+    {
+    public:
+        struct Config
+        {
+            size_t max_queued_per_client = 0;   // 0 = unlimited
+            size_t alert_queued_per_client = 0; // queue depth at which a client is reported slow
+        };
+
+        struct ClientStats
+        {
+            uint64_t subscriptions = 0;
+            uint64_t queued = 0;     // updates waiting to be sent, as of the last post or drain
+            uint64_t max_queued = 0; // high water mark of queued
+            uint64_t squashed = 0;   // updates folded into a later one
+            uint64_t alerts = 0;     // times the client crossed the alert threshold
+            bool slow = false;
+        };
+
+    private:
+        struct Client
+        {
+            ClientStats stats;
+            size_t held = 0; // subscriptions with a pending update
+            std::list<std::weak_ptr<HubSubscriber>> subscribers;
+        };
+
+        const Config config_;
+        void (*alert_)() = nullptr;
+        std::mutex lock_;
+        std::map<std::string, Client> clients_;
+        uint64_t alert_count_ = 0;
+
+        // Move a subscriber's queue depth into its client's total (lock_ held), true if an alert is due
+        bool account(Client &client, HubSubscriber &sub, size_t depth);
+
+    public:
+        SendLimiter(const Config &config, void (*alert)()) : config_(config), alert_(alert) {}
+
+        void attach(const std::shared_ptr<HubSubscriber> &sub);
+        void detach(HubSubscriber &sub);
+
+        // Record the current queue depth, true if the client may queue another update
+        bool fits(HubSubscriber &sub, size_t depth);
+
+        // Record the outcome of a delivery attempt
+        void settle(HubSubscriber &sub, size_t depth, bool was_held, bool held, bool squashed);
+
+        // Other subscriptions of the same client waiting for room, empty if none are
+        std::vector<std::shared_ptr<HubSubscriber>> waiting(const HubSubscriber &sub);
+
+        std::vector<std::string> peers();
+        bool client_stats(const std::string &peer, ClientStats &stats);
+        uint64_t alert_count();
+    };
+
+    /// Fans SharedPV updates out to monitor subscriptions so the wrapper controls delivery
+    class SubscriberHub : public std::enable_shared_from_this<SubscriberHub>
+    {
+    private:
+        // Work for a subscriber handed over by a pvxs callback
+        struct Deferred
+        {
+            enum Kind { Retry, Drained, Closed };
+            std::shared_ptr<HubSubscriber> sub;
+            Kind kind;
+        };
+
+        // Held by the thread delivering to subscribers, including across calls into pvxs. Guards
+        // current_, subscribers_ and the delivery state of each subscriber
+        std::mutex send_lock_;
+        // Guards deferred_ and sending_ only, never held across calls into pvxs. pvxs callbacks
+        // queue their work here instead of waiting for send_lock_, so they cannot deadlock
+        // against a thread posting to the same subscription
+        std::mutex lock_;
+        std::string name_; // set before the PV is served, for traces
+        pvxs::Value current_;
+        std::list<std::shared_ptr<HubSubscriber>> subscribers_;
+        std::vector<Deferred> deferred_;
+        bool sending_ = false; // send_lock_ is held, so deferred_ will be drained before it is released
+        std::atomic<uint64_t> posts_{0};
+
+        // Run fn with send_lock_ held, then do the work deferred meanwhile
+        template <typename Fn>
+        void send(Fn &&fn);
+        // Hand work over to the thread holding send_lock_, or take it and do the work here
+        void defer(const std::shared_ptr<HubSubscriber> &sub, Deferred::Kind kind);
+
+        // Queue an update (or the pending one if update is empty) for one subscriber, sliced
+        // to the elements it asked for (send_lock_ held)
+        void deliver(HubSubscriber &sub, const pvxs::Value &update);
+        // Apply the subscriber's requested deadband and rate, then deliver what is due (send_lock_ held)
+        void offer(const std::shared_ptr<HubSubscriber> &sub, const pvxs::Value &update);
+        // Deliver the folded updates of a filtered subscriber (send_lock_ held)
+        void send_skipped(HubSubscriber &sub, std::chrono::steady_clock::time_point now);
+        void unsubscribe(const std::weak_ptr<HubSubscriber> &sub);
+        void drained(const std::shared_ptr<HubSubscriber> &sub);
+
+    public:
+        void set_name(const std::string &name) { name_ = name; }
+        const std::string &name() const { return name_; }
+
+        void open(const pvxs::Value &initial);
+        void close();
+
+        // Post to the SharedPV, then to every subscriber
+        void post(pvxs::server::SharedPV &pv, const pvxs::Value &update);
+
+        // Number of posts so far, to tell whether the value changed without watching every post
+        uint64_t post_count() const { return posts_.load(std::memory_order_acquire); }
+
+        void subscribe(std::unique_ptr<pvxs::server::MonitorSetupOp> &&setup, const std::shared_ptr<SendLimiter> &limiter);
+
+        // Retry a pending update once the client has room again
+        void retry(const std::shared_ptr<HubSubscriber> &sub);
+
+        // Send what a rate limited subscriber skipped once its interval has passed, or once no
+        // post followed the decimated ones in time
+        void flush(const std::shared_ptr<HubSubscriber> &sub);
+
+        size_t subscriber_count();
+    };
+
+    /// Value of a computed PV, produced by a function when a GET arrives rather than posted.
+    /// A result younger than the TTL is served again without calling the function, and
+    /// concurrent GETs of a stale value wait for a single evaluation. Functions run on a worker
+    /// thread shared by all computed PVs, so the server's threads never wait on them.
+    class ComputedValue : public std::enable_shared_from_this<ComputedValue>
+    {
+    public:
+        // Fills in an empty update of the PV's type, at least "value"
+        using Compute = std::function<void(pvxs::Value &)>;
+
+        struct Stats
+        {
+            uint64_t evaluations = 0;
+            uint64_t cache_hits = 0;
+            uint64_t failed = 0; // the function threw
+        };
+
+    private:
+        Compute compute_;
+        std::chrono::steady_clock::duration ttl_;
+        std::mutex lock_; // not held across evaluations
+        std::chrono::steady_clock::time_point computed_at_;
+        bool fresh_ = false;
+        bool evaluating_ = false;
+        uint64_t generation_ = 0; // bumped by invalidate, so an evaluation it overlapped isn't cached
+        std::vector<std::unique_ptr<pvxs::server::ExecOp>> waiting_; // GETs answered by the next evaluation
+        Stats stats_;
+
+        // lock_ held
+        bool is_fresh() const;
+        // Hand an evaluation to the worker unless one is under way, lock_ held
+        void schedule(const pvxs::server::SharedPV &pv, const std::shared_ptr<SubscriberHub> &hub);
+        // Call the function, post its result through the hub and answer the waiting GETs, on the worker
+        void evaluate(pvxs::server::SharedPV pv, const std::shared_ptr<SubscriberHub> &hub);
+
+    public:
+        // A TTL of 0 evaluates on every GET
+        ComputedValue(Compute compute, double ttl);
+
+        // Answer a GET at once while the value is fresh, otherwise once the worker has computed it
+        void get(std::unique_ptr<pvxs::server::ExecOp> &&op, const pvxs::server::SharedPV &pv,
+                 const std::shared_ptr<SubscriberHub> &hub);
+        // Compute a fresh value in the background unless the current one is still fresh
+        void refresh(const pvxs::server::SharedPV &pv, const std::shared_ptr<SubscriberHub> &hub);
+        // Make the next read evaluate
+        void invalidate();
+        Stats stats();
+    };
+
+    /// Source for PVs added through ServerWrapper::add_pv. GET and PUT are served by the
+    /// SharedPV itself (GET by its ComputedValue, if any). So are subscriptions, except while send
+    /// limits are on or when the pvRequest asks for a per-subscription option (record[dec], [interval],
+    /// [deadband], [deadbandPercent], [start], [count] or [stride]): those are served by the PV's SubscriberHub.
+    class SharedPVSource : public pvxs::server::Source, public std::enable_shared_from_this<SharedPVSource>
+    {
+    private:
+        struct Entry
+        {
+            pvxs::server::SharedPV pv;
+            std::shared_ptr<SubscriberHub> hub;
+            std::shared_ptr<ComputedValue> computed;
+            bool mailbox;
+        };
+
+        std::mutex lock_;
+        std::map<std::string, Entry> pvs_;
+        std::shared_ptr<SendLimiter> limiter_;
+
+    public:
+        void add(const std::string &name, SharedPVWrapper &pv);
+        void remove(const std::string &name);
+
+        // Add many PVs under one lock; none of them if any name is taken
+        void add_all(const std::vector<std::pair<std::string, SharedPVWrapper *>> &pvs);
+
+        // Name and PV of every mailbox PV which isn't computed, in name order
+        std::vector<std::pair<std::string, pvxs::server::SharedPV>> mailbox_pvs();
+
+        void set_limiter(std::shared_ptr<SendLimiter> limiter);
+        std::shared_ptr<SendLimiter> limiter();
+
+        void onSearch(Search &op) override;
+        void onCreate(std::unique_ptr<pvxs::server::ChannelControl> &&chan) override;
+        List onList() override;
+    };
+
     /// Wraps pvxs::server::SharedPV for safe Rust access
     class SharedPVWrapper
     {
     private:
         pvxs::server::SharedPV pv_;
         pvxs::Value template_value_; // Store template for cloneEmpty()
+        std::shared_ptr<SubscriberHub> hub_ = std::make_shared<SubscriberHub>();
+        std::shared_ptr<ComputedValue> computed_;
+        bool mailbox_ = false;
 
     public:
         SharedPVWrapper() = default;
@@ -429,6 +1241,20 @@ namespace pvxs_wrapper
         // Get template value for creating compatible updates
         const pvxs::Value &get_template() const { return template_value_; }
 
+        // Subscription fan-out used when the PV is served by a ServerWrapper
+        const std::shared_ptr<SubscriberHub> &hub() const { return hub_; }
+
+        // Produce the value on GET instead of serving the last post. Must be set before the PV
+        // is added to a server, which makes it read-only
+        void set_computed(std::shared_ptr<ComputedValue> computed);
+        const std::shared_ptr<ComputedValue> &computed() const { return computed_; }
+
+        // Whether clients may PUT to the PV (made by create_mailbox)
+        bool is_mailbox() const { return mailbox_; }
+
+        // Refuse PUTs of an index outside the choices of the PV's open NTEnum value
+        void check_enum_puts();
+
         // Factory methods
         static std::unique_ptr<SharedPVWrapper> create_mailbox();
         static std::unique_ptr<SharedPVWrapper> create_readonly();
@@ -461,15 +1287,322 @@ namespace pvxs_wrapper
         static std::unique_ptr<StaticSourceWrapper> create();
     };
 
+    /// Composite PV whose members are NTScalar structures. Member changes are staged and posted
+    /// together as one update, in which only the changed members are marked
+    class GroupPVWrapper
+    {
+    private:
+        std::vector<std::pair<std::string, pvxs::TypeCode>> members_;
+        std::unique_ptr<SharedPVWrapper> pv_ = SharedPVWrapper::create_readonly();
+        pvxs::Value prototype_; // built from members_ on first use
+        pvxs::Value pending_;   // staged changes
+
+        // Staged member structure, checking the name and freezing the type
+        pvxs::Value member(const std::string &name);
+
+    public:
+        // Define a member, only before anything is staged or the PV is opened
+        void add_member(const std::string &name, pvxs::TypeCode code);
+
+        // Stage a change of member.value or member.alarm
+        template <typename T>
+        void set_value(const std::string &name, const T &value) { member(name)["value"] = value; }
+        void set_alarm(const std::string &name, int32_t severity, int32_t status, const std::string &message);
+
+        // Open the PV with the staged values as initial state
+        void open();
+
+        // Post all staged changes as a single update, stamping the changed members.
+        // Returns false if nothing was staged
+        bool post();
+
+        SharedPVWrapper &pv() { return *pv_; }
+        const SharedPVWrapper &pv() const { return *pv_; }
+    };
+
+    struct NTScalarMetadata;
+
+    /// Read-only, shared mapping of a byte range of a file. Writes to the file by other
+    /// handles or processes show through the mapping.
+    class FileMapping
+    {
+    private:
+        const uint8_t *data_ = nullptr; // start of the requested range
+        void *base_ = nullptr;          // start of the mapping, aligned down from data_
+        size_t mapped_ = 0;
+        uint64_t end_ = 0;              // file offset just past the requested range
+#if defined(_WIN32)
+        void *file_ = nullptr; // HANDLEs
+        void *mapping_ = nullptr;
+#else
+        int fd_ = -1;
+#endif
+
+        void unmap();
+
+    public:
+        // Map length bytes from offset, or everything from offset to the end of the file if length is 0
+        FileMapping(const std::string &path, uint64_t offset, uint64_t length);
+        ~FileMapping() { unmap(); }
+        FileMapping(const FileMapping &) = delete;
+        FileMapping &operator=(const FileMapping &) = delete;
+
+        const uint8_t *data() const { return data_; }
+        size_t size() const { return mapped_ - static_cast<size_t>(data_ - static_cast<const uint8_t *>(base_)); }
+
+        // False if the file has been truncated below the mapped range since it was mapped. Reading
+        // pages past the end of a file raises SIGBUS, so check this before handing out the data
+        bool intact() const;
+    };
+
+    // CRC-32 (IEEE 802.3) of a byte range
+    uint32_t crc32(const char *data, size_t size);
+
+    // Replace the contents of a file, flushed to disk before returning
+    void write_file_synced(const std::string &path, const std::string &data);
+
+    /// Cursor over a byte range holding host byte order values. Throws rather than read past the end.
+    class ByteReader
+    {
+    private:
+        const char *at_;
+        const char *end_;
+
+    public:
+        ByteReader(const char *data, size_t size) : at_(data), end_(data + size) {}
+
+        size_t remaining() const { return static_cast<size_t>(end_ - at_); }
+
+        const char *take(size_t size) {
+            if (remaining() < size) {
+                throw PvxsError("Truncated record");
+            }
+            auto data = at_;
+            at_ += size;
+            return data;
+        }
+
+        template <typename T>
+        T get() {
+            T value;
+            std::memcpy(&value, take(sizeof(value)), sizeof(value));
+            return value;
+        }
+
+        std::string string(size_t size) { return std::string(take(size), size); }
+    };
+
+    /// PV whose array value points straight into a read-only mapping of a file region. Every
+    /// posted or cached copy of the array holds a reference to the mapping, so it stays mapped
+    /// until the last update has been sent. Producers write into the file, then call post().
+    class MappedArrayPVWrapper
+    {
+    private:
+        std::shared_ptr<FileMapping> mapping_;
+        pvxs::shared_array<const void> (*view_)(const std::shared_ptr<FileMapping> &, size_t) = nullptr;
+        size_t count_ = 0; // elements in the mapped region
+        std::unique_ptr<SharedPVWrapper> pv_ = SharedPVWrapper::create_readonly();
+
+    public:
+        // Map count elements (0 for the rest of the file) of the named type from offset bytes
+        // into path, and open the PV with them
+        void open(const std::string &path, const std::string &type, uint64_t offset, uint64_t count,
+                  const NTScalarMetadata &metadata);
+
+        // Republish the region, so clients see what was written into the file since the last post.
+        // Throws if the file no longer covers the region
+        void post();
+
+        size_t count() const { return count_; }
+        SharedPVWrapper &pv() { return *pv_; }
+        const SharedPVWrapper &pv() const { return *pv_; }
+    };
+
+    /// Stages posts from many threads and applies them from a single flusher thread. Each PV has
+    /// one slot holding its latest staged value in an atomic word, so producers never lock, never
+    /// call into pvxs and never wait on one another; a value staged before the last one was
+    /// flushed replaces it. Every interval the flusher posts each changed slot once, in the order
+    /// the PVs were added.
+    class PostStagerWrapper
+    {
+    public:
+        struct Stats
+        {
+            uint64_t staged = 0;
+            uint64_t coalesced = 0; // staged values replaced before being flushed
+            uint64_t posted = 0;
+            uint64_t failed = 0;    // posts which threw
+            uint64_t flushes = 0;   // intervals which posted at least one value
+            // Seconds from the oldest value of a flush being staged until the flush had posted it
+            double last_latency = 0.0;
+            double max_latency = 0.0;
+            double mean_latency = 0.0;
+        };
+
+    private:
+        enum class Kind : uint8_t
+        {
+            Double,
+            Int32,
+        };
+
+        struct Slot
+        {
+            Kind kind;
+            pvxs::server::SharedPV pv;
+            std::shared_ptr<SubscriberHub> hub;
+            pvxs::Value prototype;
+            std::atomic<uint64_t> bits{0};     // the value, as the bits of a double or a sign-extended int32
+            std::atomic<int64_t> staged_at{0}; // steady clock ns of the first unflushed stage, 0 when flushed
+            std::atomic<int64_t> stamp{0};     // system clock ns of the latest stage, posted as its timeStamp
+
+            Slot(Kind kind, const SharedPVWrapper &pv);
+        };
+
+        // Shared with the flusher thread
+        struct State
+        {
+            std::deque<Slot> slots; // only added to while stopped, so producers index it without locking
+            std::chrono::steady_clock::duration interval;
+            std::mutex lock;
+            std::condition_variable wake;
+            bool stopping = false;
+            std::atomic<uint64_t> staged{0};
+            std::atomic<uint64_t> coalesced{0};
+            std::atomic<uint64_t> posted{0};
+            std::atomic<uint64_t> failed{0};
+            std::atomic<uint64_t> flushes{0};
+            std::atomic<int64_t> last_latency{0}; // ns
+            std::atomic<int64_t> max_latency{0};
+            std::atomic<int64_t> total_latency{0};
+
+            // Post every changed slot once
+            void flush();
+            // Flush every interval until stopping, then once more
+            void run();
+        };
+
+        std::shared_ptr<State> state_ = std::make_shared<State>();
+        std::thread flusher_;
+
+        void stage(size_t slot, Kind kind, uint64_t bits) const;
+
+    public:
+        // Flush every interval seconds
+        explicit PostStagerWrapper(double interval);
+        ~PostStagerWrapper();
+
+        // Give an open double or int32 scalar PV a slot, only while stopped. Returns the slot index
+        size_t add(const SharedPVWrapper &pv);
+
+        // Stage the next value of a slot, from any thread
+        void stage_double(size_t slot, double value) const;
+        void stage_int32(size_t slot, int32_t value) const;
+
+        void start();
+        // Stop the flusher after posting what is staged
+        void stop();
+        bool is_running() const { return flusher_.joinable(); }
+
+        Stats stats() const;
+    };
+
+    /// Persists the values of SharedPVs. A background thread checks every interval which PVs
+    /// were posted since the last snapshot and, if any were, writes a new one. Only changed PVs
+    /// are encoded again. Snapshots alternate between "<path>.0" and "<path>.1", each carrying a
+    /// generation number and a checksum, so a crash while writing one leaves the other intact.
+    class AutosaveWrapper
+    {
+    public:
+        struct Stats
+        {
+            uint64_t saves = 0;
+            uint64_t failed = 0;     // snapshots which could not be written
+            uint64_t generation = 0; // of the newest snapshot written or restored
+            uint64_t bytes = 0;      // size of the newest snapshot written
+            double last_duration = 0.0; // seconds spent encoding and writing it
+        };
+
+    private:
+        struct Entry
+        {
+            std::string name;
+            pvxs::server::SharedPV pv;
+            std::shared_ptr<SubscriberHub> hub;
+            pvxs::Value prototype;
+            uint64_t saved_posts = 0; // hub post count when record was encoded
+            std::string record;       // encoded name and value, reused while the PV is unchanged
+        };
+
+        // Shared with the writer thread
+        struct State
+        {
+            std::string path;
+            std::chrono::steady_clock::duration interval;
+            std::mutex save_lock;       // held while saving or restoring
+            std::vector<Entry> entries; // only added to while stopped
+            uint64_t generation = 0;
+            bool unsaved = false;       // the last snapshot failed, so the next one can't be skipped
+            std::mutex lock;
+            std::condition_variable wake;
+            bool stopping = false;
+            std::atomic<uint64_t> saves{0};
+            std::atomic<uint64_t> failed{0};
+            std::atomic<uint64_t> saved_generation{0};
+            std::atomic<uint64_t> bytes{0};
+            std::atomic<int64_t> last_duration{0}; // ns
+
+            // Write a snapshot if any PV changed since the last one, or if forced
+            bool save(bool force);
+            // Save every interval until stopping, then once more
+            void run();
+        };
+
+        std::shared_ptr<State> state_ = std::make_shared<State>();
+        std::thread writer_;
+
+    public:
+        // Continues the generations of snapshots already at path
+        AutosaveWrapper(const std::string &path, double interval);
+        ~AutosaveWrapper();
+
+        // Persist an open PV under a name, only while stopped
+        void add(const std::string &name, const SharedPVWrapper &pv);
+
+        // Post the values of the newest valid snapshot to the PVs added so far, only while
+        // stopped. Returns how many PVs were restored
+        size_t restore();
+
+        // Write a snapshot now if any PV changed, returns whether one was written
+        bool save();
+
+        void start();
+        // Stop the writer after a final save
+        void stop();
+        bool is_running() const { return writer_.joinable(); }
+
+        Stats stats() const;
+    };
+
+    /// PVs opened from a snapshot by ServerWrapper::load_snapshot, in file order. They are
+    /// served already; the handles wait here until taken.
+    class PVSnapshotWrapper
+    {
+    public:
+        std::vector<std::string> names;
+        std::vector<std::unique_ptr<SharedPVWrapper>> pvs;
+    };
+
     /// Wraps pvxs::server::Server for safe Rust access
     class ServerWrapper
     {
     private:
         pvxs::server::Server server_;
+        std::shared_ptr<SharedPVSource> source_ = std::make_shared<SharedPVSource>();
 
     public:
         ServerWrapper() = default;
-        explicit ServerWrapper(pvxs::server::Server &&server) : server_(std::move(server)) {}
+        explicit ServerWrapper(pvxs::server::Server &&server);
 
         // Start the server
         void start();
@@ -477,7 +1610,7 @@ namespace pvxs_wrapper
         // Stop the server
         void stop();
 
-        // Add a SharedPV directly (uses built-in StaticSource)
+        // Add a SharedPV directly (served by this wrapper's SharedPVSource)
         void add_pv(const std::string &name, SharedPVWrapper &pv);
 
         // Remove a PV by name
@@ -490,11 +1623,436 @@ namespace pvxs_wrapper
         uint16_t get_tcp_port() const;
         uint16_t get_udp_port() const;
 
+        // Per-client send limits for subscriptions created from now on
+        void enable_send_limits(const SendLimiter::Config &config, void (*alert)());
+        void disable_send_limits();
+        std::shared_ptr<SendLimiter> send_limiter() const { return source_->limiter(); }
+
+        // Write the type, metadata and value of every mailbox PV to a snapshot file, replacing
+        // it atomically. Returns the number of PVs written
+        uint64_t save_snapshot(const std::string &path) const;
+
+        // Open a mailbox PV with the saved value for every record of a snapshot file and serve
+        // them all at once
+        std::unique_ptr<PVSnapshotWrapper> load_snapshot(const std::string &path);
+
+        // Client context configured to reach this server directly, on its own ports and
+        // without broadcast searches
+        std::unique_ptr<ContextWrapper> client_context() const;
+
         // Factory methods
         static std::unique_ptr<ServerWrapper> from_env();
         static std::unique_ptr<ServerWrapper> isolated();
     };
 
+    // ============================================================================
+    // Relay: client subscription republished through a SharedPV
+    // ============================================================================
+
+    /// One step of a relay's transform chain
+    struct RelayTransform
+    {
+        enum class Kind : uint8_t
+        {
+            Scale,    // value = value * factor + offset
+            Clamp,    // value limited to [low, high]
+            Decimate, // forward one update out of every `every`
+            Remap,    // outgoing field `field` is taken from upstream field `source`
+        };
+
+        Kind kind;
+        double a = 0.0;     // Scale: factor, Clamp: low
+        double b = 0.0;     // Scale: offset, Clamp: high
+        uint64_t every = 1; // Decimate
+        std::string field;  // Remap: destination
+        std::string source; // Remap: origin
+    };
+
+    /// Subscribes to an upstream PV and posts every update, passed through a chain of transforms,
+    /// to a local SharedPV. Updates are handled on the client worker thread and never reach Rust.
+    class RelayWrapper
+    {
+    public:
+        struct Stats
+        {
+            uint64_t forwarded = 0;
+            uint64_t decimated = 0;
+            uint64_t failed = 0;
+        };
+
+    private:
+        // Shared with the subscription's event callback, so it outlives a stop() racing an update
+        struct State
+        {
+            std::string upstream;
+            pvxs::server::SharedPV pv;
+            std::shared_ptr<SubscriberHub> hub;
+            pvxs::Value prototype;                                    // empty update of the target's type
+            std::vector<RelayTransform> chain;                        // Scale, Clamp and Decimate steps in order
+            std::vector<std::pair<std::string, std::string>> fields; // outgoing field <- upstream field
+            std::vector<uint64_t> seen;                               // per-step counters of Decimate steps
+            std::atomic<uint64_t> forwarded{0};
+            std::atomic<uint64_t> decimated{0};
+            std::atomic<uint64_t> failed{0};
+
+            // Apply the chain to one upstream update and post it, false if it was decimated
+            bool forward(const pvxs::Value &update);
+            // Post an INVALID alarm while the upstream PV is unreachable
+            void disconnected();
+        };
+
+        pvxs::client::Context context_;
+        int priority_ = 0;
+        std::shared_ptr<State> state_;
+        std::vector<RelayTransform> transforms_;
+        std::shared_ptr<pvxs::client::Subscription> subscription_;
+
+    public:
+        RelayWrapper(const pvxs::client::Context &ctx, int priority, const std::string &upstream, const SharedPVWrapper &target);
+        ~RelayWrapper();
+
+        // Append a step to the chain, only while stopped
+        void add(const RelayTransform &transform);
+
+        // Subscribe to the upstream PV. The target must be open
+        void start();
+        void stop();
+        bool is_running() const { return subscription_ != nullptr; }
+
+        Stats stats() const;
+        const std::string &upstream() const { return state_->upstream; }
+    };
+
+    // Relay functions for Rust FFI
+    std::unique_ptr<RelayWrapper> context_relay_create(ContextWrapper &ctx, rust::String upstream, const SharedPVWrapper &target);
+    void relay_add_scale(RelayWrapper &relay, double factor, double offset);
+    void relay_add_clamp(RelayWrapper &relay, double low, double high);
+    void relay_add_decimate(RelayWrapper &relay, uint64_t every);
+    void relay_add_remap(RelayWrapper &relay, rust::Str from, rust::Str to);
+    void relay_start(RelayWrapper &relay);
+    void relay_stop(RelayWrapper &relay);
+    bool relay_is_running(const RelayWrapper &relay);
+    void relay_stats(const RelayWrapper &relay, uint64_t &forwarded, uint64_t &decimated, uint64_t &failed);
+
+    // ============================================================================
+    // Alarm summary: per-group alarm counts kept up to date incrementally
+    // ============================================================================
+
+    /// Monitors alarm.severity of many PVs and keeps, per group, the number of PVs in each severity
+    /// and the worst one. Groups form a hierarchy through ':' in their names ("LINAC:RF" is part of
+    /// "LINAC"). A severity change touches only the PV's group and its ancestors, never other PVs.
+    class AlarmSummaryWrapper
+    {
+    public:
+        // Index into Group::counts. PVs start out disconnected until their first update
+        enum Level : uint8_t
+        {
+            NoAlarm = 0,
+            Minor = 1,
+            Major = 2,
+            Invalid = 3,
+            Disconnected = 4,
+            Levels = 5,
+        };
+
+        struct GroupStats
+        {
+            uint64_t total = 0;
+            uint64_t counts[Levels] = {};
+            uint8_t max_severity = 0; // Disconnected PVs count as INVALID
+        };
+
+    private:
+        struct Group
+        {
+            std::string name;
+            size_t parent;
+            GroupStats stats;
+            std::unique_ptr<SharedPVWrapper> pv; // summary, open from creation
+        };
+
+        struct Member
+        {
+            std::string pv_name;
+            size_t group;
+            uint8_t level = Disconnected;
+        };
+
+        // Shared with the subscription callbacks
+        struct State
+        {
+            std::mutex lock;
+            std::vector<Group> groups;
+            std::map<std::string, size_t> group_index;
+            std::vector<Member> members;
+            std::map<std::string, size_t> member_index;
+            uint64_t updates = 0; // severity changes applied
+
+            // Index of the named group, created along with its ancestors if needed (lock held)
+            size_t group(const std::string &name);
+            // Move a member to a new level and repost the affected summaries (lock held)
+            void set_level(size_t member, uint8_t level);
+            void post(Group &group);
+        };
+
+        pvxs::client::Context context_;
+        int priority_ = 0;
+        std::shared_ptr<State> state_ = std::make_shared<State>();
+        std::vector<std::shared_ptr<pvxs::client::Subscription>> subscriptions_; // by member index, empty when stopped
+
+        std::shared_ptr<pvxs::client::Subscription> subscribe(size_t member);
+
+    public:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        AlarmSummaryWrapper(const pvxs::client::Context &ctx, int priority) : context_(ctx), priority_(priority) {}
+        ~AlarmSummaryWrapper();
+
+        // Track a PV as part of a group. Subscribed at once if the engine is running
+        void add_pv(const std::string &pv_name, const std::string &group);
+
+        // Serve each group's summary as "<prefix><group>"
+        void publish(ServerWrapper &server, const std::string &prefix);
+
+        void start();
+        void stop();
+        bool is_running() const { return !subscriptions_.empty(); }
+
+        std::vector<std::string> groups() const;
+        bool group_stats(const std::string &group, GroupStats &stats) const;
+        uint64_t updates() const;
+    };
+
+    // Alarm summary functions for Rust FFI
+    std::unique_ptr<AlarmSummaryWrapper> context_alarm_summary_create(ContextWrapper &ctx);
+    void alarm_summary_add_pv(AlarmSummaryWrapper &summary, rust::Str pv_name, rust::Str group);
+    void alarm_summary_publish(AlarmSummaryWrapper &summary, ServerWrapper &server, rust::Str prefix);
+    void alarm_summary_start(AlarmSummaryWrapper &summary);
+    void alarm_summary_stop(AlarmSummaryWrapper &summary);
+    bool alarm_summary_is_running(const AlarmSummaryWrapper &summary);
+    rust::Vec<rust::String> alarm_summary_groups(const AlarmSummaryWrapper &summary);
+    bool alarm_summary_group_stats(const AlarmSummaryWrapper &summary, rust::Str group, uint64_t &total, uint64_t &no_alarm,
+                                   uint64_t &minor, uint64_t &major, uint64_t &invalid, uint64_t &disconnected,
+                                   uint8_t &max_severity);
+    uint64_t alarm_summary_updates(const AlarmSummaryWrapper &summary);
+
+    class RecordFile;
+
+    /// Records each update of an array PV to a file: a fixed header, then the raw element bytes
+    /// taken straight from the received array. Updates are queued by reference and written in
+    /// batches by a dedicated thread, so the subscription callback never waits on the disk and
+    /// the elements are never copied on the way.
+    class ArrayRecorderWrapper
+    {
+    public:
+        struct Config
+        {
+            uint64_t capacity = 0;    // preallocated file size in bytes, 0 to append without limit
+            bool ring = false;        // when full, wrap to the start of the file instead of dropping
+            size_t max_queued = 1024; // updates waiting for the writer before new ones are dropped
+            bool drop_cache = false;  // evict written pages from the page cache (POSIX only)
+        };
+
+        // Written before the elements of each update, in host byte order. The elements are
+        // padded to 8 bytes so every header and element stays aligned in the file
+        struct RecordHeader
+        {
+            uint32_t magic;        // RecordMagic
+            uint8_t version;       // RecordVersion
+            uint8_t type;          // pvxs::ArrayType of the elements, 0 for a marker
+            uint16_t element_size; // bytes
+            uint64_t sequence;     // update number from 0, gaps are dropped updates
+            int64_t seconds;       // timeStamp of the update
+            uint32_t nanoseconds;
+            uint32_t marker;       // MarkerWrap or MarkerEnd for a marker, 0 for a record
+            uint64_t count;        // elements following the header, for an end marker the offset of the oldest record
+        };
+        static constexpr uint32_t RecordMagic = 0x52415650; // "PVAR"
+        static constexpr uint8_t RecordVersion = 1;
+        // A ring has a wrap marker where a lap stopped short of the capacity, and an end marker
+        // after the newest record. The end marker gives the offset of the oldest record of the
+        // previous lap still intact after it, or 0 when there is none
+        static constexpr uint32_t MarkerWrap = 1;
+        static constexpr uint32_t MarkerEnd = 2;
+
+        struct Stats
+        {
+            uint64_t recorded = 0;
+            uint64_t dropped = 0; // queue or file full
+            uint64_t failed = 0;  // not a numeric array, or a write error
+            uint64_t bytes = 0;   // written, headers and padding included
+            uint64_t batches = 0; // writes issued by the writer thread
+        };
+
+    private:
+        struct Entry
+        {
+            RecordHeader header;
+            pvxs::shared_array<const void> elements; // keeps the received buffer alive until written
+        };
+
+        // Shared with the subscription callback and the writer thread
+        struct State
+        {
+            Config config;
+            std::shared_ptr<RecordFile> file;
+            std::mutex lock;
+            std::condition_variable wake;
+            std::deque<Entry> queue;
+            bool stopping = false;
+            uint64_t sequence = 0;
+            uint64_t offset = 0;  // next write position, writer thread only
+            uint64_t oldest = 0;  // first intact record of the previous lap of a ring, writer thread only
+            uint64_t lap_end = 0; // where the previous lap stopped, oldest == lap_end once none is left
+            std::atomic<uint64_t> recorded{0};
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<uint64_t> failed{0};
+            std::atomic<uint64_t> bytes{0};
+            std::atomic<uint64_t> batches{0};
+
+            // Queue one update, from the subscription callback
+            void enqueue(const pvxs::Value &update);
+            // Write queued updates until stopping and the queue is empty
+            void run();
+            // Write one batch, positioning each record in the file
+            void write(std::vector<Entry> &batch);
+            // Skip the records of the previous lap which writing up to end overwrites
+            void expire(uint64_t end);
+        };
+
+        pvxs::client::Context context_;
+        int priority_ = 0;
+        std::string pv_name_;
+        std::string path_;
+        Config config_;
+        std::shared_ptr<State> state_; // of the current or last run
+        std::shared_ptr<pvxs::client::Subscription> subscription_;
+        std::thread writer_;
+
+    public:
+        ArrayRecorderWrapper(const pvxs::client::Context &ctx, int priority, const std::string &pv_name,
+                             const std::string &path);
+        ~ArrayRecorderWrapper();
+
+        // Replace the configuration, only while stopped
+        void configure(const Config &config);
+
+        // Create (or truncate) the file, start the writer and subscribe. Stats restart from 0
+        void start();
+        // Unsubscribe, write what is queued and close the file
+        void stop();
+        bool is_running() const { return subscription_ != nullptr; }
+
+        Stats stats() const;
+        const std::string &pv_name() const { return pv_name_; }
+    };
+
+    // Array recorder functions for Rust FFI
+    std::unique_ptr<ArrayRecorderWrapper> context_array_recorder_create(ContextWrapper &ctx, rust::Str pv_name, rust::Str path,
+                                                                        uint64_t capacity, bool ring, uint64_t max_queued,
+                                                                        bool drop_cache);
+    void array_recorder_start(ArrayRecorderWrapper &recorder);
+    void array_recorder_stop(ArrayRecorderWrapper &recorder);
+    bool array_recorder_is_running(const ArrayRecorderWrapper &recorder);
+    void array_recorder_stats(const ArrayRecorderWrapper &recorder, uint64_t &recorded, uint64_t &dropped, uint64_t &failed,
+                              uint64_t &bytes, uint64_t &batches);
+
+    // ============================================================================
+    // Histogram: bin counts of a PV's values, updated in place per update
+    // ============================================================================
+
+    /// Subscribes to a PV and serves a histogram of its values through a SharedPV. A scalar update
+    /// adds one sample, an array update adds each of its elements. Counts are adjusted per update,
+    /// never recomputed. With a window, only recent samples are counted: the window is cut into
+    /// slices, and a slice's counts are subtracted once it falls out of the window.
+    class HistogramWrapper
+    {
+    public:
+        struct Config
+        {
+            size_t bins = 100;
+            double low = 0.0;    // lower edge of the first bin
+            double high = 1.0;   // upper edge of the last bin
+            double window = 0.0; // seconds of samples counted, 0 for everything since start
+            size_t slices = 1;   // steps the window moves by; 1 resets it whole
+        };
+
+        struct Stats
+        {
+            uint64_t updates = 0;   // binned
+            uint64_t samples = 0;   // binned, out of range ones included
+            uint64_t failed = 0;    // updates without a numeric value
+            uint64_t expired = 0;   // slices which fell out of the window
+            uint64_t underflow = 0; // samples below low in the window (NaN included)
+            uint64_t overflow = 0;  // samples at or above high in the window
+        };
+
+    private:
+        // Shared with the subscription callback
+        struct State
+        {
+            std::mutex lock;
+            Config config;
+            double scale = 0.0; // bins per unit
+            std::chrono::steady_clock::duration slice_length{};
+            std::chrono::steady_clock::time_point slice_end;
+            // bins + 2 counters each, the one below low first and the one at or above high last
+            std::vector<uint64_t> counts; // whole window
+            std::vector<uint64_t> slices; // per slice, one after the other
+            size_t slice = 0;             // the one being filled
+            std::vector<int32_t> indices; // scratch for array updates
+            std::vector<uint64_t> lanes;  // scratch, four sets of counters
+            std::unique_ptr<SharedPVWrapper> pv = SharedPVWrapper::create_readonly();
+            Stats stats;
+
+            // Apply a configuration and zero every count (lock held)
+            void reset(const Config &config);
+            // Drop the slices which ended by now from the window (lock held)
+            void advance(std::chrono::steady_clock::time_point now);
+            // Bin the value of one update and post the histogram
+            void add(const pvxs::Value &update);
+            template <typename T>
+            void bin(const T *data, size_t count);
+            void post();
+        };
+
+        pvxs::client::Context context_;
+        int priority_ = 0;
+        std::string pv_name_;
+        std::shared_ptr<State> state_ = std::make_shared<State>();
+        std::shared_ptr<pvxs::client::Subscription> subscription_;
+
+    public:
+        HistogramWrapper(const pvxs::client::Context &ctx, int priority, const std::string &pv_name);
+        ~HistogramWrapper();
+
+        // Replace the configuration and zero the counts, only while stopped
+        void configure(const Config &config);
+
+        // Serve the histogram as name
+        void publish(ServerWrapper &server, const std::string &name);
+
+        // Zero the counts and subscribe. Stats restart from 0
+        void start();
+        void stop();
+        bool is_running() const { return subscription_ != nullptr; }
+
+        // Counts of the bins in the window, out of range samples excluded
+        std::vector<uint64_t> counts() const;
+        Stats stats() const;
+    };
+
+    // Histogram functions for Rust FFI
+    std::unique_ptr<HistogramWrapper> context_histogram_create(ContextWrapper &ctx, rust::Str pv_name, uint64_t bins,
+                                                               double low, double high, double window, uint64_t slices);
+    void histogram_publish(HistogramWrapper &histogram, ServerWrapper &server, rust::Str name);
+    void histogram_start(HistogramWrapper &histogram);
+    void histogram_stop(HistogramWrapper &histogram);
+    bool histogram_is_running(const HistogramWrapper &histogram);
+    rust::Vec<uint64_t> histogram_counts(const HistogramWrapper &histogram);
+    void histogram_stats(const HistogramWrapper &histogram, uint64_t &updates, uint64_t &samples, uint64_t &failed,
+                         uint64_t &expired, uint64_t &underflow, uint64_t &overflow);
+
     // ============================================================================
     // Server factory functions for Rust FFI
     // ============================================================================
@@ -502,6 +2060,7 @@ namespace pvxs_wrapper
     // Server creation
     std::unique_ptr<ServerWrapper> server_create_from_env();
     std::unique_ptr<ServerWrapper> server_create_isolated();
+    std::unique_ptr<ContextWrapper> server_create_client_context(const ServerWrapper &server);
 
     // Server operations
     void server_start(ServerWrapper &server);
@@ -512,6 +2071,15 @@ namespace pvxs_wrapper
     uint16_t server_get_tcp_port(const ServerWrapper &server);
     uint16_t server_get_udp_port(const ServerWrapper &server);
 
+    // Per-client send limits
+    void server_enable_send_limits(ServerWrapper &server, uint64_t max_queued_per_client, uint64_t alert_queued_per_client,
+                                   uintptr_t alert_callback);
+    void server_disable_send_limits(ServerWrapper &server);
+    rust::Vec<rust::String> server_send_clients(const ServerWrapper &server);
+    bool server_client_send_stats(const ServerWrapper &server, rust::Str peer, uint64_t &subscriptions, uint64_t &queued,
+                                  uint64_t &max_queued, uint64_t &squashed, uint64_t &alerts, bool &slow);
+    uint64_t server_send_alert_count(const ServerWrapper &server);
+
     // SharedPV creation and operations
     std::unique_ptr<SharedPVWrapper> shared_pv_create_mailbox();
     std::unique_ptr<SharedPVWrapper> shared_pv_create_readonly();
@@ -569,6 +2137,9 @@ namespace pvxs_wrapper
         NTScalarAlarm alarm;
         NTScalarTime time_stamp;
     };
+
+    // NTScalar with a value of type code, its optional fields chosen and filled in from metadata
+    pvxs::Value create_nt_scalar(pvxs::TypeCode code, const NTScalarMetadata &metadata);
     
     // Builder functions for metadata construction from Rust
     std::unique_ptr<NTScalarAlarm> create_alarm(int32_t severity, int32_t status, rust::String message);
@@ -599,6 +2170,24 @@ namespace pvxs_wrapper
     void shared_pv_open_string(SharedPVWrapper& pv, rust::String initial_value, const NTScalarMetadata& metadata);
     void shared_pv_open_string_array(SharedPVWrapper& pv, rust::Vec<rust::String> initial_value, const NTScalarMetadata& metadata);
     void shared_pv_open_enum(SharedPVWrapper &pv, rust::Vec<rust::String> enum_choices, int16_t selected_choice, const NTEnumMetadata& metadata);
+    void shared_pv_open_int8(SharedPVWrapper &pv, int8_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_int8_array(SharedPVWrapper &pv, rust::Slice<const int8_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint8(SharedPVWrapper &pv, uint8_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint8_array(SharedPVWrapper &pv, rust::Slice<const uint8_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_int16(SharedPVWrapper &pv, int16_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_int16_array(SharedPVWrapper &pv, rust::Slice<const int16_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint16(SharedPVWrapper &pv, uint16_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint16_array(SharedPVWrapper &pv, rust::Slice<const uint16_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint32(SharedPVWrapper &pv, uint32_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint32_array(SharedPVWrapper &pv, rust::Slice<const uint32_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_int64(SharedPVWrapper &pv, int64_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_int64_array(SharedPVWrapper &pv, rust::Slice<const int64_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint64(SharedPVWrapper &pv, uint64_t initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_uint64_array(SharedPVWrapper &pv, rust::Slice<const uint64_t> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_float32(SharedPVWrapper &pv, float initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_float32_array(SharedPVWrapper &pv, rust::Slice<const float> initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_bool(SharedPVWrapper &pv, bool initial_value, const NTScalarMetadata& metadata);
+    void shared_pv_open_bool_array(SharedPVWrapper &pv, rust::Slice<const bool> initial_value, const NTScalarMetadata& metadata);
     bool shared_pv_is_open(const SharedPVWrapper &pv);
     void shared_pv_close(SharedPVWrapper &pv);
     void shared_pv_post_double(SharedPVWrapper &pv, double value);
@@ -608,7 +2197,83 @@ namespace pvxs_wrapper
     void shared_pv_post_double_array(SharedPVWrapper &pv, rust::Vec<double> value);
     void shared_pv_post_int32_array(SharedPVWrapper &pv, rust::Vec<int32_t> value);
     void shared_pv_post_string_array(SharedPVWrapper &pv, rust::Vec<rust::String> value);
+    void shared_pv_post_int8(SharedPVWrapper &pv, int8_t value);
+    void shared_pv_post_int8_array(SharedPVWrapper &pv, rust::Slice<const int8_t> value);
+    void shared_pv_post_uint8(SharedPVWrapper &pv, uint8_t value);
+    void shared_pv_post_uint8_array(SharedPVWrapper &pv, rust::Slice<const uint8_t> value);
+    void shared_pv_post_int16(SharedPVWrapper &pv, int16_t value);
+    void shared_pv_post_int16_array(SharedPVWrapper &pv, rust::Slice<const int16_t> value);
+    void shared_pv_post_uint16(SharedPVWrapper &pv, uint16_t value);
+    void shared_pv_post_uint16_array(SharedPVWrapper &pv, rust::Slice<const uint16_t> value);
+    void shared_pv_post_uint32(SharedPVWrapper &pv, uint32_t value);
+    void shared_pv_post_uint32_array(SharedPVWrapper &pv, rust::Slice<const uint32_t> value);
+    void shared_pv_post_int64(SharedPVWrapper &pv, int64_t value);
+    void shared_pv_post_int64_array(SharedPVWrapper &pv, rust::Slice<const int64_t> value);
+    void shared_pv_post_uint64(SharedPVWrapper &pv, uint64_t value);
+    void shared_pv_post_uint64_array(SharedPVWrapper &pv, rust::Slice<const uint64_t> value);
+    void shared_pv_post_float32(SharedPVWrapper &pv, float value);
+    void shared_pv_post_float32_array(SharedPVWrapper &pv, rust::Slice<const float> value);
+    void shared_pv_post_bool(SharedPVWrapper &pv, bool value);
+    void shared_pv_post_bool_array(SharedPVWrapper &pv, rust::Slice<const bool> value);
     std::unique_ptr<ValueWrapper> shared_pv_fetch(const SharedPVWrapper &pv);
+    void shared_pv_set_computed_double(SharedPVWrapper &pv, uintptr_t compute, double ttl);
+    void shared_pv_set_computed_int32(SharedPVWrapper &pv, uintptr_t compute, double ttl);
+    void shared_pv_invalidate_computed(SharedPVWrapper &pv);
+    bool shared_pv_computed_stats(const SharedPVWrapper &pv, uint64_t &evaluations, uint64_t &cache_hits, uint64_t &failed);
+
+    // Group PV creation and operations
+    std::unique_ptr<GroupPVWrapper> group_pv_create();
+    void group_pv_add_member(GroupPVWrapper &group, rust::Str name, rust::Str type);
+    void group_pv_set_double(GroupPVWrapper &group, rust::Str member, double value);
+    void group_pv_set_int32(GroupPVWrapper &group, rust::Str member, int32_t value);
+    void group_pv_set_string(GroupPVWrapper &group, rust::Str member, rust::String value);
+    void group_pv_set_double_array(GroupPVWrapper &group, rust::Str member, rust::Vec<double> value);
+    void group_pv_set_int32_array(GroupPVWrapper &group, rust::Str member, rust::Vec<int32_t> value);
+    void group_pv_set_string_array(GroupPVWrapper &group, rust::Str member, rust::Vec<rust::String> value);
+    void group_pv_set_alarm(GroupPVWrapper &group, rust::Str member, int32_t severity, int32_t status, rust::String message);
+    void group_pv_open(GroupPVWrapper &group);
+    bool group_pv_post(GroupPVWrapper &group);
+    std::unique_ptr<ValueWrapper> group_pv_fetch(const GroupPVWrapper &group);
+    void server_add_group_pv(ServerWrapper &server, rust::String name, GroupPVWrapper &group);
+
+    // Memory-mapped array PV creation and operations
+    std::unique_ptr<MappedArrayPVWrapper> mapped_array_pv_create();
+    void mapped_array_pv_open(MappedArrayPVWrapper &pv, rust::Str path, rust::Str element_type, uint64_t offset,
+                              uint64_t count, const NTScalarMetadata &metadata);
+    void mapped_array_pv_post(MappedArrayPVWrapper &pv);
+    uint64_t mapped_array_pv_len(const MappedArrayPVWrapper &pv);
+    std::unique_ptr<ValueWrapper> mapped_array_pv_fetch(const MappedArrayPVWrapper &pv);
+    void server_add_mapped_array_pv(ServerWrapper &server, rust::String name, MappedArrayPVWrapper &pv);
+
+    // Post stager creation and operations
+    std::unique_ptr<PostStagerWrapper> post_stager_create(double interval);
+    uint64_t post_stager_add(PostStagerWrapper &stager, const SharedPVWrapper &pv);
+    void post_stager_stage_double(const PostStagerWrapper &stager, uint64_t slot, double value);
+    void post_stager_stage_int32(const PostStagerWrapper &stager, uint64_t slot, int32_t value);
+    void post_stager_start(PostStagerWrapper &stager);
+    void post_stager_stop(PostStagerWrapper &stager);
+    bool post_stager_is_running(const PostStagerWrapper &stager);
+    void post_stager_stats(const PostStagerWrapper &stager, uint64_t &staged, uint64_t &coalesced, uint64_t &posted,
+                           uint64_t &failed, uint64_t &flushes, double &last_latency, double &max_latency,
+                           double &mean_latency);
+
+    // Autosave creation and operations
+    std::unique_ptr<AutosaveWrapper> autosave_create(rust::Str path, double interval);
+    void autosave_add(AutosaveWrapper &autosave, rust::Str name, const SharedPVWrapper &pv);
+    uint64_t autosave_restore(AutosaveWrapper &autosave);
+    bool autosave_save(AutosaveWrapper &autosave);
+    void autosave_start(AutosaveWrapper &autosave);
+    void autosave_stop(AutosaveWrapper &autosave);
+    bool autosave_is_running(const AutosaveWrapper &autosave);
+    void autosave_stats(const AutosaveWrapper &autosave, uint64_t &saves, uint64_t &failed, uint64_t &generation,
+                        uint64_t &bytes, double &last_duration);
+
+    // Snapshot save and warm start
+    uint64_t server_save_snapshot(const ServerWrapper &server, rust::Str path);
+    std::unique_ptr<PVSnapshotWrapper> server_load_snapshot(ServerWrapper &server, rust::Str path);
+    uint64_t pv_snapshot_len(const PVSnapshotWrapper &snapshot);
+    rust::String pv_snapshot_name(const PVSnapshotWrapper &snapshot, uint64_t index);
+    std::unique_ptr<SharedPVWrapper> pv_snapshot_take(PVSnapshotWrapper &snapshot, uint64_t index);
 
     // StaticSource creation and operations
     std::unique_ptr<StaticSourceWrapper> static_source_create();
@@ -616,6 +2281,31 @@ namespace pvxs_wrapper
     void static_source_remove_pv(StaticSourceWrapper &source, rust::String name);
     void static_source_close_all(StaticSourceWrapper &source);
 
+    // ============================================================================
+    // Timeline tracing functions for Rust FFI
+    // ============================================================================
+
+    void trace_enable(uint64_t events_per_thread);
+    void trace_disable();
+    bool trace_is_enabled();
+    void trace_clear();
+    uint64_t trace_dropped();
+    rust::String trace_to_json();
+    void trace_begin(rust::Str name);
+    void trace_end(rust::Str name);
+    void trace_instant(rust::Str name);
+
+    // ============================================================================
+    // Diagnostics functions for Rust FFI
+    // ============================================================================
+
+    // Live object counts kept by pvxs, by type name
+    void diagnostics_instance_counts(rust::Vec<rust::String> &names, rust::Vec<uint64_t> &counts);
+    // Resident set size in bytes, 0 where unsupported
+    uint64_t diagnostics_resident_memory();
+    // Heap usage from the C allocator, returns false where unsupported
+    bool diagnostics_allocator_stats(uint64_t &in_use, uint64_t &free_bytes, uint64_t &mapped);
+
     // ============================================================================
     // Note: RPC Source implementation - to be added later when needed
 
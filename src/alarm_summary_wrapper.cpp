@@ -0,0 +1,302 @@
+// alarm_summary_wrapper.cpp - Incremental per-group alarm counts published as SharedPVs
+
+#include "wrapper.h"
+#include <algorithm>
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    const char *const level_names[AlarmSummaryWrapper::Levels] = {"noAlarm", "minor", "major", "invalid", "disconnected"};
+
+    pvxs::Value summary_prototype() {
+        using pvxs::Member;
+        using pvxs::TypeCode;
+        auto def = pvxs::nt::NTScalar{TypeCode::Int32}.build();
+        def += {
+            Member(TypeCode::UInt64, "total"),
+            Member(TypeCode::UInt64, "noAlarm"),
+            Member(TypeCode::UInt64, "minor"),
+            Member(TypeCode::UInt64, "major"),
+            Member(TypeCode::UInt64, "invalid"),
+            Member(TypeCode::UInt64, "disconnected"),
+        };
+        return def.create();
+    }
+
+    void fill_summary(pvxs::Value &value, const AlarmSummaryWrapper::GroupStats &stats) {
+        value["value"] = static_cast<int32_t>(stats.max_severity);
+        value["alarm.severity"] = static_cast<int32_t>(stats.max_severity);
+        value["alarm.status"] = 0;
+        value["total"] = stats.total;
+        for (size_t i = 0; i < AlarmSummaryWrapper::Levels; i++) {
+            value[level_names[i]] = stats.counts[i];
+        }
+        auto now = std::chrono::system_clock::now().time_since_epoch();
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+        value["timeStamp.secondsPastEpoch"] = static_cast<int64_t>(seconds.count());
+        value["timeStamp.nanoseconds"] = static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count());
+    }
+
+    uint8_t worst(const AlarmSummaryWrapper::GroupStats &stats) {
+        if (stats.counts[AlarmSummaryWrapper::Disconnected] || stats.counts[AlarmSummaryWrapper::Invalid]) {
+            return AlarmSummaryWrapper::Invalid;
+        }
+        if (stats.counts[AlarmSummaryWrapper::Major]) {
+            return AlarmSummaryWrapper::Major;
+        }
+        return stats.counts[AlarmSummaryWrapper::Minor] ? AlarmSummaryWrapper::Minor : AlarmSummaryWrapper::NoAlarm;
+    }
+
+} // namespace
+
+// ============================================================================
+// AlarmSummaryWrapper implementation
+// ============================================================================
+
+size_t AlarmSummaryWrapper::State::group(const std::string& name) {
+    auto it = group_index.find(name);
+    if (it != group_index.end()) {
+        return it->second;
+    }
+    auto sep = name.rfind(':');
+    size_t parent = (sep == std::string::npos || sep == 0) ? npos : group(name.substr(0, sep));
+
+    Group g;
+    g.name = name;
+    g.parent = parent;
+    g.pv = SharedPVWrapper::create_readonly();
+    g.pv->hub()->set_name(name);
+    auto initial = summary_prototype();
+    fill_summary(initial, g.stats);
+    g.pv->open(ValueWrapper(std::move(initial)));
+
+    groups.push_back(std::move(g));
+    group_index[name] = groups.size() - 1;
+    return groups.size() - 1;
+}
+
+void AlarmSummaryWrapper::State::set_level(size_t member, uint8_t level) {
+    auto& m = members[member];
+    if (m.level == level) {
+        return;
+    }
+    for (size_t g = m.group; g != npos; g = groups[g].parent) {
+        auto& stats = groups[g].stats;
+        stats.counts[m.level]--;
+        stats.counts[level]++;
+        stats.max_severity = worst(stats);
+        post(groups[g]);
+    }
+    m.level = level;
+    updates++;
+}
+
+void AlarmSummaryWrapper::State::post(Group& group) {
+    auto update = group.pv->get_template().cloneEmpty();
+    fill_summary(update, group.stats);
+    group.pv->post_value(ValueWrapper(std::move(update)));
+}
+
+AlarmSummaryWrapper::~AlarmSummaryWrapper() {
+    stop();
+}
+
+std::shared_ptr<pvxs::client::Subscription> AlarmSummaryWrapper::subscribe(size_t member) {
+    auto state = state_;
+    std::string pv_name;
+    {
+        std::lock_guard<std::mutex> guard(state->lock);
+        pv_name = state->members[member].pv_name;
+    }
+    // Only the severity is requested, so updates do not carry values the summary never reads
+    return context_.monitor(pv_name)
+        .field("alarm.severity")
+        .priority(priority_)
+        .maskConnected(true)
+        .maskDisconnected(false)
+        .event([state, member](pvxs::client::Subscription& sub) {
+            while (true) {
+                uint8_t level;
+                try {
+                    auto update = sub.pop();
+                    if (!update) {
+                        break;
+                    }
+                    // Updates of other fields may still arrive, with nothing marked
+                    auto severity = update["alarm.severity"];
+                    if (!severity || !severity.isMarked()) {
+                        continue;
+                    }
+                    level = static_cast<uint8_t>(std::min<int32_t>(std::max<int32_t>(severity.as<int32_t>(), 0), Invalid));
+                } catch (const pvxs::client::Finished&) {
+                    // Derives from Disconnect, so caught first
+                    break;
+                } catch (const pvxs::client::Disconnect&) {
+                    level = Disconnected;
+                } catch (const std::exception&) {
+                    level = Disconnected;
+                }
+                std::lock_guard<std::mutex> guard(state->lock);
+                state->set_level(member, level);
+            }
+        })
+        .exec();
+}
+
+void AlarmSummaryWrapper::add_pv(const std::string& pv_name, const std::string& group) {
+    if (group.empty() || group.front() == ':' || group.back() == ':') {
+        throw PvxsError("Invalid alarm summary group '" + group + "'");
+    }
+    size_t member;
+    try {
+        std::lock_guard<std::mutex> guard(state_->lock);
+        if (state_->member_index.count(pv_name)) {
+            throw PvxsError("'" + pv_name + "' is already part of the alarm summary");
+        }
+        Member m;
+        m.pv_name = pv_name;
+        m.group = state_->group(group);
+        member = state_->members.size();
+        state_->members.push_back(std::move(m));
+        state_->member_index[pv_name] = member;
+
+        for (size_t g = state_->members[member].group; g != npos; g = state_->groups[g].parent) {
+            auto& stats = state_->groups[g].stats;
+            stats.total++;
+            stats.counts[Disconnected]++;
+            stats.max_severity = worst(stats);
+            state_->post(state_->groups[g]);
+        }
+    } catch (const PvxsError&) {
+        throw;
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error adding '") + pv_name + "' to alarm summary: " + e.what());
+    }
+    if (is_running()) {
+        subscriptions_.push_back(subscribe(member));
+    }
+}
+
+void AlarmSummaryWrapper::publish(ServerWrapper& server, const std::string& prefix) {
+    std::lock_guard<std::mutex> guard(state_->lock);
+    for (auto& g : state_->groups) {
+        server.add_pv(prefix + g.name, *g.pv);
+    }
+}
+
+void AlarmSummaryWrapper::start() {
+    if (is_running()) {
+        return;
+    }
+    size_t count;
+    {
+        std::lock_guard<std::mutex> guard(state_->lock);
+        count = state_->members.size();
+    }
+    if (count == 0) {
+        throw PvxsError("Alarm summary has no PVs to monitor");
+    }
+    try {
+        subscriptions_.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            subscriptions_.push_back(subscribe(i));
+        }
+    } catch (const std::exception& e) {
+        stop();
+        throw PvxsError(std::string("Error starting alarm summary: ") + e.what());
+    }
+}
+
+void AlarmSummaryWrapper::stop() {
+    subscriptions_.clear();
+    // Without a subscription nothing is known about the PVs any more
+    std::lock_guard<std::mutex> guard(state_->lock);
+    for (size_t i = 0; i < state_->members.size(); i++) {
+        state_->set_level(i, Disconnected);
+    }
+}
+
+std::vector<std::string> AlarmSummaryWrapper::groups() const {
+    std::lock_guard<std::mutex> guard(state_->lock);
+    std::vector<std::string> names;
+    names.reserve(state_->groups.size());
+    for (const auto& g : state_->groups) {
+        names.push_back(g.name);
+    }
+    return names;
+}
+
+bool AlarmSummaryWrapper::group_stats(const std::string& group, GroupStats& stats) const {
+    std::lock_guard<std::mutex> guard(state_->lock);
+    auto it = state_->group_index.find(group);
+    if (it == state_->group_index.end()) {
+        return false;
+    }
+    stats = state_->groups[it->second].stats;
+    return true;
+}
+
+uint64_t AlarmSummaryWrapper::updates() const {
+    std::lock_guard<std::mutex> guard(state_->lock);
+    return state_->updates;
+}
+
+// ============================================================================
+// Bridge functions for alarm summaries
+// ============================================================================
+
+std::unique_ptr<AlarmSummaryWrapper> context_alarm_summary_create(ContextWrapper& ctx) {
+    return ctx.alarm_summary_create();
+}
+
+void alarm_summary_add_pv(AlarmSummaryWrapper& summary, rust::Str pv_name, rust::Str group) {
+    summary.add_pv(std::string(pv_name), std::string(group));
+}
+
+void alarm_summary_publish(AlarmSummaryWrapper& summary, ServerWrapper& server, rust::Str prefix) {
+    summary.publish(server, std::string(prefix));
+}
+
+void alarm_summary_start(AlarmSummaryWrapper& summary) {
+    summary.start();
+}
+
+void alarm_summary_stop(AlarmSummaryWrapper& summary) {
+    summary.stop();
+}
+
+bool alarm_summary_is_running(const AlarmSummaryWrapper& summary) {
+    return summary.is_running();
+}
+
+rust::Vec<rust::String> alarm_summary_groups(const AlarmSummaryWrapper& summary) {
+    rust::Vec<rust::String> names;
+    for (const auto& name : summary.groups()) {
+        names.push_back(rust::String(name));
+    }
+    return names;
+}
+
+bool alarm_summary_group_stats(const AlarmSummaryWrapper& summary, rust::Str group, uint64_t& total, uint64_t& no_alarm,
+                               uint64_t& minor, uint64_t& major, uint64_t& invalid, uint64_t& disconnected,
+                               uint8_t& max_severity) {
+    AlarmSummaryWrapper::GroupStats stats;
+    if (!summary.group_stats(std::string(group), stats)) {
+        return false;
+    }
+    total = stats.total;
+    no_alarm = stats.counts[AlarmSummaryWrapper::NoAlarm];
+    minor = stats.counts[AlarmSummaryWrapper::Minor];
+    major = stats.counts[AlarmSummaryWrapper::Major];
+    invalid = stats.counts[AlarmSummaryWrapper::Invalid];
+    disconnected = stats.counts[AlarmSummaryWrapper::Disconnected];
+    max_severity = stats.max_severity;
+    return true;
+}
+
+uint64_t alarm_summary_updates(const AlarmSummaryWrapper& summary) {
+    return summary.updates();
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,526 @@
+// array_recorder_wrapper.cpp - Array PV updates written straight from the received buffers to a file
+
+#include "wrapper.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace pvxs_wrapper {
+
+// ============================================================================
+// RecordFile implementation
+// ============================================================================
+
+/// Output file of an array recorder, written by a single thread
+class RecordFile
+{
+public:
+    struct Segment
+    {
+        const void *data;
+        size_t size;
+    };
+
+private:
+    std::string path_;
+#if defined(_WIN32)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+#else
+    int fd_ = -1;
+#endif
+
+public:
+    // Create or truncate the file, and preallocate capacity bytes unless 0
+    RecordFile(const std::string &path, uint64_t capacity);
+    ~RecordFile();
+    RecordFile(const RecordFile &) = delete;
+    RecordFile &operator=(const RecordFile &) = delete;
+
+    // Write the segments back to back from offset, with as few system calls as possible
+    void write(uint64_t offset, std::vector<Segment> &segments);
+    // Read size bytes back from offset
+    void read(uint64_t offset, void *data, size_t size);
+    // Flush a written range and evict it from the page cache, where supported
+    void drop_cache(uint64_t offset, uint64_t length);
+};
+
+#if defined(_WIN32)
+
+RecordFile::RecordFile(const std::string& path, uint64_t capacity) : path_(path) {
+    file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        throw PvxsError("Can't create '" + path + "' (error " + std::to_string(GetLastError()) + ")");
+    }
+    if (capacity) {
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(capacity);
+        if (!SetFilePointerEx(file_, size, nullptr, FILE_BEGIN) || !SetEndOfFile(file_)) {
+            auto error = GetLastError();
+            CloseHandle(file_);
+            throw PvxsError("Can't preallocate " + std::to_string(capacity) + " bytes for '" + path + "' (error " +
+                            std::to_string(error) + ")");
+        }
+    }
+}
+
+RecordFile::~RecordFile() {
+    CloseHandle(file_);
+}
+
+void RecordFile::write(uint64_t offset, std::vector<Segment>& segments) {
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(offset);
+    if (!SetFilePointerEx(file_, position, nullptr, FILE_BEGIN)) {
+        throw PvxsError("Can't seek in '" + path_ + "' (error " + std::to_string(GetLastError()) + ")");
+    }
+    for (const auto& segment : segments) {
+        auto data = static_cast<const char *>(segment.data);
+        size_t left = segment.size;
+        while (left) {
+            DWORD done = 0;
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(left, 1u << 30));
+            if (!WriteFile(file_, data, chunk, &done, nullptr)) {
+                throw PvxsError("Can't write to '" + path_ + "' (error " + std::to_string(GetLastError()) + ")");
+            }
+            data += done;
+            left -= done;
+        }
+    }
+}
+
+void RecordFile::read(uint64_t offset, void* data, size_t size) {
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(offset);
+    if (!SetFilePointerEx(file_, position, nullptr, FILE_BEGIN)) {
+        throw PvxsError("Can't seek in '" + path_ + "' (error " + std::to_string(GetLastError()) + ")");
+    }
+    DWORD done = 0;
+    if (!ReadFile(file_, data, static_cast<DWORD>(size), &done, nullptr)) {
+        throw PvxsError("Can't read from '" + path_ + "' (error " + std::to_string(GetLastError()) + ")");
+    }
+    if (done != size) {
+        throw PvxsError("Short read from '" + path_ + "'");
+    }
+}
+
+void RecordFile::drop_cache(uint64_t, uint64_t) {}
+
+#else
+
+RecordFile::RecordFile(const std::string& path, uint64_t capacity) : path_(path) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw PvxsError("Can't create '" + path + "': " + std::strerror(errno));
+    }
+    if (capacity) {
+        // Reserve the blocks up front so recording never waits on the filesystem allocating them
+        int error = 0;
+#if defined(__linux__)
+        error = posix_fallocate(fd_, 0, static_cast<off_t>(capacity));
+        if (error == EOPNOTSUPP || error == EINVAL) {
+            error = ftruncate(fd_, static_cast<off_t>(capacity)) == 0 ? 0 : errno;
+        }
+#else
+        error = ftruncate(fd_, static_cast<off_t>(capacity)) == 0 ? 0 : errno;
+#endif
+        if (error) {
+            ::close(fd_);
+            throw PvxsError("Can't preallocate " + std::to_string(capacity) + " bytes for '" + path + "': " +
+                            std::strerror(error));
+        }
+    }
+}
+
+RecordFile::~RecordFile() {
+    ::close(fd_);
+}
+
+void RecordFile::write(uint64_t offset, std::vector<Segment>& segments) {
+#ifndef IOV_MAX
+    const size_t iov_max = 1024;
+#else
+    const size_t iov_max = IOV_MAX;
+#endif
+    if (lseek(fd_, static_cast<off_t>(offset), SEEK_SET) < 0) {
+        throw PvxsError("Can't seek in '" + path_ + "': " + std::strerror(errno));
+    }
+    std::vector<iovec> iov(segments.size());
+    for (size_t i = 0; i < segments.size(); i++) {
+        iov[i].iov_base = const_cast<void *>(segments[i].data);
+        iov[i].iov_len = segments[i].size;
+    }
+    size_t first = 0;
+    while (first < iov.size()) {
+        auto done = ::writev(fd_, &iov[first], static_cast<int>(std::min(iov.size() - first, iov_max)));
+        if (done < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw PvxsError("Can't write to '" + path_ + "': " + std::strerror(errno));
+        }
+        // Skip what was written, resuming a partially written segment
+        auto left = static_cast<size_t>(done);
+        while (first < iov.size() && left >= iov[first].iov_len) {
+            left -= iov[first].iov_len;
+            first++;
+        }
+        if (left) {
+            iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + left;
+            iov[first].iov_len -= left;
+        }
+    }
+}
+
+void RecordFile::read(uint64_t offset, void* data, size_t size) {
+    auto into = static_cast<char *>(data);
+    while (size) {
+        auto done = ::pread(fd_, into, size, static_cast<off_t>(offset));
+        if (done < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw PvxsError("Can't read from '" + path_ + "': " + std::strerror(errno));
+        }
+        if (done == 0) {
+            throw PvxsError("Short read from '" + path_ + "'");
+        }
+        into += done;
+        offset += static_cast<uint64_t>(done);
+        size -= static_cast<size_t>(done);
+    }
+}
+
+void RecordFile::drop_cache(uint64_t offset, uint64_t length) {
+#if defined(POSIX_FADV_DONTNEED)
+    // Dirty pages can't be dropped, so write them out first
+    if (fdatasync(fd_) == 0) {
+        posix_fadvise(fd_, static_cast<off_t>(offset), static_cast<off_t>(length), POSIX_FADV_DONTNEED);
+    }
+#else
+    (void)offset;
+    (void)length;
+#endif
+}
+
+#endif
+
+// ============================================================================
+// ArrayRecorderWrapper implementation
+// ============================================================================
+
+namespace {
+
+    const uint8_t padding[8] = {};
+
+    uint64_t padded(uint64_t bytes) {
+        return (bytes + 7) & ~uint64_t(7);
+    }
+
+} // namespace
+
+void ArrayRecorderWrapper::State::enqueue(const pvxs::Value& update) {
+    auto field = update["value"];
+    if (!field || !field.isMarked()) {
+        return;
+    }
+    pvxs::shared_array<const void> elements;
+    try {
+        elements = field.as<pvxs::shared_array<const void>>();
+    } catch (const std::exception&) {
+        failed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    auto type = elements.original_type();
+    if (type == pvxs::ArrayType::Null || type == pvxs::ArrayType::String || type == pvxs::ArrayType::Value) {
+        failed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Entry entry;
+    std::memset(&entry.header, 0, sizeof(entry.header));
+    entry.header.magic = RecordMagic;
+    entry.header.version = RecordVersion;
+    entry.header.type = static_cast<uint8_t>(type);
+    entry.header.element_size = static_cast<uint16_t>(pvxs::elementSize(type));
+    entry.header.count = elements.size();
+    auto seconds = update["timeStamp.secondsPastEpoch"];
+    auto nanoseconds = update["timeStamp.nanoseconds"];
+    entry.header.seconds = seconds ? seconds.as<int64_t>() : 0;
+    entry.header.nanoseconds = nanoseconds ? nanoseconds.as<uint32_t>() : 0;
+    entry.elements = std::move(elements);
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        entry.header.sequence = sequence++;
+        if (queue.size() >= config.max_queued) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        queue.push_back(std::move(entry));
+    }
+    wake.notify_one();
+}
+
+void ArrayRecorderWrapper::State::run() {
+    std::vector<Entry> batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+            // Take everything queued so far as one batch
+            batch.assign(std::make_move_iterator(queue.begin()), std::make_move_iterator(queue.end()));
+            queue.clear();
+        }
+        write(batch);
+        // Release the received buffers
+        batch.clear();
+    }
+}
+
+void ArrayRecorderWrapper::State::expire(uint64_t end) {
+    // Walk the old headers before they are overwritten, so the end marker can point past them
+    while (oldest < lap_end && oldest < end) {
+        RecordHeader header;
+        try {
+            file->read(oldest, &header, sizeof(header));
+        } catch (const std::exception&) {
+            oldest = lap_end;
+            break;
+        }
+        if (header.magic != RecordMagic || header.type == 0) {
+            oldest = lap_end;
+            break;
+        }
+        oldest += sizeof(RecordHeader) + padded(header.count * header.element_size);
+    }
+    if (oldest > lap_end) {
+        oldest = lap_end;
+    }
+}
+
+void ArrayRecorderWrapper::State::write(std::vector<Entry>& batch) {
+    std::vector<RecordFile::Segment> segments;
+    segments.reserve(batch.size() * 3 + 1);
+    RecordHeader marker;
+    RecordHeader end_marker;
+    const RecordHeader* last = nullptr;
+    uint64_t start = offset; // of the records in segments
+    uint64_t records = 0;
+
+    // Write the records collected so far, which are contiguous in the file
+    auto flush = [&]() {
+        if (segments.empty()) {
+            return;
+        }
+        uint64_t length = offset - start;
+        try {
+            file->write(start, segments);
+            if (config.drop_cache) {
+                file->drop_cache(start, length);
+            }
+            recorded.fetch_add(records, std::memory_order_relaxed);
+            bytes.fetch_add(length, std::memory_order_relaxed);
+        } catch (const std::exception&) {
+            failed.fetch_add(records, std::memory_order_relaxed);
+        }
+        batches.fetch_add(1, std::memory_order_relaxed);
+        segments.clear();
+        records = 0;
+    };
+
+    for (auto& entry : batch) {
+        uint64_t data = entry.header.count * entry.header.element_size;
+        uint64_t size = sizeof(RecordHeader) + padded(data);
+        if (config.capacity && offset + size > config.capacity) {
+            if (!config.ring || size > config.capacity) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            // Mark the end of the newest data, and carry on from the start of the file
+            if (offset + sizeof(RecordHeader) <= config.capacity) {
+                marker = entry.header;
+                marker.type = 0;
+                marker.element_size = 0;
+                marker.marker = MarkerWrap;
+                marker.count = 0;
+                segments.push_back({&marker, sizeof(marker)});
+            }
+            flush();
+            // The lap just written becomes the previous one, whatever was left of the one before is lost
+            lap_end = offset;
+            oldest = 0;
+            offset = start = 0;
+        }
+        if (config.ring) {
+            expire(offset + size + sizeof(RecordHeader));
+        }
+        segments.push_back({&entry.header, sizeof(RecordHeader)});
+        if (data) {
+            segments.push_back({entry.elements.data(), static_cast<size_t>(data)});
+        }
+        if (padded(data) != data) {
+            segments.push_back({padding, static_cast<size_t>(padded(data) - data)});
+        }
+        offset += size;
+        records++;
+        last = &entry.header;
+    }
+    // Terminate the newest data of a ring, so a reader never runs into the records it overwrote.
+    // Like a wrap marker it isn't counted in the written bytes, and the next batch overwrites it
+    if (config.ring && last && offset + sizeof(RecordHeader) <= config.capacity) {
+        end_marker = *last;
+        end_marker.type = 0;
+        end_marker.element_size = 0;
+        end_marker.marker = MarkerEnd;
+        end_marker.count = oldest < lap_end ? oldest : 0;
+        segments.push_back({&end_marker, sizeof(end_marker)});
+    }
+    flush();
+}
+
+ArrayRecorderWrapper::ArrayRecorderWrapper(const pvxs::client::Context& ctx, int priority, const std::string& pv_name,
+                                           const std::string& path)
+    : context_(ctx), priority_(priority), pv_name_(pv_name), path_(path) {}
+
+ArrayRecorderWrapper::~ArrayRecorderWrapper() {
+    stop();
+}
+
+void ArrayRecorderWrapper::configure(const Config& config) {
+    if (is_running()) {
+        throw PvxsError("Array recorder for '" + pv_name_ + "' can't be changed while running");
+    }
+    if (config.max_queued == 0) {
+        throw PvxsError("Array recorder queue must hold at least one update");
+    }
+    if (config.ring && config.capacity == 0) {
+        throw PvxsError("Array recorder ring needs a capacity");
+    }
+    config_ = config;
+}
+
+void ArrayRecorderWrapper::start() {
+    if (is_running()) {
+        return;
+    }
+    // A fresh state per run, so a callback still draining from the last run can't touch this one
+    auto state = std::make_shared<State>();
+    state->config = config_;
+    try {
+        state->file = std::make_shared<RecordFile>(path_, config_.capacity);
+    } catch (const PvxsError&) {
+        throw;
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error creating array recording '") + path_ + "': " + e.what());
+    }
+    state_ = state;
+    writer_ = std::thread([state] { state->run(); });
+
+    try {
+        Tracer::instant("recorder", "subscribe", pv_name_);
+        subscription_ = context_.monitor(pv_name_)
+            .priority(priority_)
+            .maskConnected(true)
+            .maskDisconnected(true)
+            .event([state](pvxs::client::Subscription& sub) {
+                while (true) {
+                    try {
+                        auto update = sub.pop();
+                        if (!update) {
+                            break;
+                        }
+                        state->enqueue(update);
+                    } catch (const pvxs::client::Finished&) {
+                        break;
+                    } catch (const std::exception&) {
+                        // Remote errors carry no array to record
+                        state->failed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            })
+            .exec();
+    } catch (const std::exception& e) {
+        stop();
+        throw PvxsError(std::string("Error starting array recorder for '") + pv_name_ + "': " + e.what());
+    }
+}
+
+void ArrayRecorderWrapper::stop() {
+    subscription_.reset();
+    if (writer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(state_->lock);
+            state_->stopping = true;
+        }
+        state_->wake.notify_one();
+        writer_.join();
+        state_->file.reset();
+    }
+}
+
+ArrayRecorderWrapper::Stats ArrayRecorderWrapper::stats() const {
+    Stats stats;
+    if (state_) {
+        stats.recorded = state_->recorded.load(std::memory_order_relaxed);
+        stats.dropped = state_->dropped.load(std::memory_order_relaxed);
+        stats.failed = state_->failed.load(std::memory_order_relaxed);
+        stats.bytes = state_->bytes.load(std::memory_order_relaxed);
+        stats.batches = state_->batches.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+// ============================================================================
+// Bridge functions for array recorders
+// ============================================================================
+
+std::unique_ptr<ArrayRecorderWrapper> context_array_recorder_create(ContextWrapper& ctx, rust::Str pv_name, rust::Str path,
+                                                                    uint64_t capacity, bool ring, uint64_t max_queued,
+                                                                    bool drop_cache) {
+    auto recorder = ctx.array_recorder_create(std::string(pv_name), std::string(path));
+    ArrayRecorderWrapper::Config config;
+    config.capacity = capacity;
+    config.ring = ring;
+    config.max_queued = static_cast<size_t>(max_queued);
+    config.drop_cache = drop_cache;
+    recorder->configure(config);
+    return recorder;
+}
+
+void array_recorder_start(ArrayRecorderWrapper& recorder) {
+    recorder.start();
+}
+
+void array_recorder_stop(ArrayRecorderWrapper& recorder) {
+    recorder.stop();
+}
+
+bool array_recorder_is_running(const ArrayRecorderWrapper& recorder) {
+    return recorder.is_running();
+}
+
+void array_recorder_stats(const ArrayRecorderWrapper& recorder, uint64_t& recorded, uint64_t& dropped, uint64_t& failed,
+                          uint64_t& bytes, uint64_t& batches) {
+    auto stats = recorder.stats();
+    recorded = stats.recorded;
+    dropped = stats.dropped;
+    failed = stats.failed;
+    bytes = stats.bytes;
+    batches = stats.batches;
+}
+
+} // namespace pvxs_wrapper
@@ -57,6 +57,10 @@ mod ffi {
         
         // Context creation and operations
         fn create_context_from_env() -> Result<UniquePtr<ContextWrapper>>;
+        fn create_context_shared() -> Result<UniquePtr<ContextWrapper>>;
+        fn context_set_sharing_enabled(enabled: bool);
+        fn context_shared_handle_count() -> usize;
+        fn context_is_shared(ctx: &ContextWrapper) -> bool;
         fn context_get(ctx: Pin<&mut ContextWrapper>, pv_name: &str, timeout: f64,) -> Result<UniquePtr<ValueWrapper>>;
         fn context_put_double(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: f64, timeout: f64,) -> Result<()>;
         fn context_put_int32(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: i32, timeout: f64,) -> Result<()>;
@@ -65,8 +69,43 @@ mod ffi {
         fn context_put_double_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: Vec<f64>, timeout: f64,) -> Result<()>;
         fn context_put_int32_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: Vec<i32>, timeout: f64,) -> Result<()>;
         fn context_put_string_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: Vec<String>, timeout: f64,) -> Result<()>;
+        fn context_put_int8(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: i8, timeout: f64,) -> Result<()>;
+        fn context_put_int8_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[i8], timeout: f64,) -> Result<()>;
+        fn context_put_uint8(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: u8, timeout: f64,) -> Result<()>;
+        fn context_put_uint8_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[u8], timeout: f64,) -> Result<()>;
+        fn context_put_int16(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: i16, timeout: f64,) -> Result<()>;
+        fn context_put_int16_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[i16], timeout: f64,) -> Result<()>;
+        fn context_put_uint16(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: u16, timeout: f64,) -> Result<()>;
+        fn context_put_uint16_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[u16], timeout: f64,) -> Result<()>;
+        fn context_put_uint32(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: u32, timeout: f64,) -> Result<()>;
+        fn context_put_uint32_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[u32], timeout: f64,) -> Result<()>;
+        fn context_put_int64(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: i64, timeout: f64,) -> Result<()>;
+        fn context_put_int64_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[i64], timeout: f64,) -> Result<()>;
+        fn context_put_uint64(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: u64, timeout: f64,) -> Result<()>;
+        fn context_put_uint64_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[u64], timeout: f64,) -> Result<()>;
+        fn context_put_float32(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: f32, timeout: f64,) -> Result<()>;
+        fn context_put_float32_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[f32], timeout: f64,) -> Result<()>;
+        fn context_put_bool(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: bool, timeout: f64,) -> Result<()>;
+        fn context_put_bool_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[bool], timeout: f64,) -> Result<()>;
         fn context_info(ctx: Pin<&mut ContextWrapper>, pv_name: &str, timeout: f64,) -> Result<UniquePtr<ValueWrapper>>;
 
+        // Circuit breaker and negative cache for unreachable PVs
+        fn context_enable_circuit_breaker(ctx: Pin<&mut ContextWrapper>, failure_threshold: u32, open_ms: u64, negative_ttl_ms: u64, per_server: bool) -> Result<()>;
+        fn context_disable_circuit_breaker(ctx: Pin<&mut ContextWrapper>);
+        fn context_circuit_state(ctx: &ContextWrapper, pv_name: &str) -> u8;
+        fn context_circuit_fast_fail_count(ctx: &ContextWrapper) -> u64;
+        fn context_circuit_reset(ctx: Pin<&mut ContextWrapper>);
+
+        // Admission control for outstanding operations
+        fn context_enable_admission_control(ctx: Pin<&mut ContextWrapper>, max_in_flight: u32, max_per_server: u32) -> Result<()>;
+        fn context_disable_admission_control(ctx: Pin<&mut ContextWrapper>);
+        fn context_admission_stats(ctx: &ContextWrapper, in_flight: &mut u64, queued: &mut u64, admitted: &mut u64,
+                                   waited: &mut u64, timed_out: &mut u64, total_wait_us: &mut u64, max_wait_us: &mut u64);
+
+        // Operation priority (PVA channel priority and admission queue order)
+        fn context_set_priority(ctx: Pin<&mut ContextWrapper>, priority: i32) -> Result<()>;
+        fn context_get_priority(ctx: &ContextWrapper) -> i32;
+
         // Value inspection
         fn value_is_valid(val: &ValueWrapper) -> bool;
         fn value_to_string(val: &ValueWrapper) -> String;
@@ -77,6 +116,24 @@ mod ffi {
         fn value_get_field_double_array(val: &ValueWrapper, field_name: String) -> Result<Vec<f64>>;
         fn value_get_field_int32_array(val: &ValueWrapper, field_name: String) -> Result<Vec<i32>>;
         fn value_get_field_string_array(val: &ValueWrapper, field_name: String) -> Result<Vec<String>>;
+        fn value_get_field_int8(val: &ValueWrapper, field_name: String) -> Result<i8>;
+        fn value_get_field_int8_array(val: &ValueWrapper, field_name: String) -> Result<Vec<i8>>;
+        fn value_get_field_uint8(val: &ValueWrapper, field_name: String) -> Result<u8>;
+        fn value_get_field_uint8_array(val: &ValueWrapper, field_name: String) -> Result<Vec<u8>>;
+        fn value_get_field_int16(val: &ValueWrapper, field_name: String) -> Result<i16>;
+        fn value_get_field_int16_array(val: &ValueWrapper, field_name: String) -> Result<Vec<i16>>;
+        fn value_get_field_uint16(val: &ValueWrapper, field_name: String) -> Result<u16>;
+        fn value_get_field_uint16_array(val: &ValueWrapper, field_name: String) -> Result<Vec<u16>>;
+        fn value_get_field_uint32(val: &ValueWrapper, field_name: String) -> Result<u32>;
+        fn value_get_field_uint32_array(val: &ValueWrapper, field_name: String) -> Result<Vec<u32>>;
+        fn value_get_field_int64(val: &ValueWrapper, field_name: String) -> Result<i64>;
+        fn value_get_field_int64_array(val: &ValueWrapper, field_name: String) -> Result<Vec<i64>>;
+        fn value_get_field_uint64(val: &ValueWrapper, field_name: String) -> Result<u64>;
+        fn value_get_field_uint64_array(val: &ValueWrapper, field_name: String) -> Result<Vec<u64>>;
+        fn value_get_field_float32(val: &ValueWrapper, field_name: String) -> Result<f32>;
+        fn value_get_field_float32_array(val: &ValueWrapper, field_name: String) -> Result<Vec<f32>>;
+        fn value_get_field_bool(val: &ValueWrapper, field_name: String) -> Result<bool>;
+        fn value_get_field_bool_array(val: &ValueWrapper, field_name: String) -> Result<Vec<bool>>;
         
         // Monitor operations
         fn context_monitor_create(ctx: Pin<&mut ContextWrapper>, pv_name: String,) -> Result<UniquePtr<MonitorWrapper>>;
@@ -89,12 +146,16 @@ mod ffi {
         fn monitor_is_connected(monitor: &MonitorWrapper) -> bool;
         fn monitor_get_name(monitor: &MonitorWrapper) -> String;
         fn monitor_pop(monitor: Pin<&mut MonitorWrapper>) -> Result<UniquePtr<ValueWrapper>>;
+        fn monitor_duplicate_stats(monitor: &MonitorWrapper, passed: &mut u64, suppressed: &mut u64) -> bool;
         
         // MonitorBuilder operations
         fn context_monitor_builder_create(ctx: Pin<&mut ContextWrapper>, pv_name: String) -> Result<UniquePtr<MonitorBuilderWrapper>>;
         fn monitor_builder_mask_connected(builder: Pin<&mut MonitorBuilderWrapper>, mask: bool) -> Result<()>;
         fn monitor_builder_mask_disconnected(builder: Pin<&mut MonitorBuilderWrapper>, mask: bool) -> Result<()>;
         fn monitor_builder_set_event_callback(builder: Pin<&mut MonitorBuilderWrapper>, callback_ptr: usize) -> Result<()>;
+        fn monitor_builder_priority(builder: Pin<&mut MonitorBuilderWrapper>, priority: i32) -> Result<()>;
+        fn monitor_builder_suppress_duplicates(builder: Pin<&mut MonitorBuilderWrapper>, fields: Vec<String>) -> Result<()>;
+        fn monitor_builder_record_option(builder: Pin<&mut MonitorBuilderWrapper>, name: &str, value: &str) -> Result<()>;
         fn monitor_builder_exec(builder: Pin<&mut MonitorBuilderWrapper>) -> Result<UniquePtr<MonitorWrapper>>;
         fn monitor_builder_exec_with_callback(builder: Pin<&mut MonitorBuilderWrapper>, callback_id: u64) -> Result<UniquePtr<MonitorWrapper>>;
         
@@ -123,7 +184,24 @@ mod ffi {
         fn operation_cancel(op: Pin<&mut OperationWrapper>);
         #[cfg(feature = "async")]
         #[allow(dead_code)]
-        fn operation_wait_for_completion(op: Pin<&mut OperationWrapper>, timeout_ms: u64) -> bool;
+        fn operation_wait_for_completion(op: Pin<&mut OperationWrapper>, timeout_ms: u64) -> Result<bool>;
+        #[cfg(feature = "async")]
+        #[allow(dead_code)]
+        fn operation_name(op: &OperationWrapper) -> Result<String>;
+        
+        // Operation sets - wait on many operations through one shared signal (only available with async feature)
+        #[cfg(feature = "async")]
+        type OperationSetWrapper;
+        #[cfg(feature = "async")]
+        fn operation_set_create() -> Result<UniquePtr<OperationSetWrapper>>;
+        #[cfg(feature = "async")]
+        fn operation_set_add(set: Pin<&mut OperationSetWrapper>, op: &OperationWrapper) -> Result<usize>;
+        #[cfg(feature = "async")]
+        fn operation_set_size(set: &OperationSetWrapper) -> usize;
+        #[cfg(feature = "async")]
+        fn operation_set_wait_any(set: Pin<&mut OperationSetWrapper>, timeout_ms: u64) -> Result<Vec<usize>>;
+        #[cfg(feature = "async")]
+        fn operation_set_wait_all(set: Pin<&mut OperationSetWrapper>, timeout_ms: u64) -> Result<Vec<usize>>;
         
         // RPC operations
         type RpcWrapper;
@@ -159,6 +237,7 @@ mod ffi {
         // Server creation and management
         fn server_create_from_env() -> Result<UniquePtr<ServerWrapper>>;
         fn server_create_isolated() -> Result<UniquePtr<ServerWrapper>>;
+        fn server_create_client_context(server: &ServerWrapper) -> Result<UniquePtr<ContextWrapper>>;
         fn server_start(server: Pin<&mut ServerWrapper>) -> Result<()>;
         fn server_stop(server: Pin<&mut ServerWrapper>) -> Result<()>;
         fn server_add_pv(server: Pin<&mut ServerWrapper>, name: String, pv: Pin<&mut SharedPVWrapper>) -> Result<()>;
@@ -167,6 +246,14 @@ mod ffi {
         // Note: server_add_rpc_source - to be implemented later
         fn server_get_tcp_port(server: &ServerWrapper) -> u16;
         fn server_get_udp_port(server: &ServerWrapper) -> u16;
+
+        // Per-client send limits
+        fn server_enable_send_limits(server: Pin<&mut ServerWrapper>, max_queued_per_client: u64, alert_queued_per_client: u64, alert_callback: usize) -> Result<()>;
+        fn server_disable_send_limits(server: Pin<&mut ServerWrapper>);
+        fn server_send_clients(server: &ServerWrapper) -> Vec<String>;
+        fn server_client_send_stats(server: &ServerWrapper, peer: &str, subscriptions: &mut u64, queued: &mut u64,
+                                    max_queued: &mut u64, squashed: &mut u64, alerts: &mut u64, slow: &mut bool) -> bool;
+        fn server_send_alert_count(server: &ServerWrapper) -> u64;
         
         // SharedPV creation and operations
         fn shared_pv_create_mailbox() -> Result<UniquePtr<SharedPVWrapper>>;
@@ -178,6 +265,24 @@ mod ffi {
         fn shared_pv_open_string(pv: Pin<&mut SharedPVWrapper>, initial_value: String, metadata: &NTScalarMetadata) -> Result<()>;
         fn shared_pv_open_string_array(pv: Pin<&mut SharedPVWrapper>, initial_value: Vec<String>, metadata: &NTScalarMetadata) -> Result<()>;
         fn shared_pv_open_enum(pv: Pin<&mut SharedPVWrapper>, choices: Vec<String>, selected_value: i16, metadata: &NTEnumMetadata) -> Result<()>;
+        fn shared_pv_open_int8(pv: Pin<&mut SharedPVWrapper>, initial_value: i8, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_int8_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[i8], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint8(pv: Pin<&mut SharedPVWrapper>, initial_value: u8, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint8_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[u8], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_int16(pv: Pin<&mut SharedPVWrapper>, initial_value: i16, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_int16_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[i16], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint16(pv: Pin<&mut SharedPVWrapper>, initial_value: u16, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint16_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[u16], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint32(pv: Pin<&mut SharedPVWrapper>, initial_value: u32, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint32_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[u32], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_int64(pv: Pin<&mut SharedPVWrapper>, initial_value: i64, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_int64_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[i64], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint64(pv: Pin<&mut SharedPVWrapper>, initial_value: u64, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_uint64_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[u64], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_float32(pv: Pin<&mut SharedPVWrapper>, initial_value: f32, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_float32_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[f32], metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_bool(pv: Pin<&mut SharedPVWrapper>, initial_value: bool, metadata: &NTScalarMetadata) -> Result<()>;
+        fn shared_pv_open_bool_array(pv: Pin<&mut SharedPVWrapper>, initial_value: &[bool], metadata: &NTScalarMetadata) -> Result<()>;
         fn shared_pv_is_open(pv: &SharedPVWrapper) -> bool;
         fn shared_pv_close(pv: Pin<&mut SharedPVWrapper>) -> Result<()>;
         fn shared_pv_post_double(pv: Pin<&mut SharedPVWrapper>, value: f64) -> Result<()>;
@@ -187,14 +292,158 @@ mod ffi {
         fn shared_pv_post_double_array(pv: Pin<&mut SharedPVWrapper>, value: Vec<f64>) -> Result<()>;
         fn shared_pv_post_int32_array(pv: Pin<&mut SharedPVWrapper>, value: Vec<i32>) -> Result<()>;
         fn shared_pv_post_string_array(pv: Pin<&mut SharedPVWrapper>, value: Vec<String>) -> Result<()>;
+        fn shared_pv_post_int8(pv: Pin<&mut SharedPVWrapper>, value: i8) -> Result<()>;
+        fn shared_pv_post_int8_array(pv: Pin<&mut SharedPVWrapper>, value: &[i8]) -> Result<()>;
+        fn shared_pv_post_uint8(pv: Pin<&mut SharedPVWrapper>, value: u8) -> Result<()>;
+        fn shared_pv_post_uint8_array(pv: Pin<&mut SharedPVWrapper>, value: &[u8]) -> Result<()>;
+        fn shared_pv_post_int16(pv: Pin<&mut SharedPVWrapper>, value: i16) -> Result<()>;
+        fn shared_pv_post_int16_array(pv: Pin<&mut SharedPVWrapper>, value: &[i16]) -> Result<()>;
+        fn shared_pv_post_uint16(pv: Pin<&mut SharedPVWrapper>, value: u16) -> Result<()>;
+        fn shared_pv_post_uint16_array(pv: Pin<&mut SharedPVWrapper>, value: &[u16]) -> Result<()>;
+        fn shared_pv_post_uint32(pv: Pin<&mut SharedPVWrapper>, value: u32) -> Result<()>;
+        fn shared_pv_post_uint32_array(pv: Pin<&mut SharedPVWrapper>, value: &[u32]) -> Result<()>;
+        fn shared_pv_post_int64(pv: Pin<&mut SharedPVWrapper>, value: i64) -> Result<()>;
+        fn shared_pv_post_int64_array(pv: Pin<&mut SharedPVWrapper>, value: &[i64]) -> Result<()>;
+        fn shared_pv_post_uint64(pv: Pin<&mut SharedPVWrapper>, value: u64) -> Result<()>;
+        fn shared_pv_post_uint64_array(pv: Pin<&mut SharedPVWrapper>, value: &[u64]) -> Result<()>;
+        fn shared_pv_post_float32(pv: Pin<&mut SharedPVWrapper>, value: f32) -> Result<()>;
+        fn shared_pv_post_float32_array(pv: Pin<&mut SharedPVWrapper>, value: &[f32]) -> Result<()>;
+        fn shared_pv_post_bool(pv: Pin<&mut SharedPVWrapper>, value: bool) -> Result<()>;
+        fn shared_pv_post_bool_array(pv: Pin<&mut SharedPVWrapper>, value: &[bool]) -> Result<()>;
         fn shared_pv_fetch(pv: &SharedPVWrapper) -> Result<UniquePtr<ValueWrapper>>;
+        fn shared_pv_set_computed_double(pv: Pin<&mut SharedPVWrapper>, compute: usize, ttl: f64) -> Result<()>;
+        fn shared_pv_set_computed_int32(pv: Pin<&mut SharedPVWrapper>, compute: usize, ttl: f64) -> Result<()>;
+        fn shared_pv_invalidate_computed(pv: Pin<&mut SharedPVWrapper>);
+        fn shared_pv_computed_stats(pv: &SharedPVWrapper, evaluations: &mut u64, cache_hits: &mut u64, failed: &mut u64) -> bool;
         
+        // Group PVs - composite PVs posted atomically
+        type GroupPVWrapper;
+        fn group_pv_create() -> Result<UniquePtr<GroupPVWrapper>>;
+        fn group_pv_add_member(group: Pin<&mut GroupPVWrapper>, name: &str, member_type: &str) -> Result<()>;
+        fn group_pv_set_double(group: Pin<&mut GroupPVWrapper>, member: &str, value: f64) -> Result<()>;
+        fn group_pv_set_int32(group: Pin<&mut GroupPVWrapper>, member: &str, value: i32) -> Result<()>;
+        fn group_pv_set_string(group: Pin<&mut GroupPVWrapper>, member: &str, value: String) -> Result<()>;
+        fn group_pv_set_double_array(group: Pin<&mut GroupPVWrapper>, member: &str, value: Vec<f64>) -> Result<()>;
+        fn group_pv_set_int32_array(group: Pin<&mut GroupPVWrapper>, member: &str, value: Vec<i32>) -> Result<()>;
+        fn group_pv_set_string_array(group: Pin<&mut GroupPVWrapper>, member: &str, value: Vec<String>) -> Result<()>;
+        fn group_pv_set_alarm(group: Pin<&mut GroupPVWrapper>, member: &str, severity: i32, status: i32, message: String) -> Result<()>;
+        fn group_pv_open(group: Pin<&mut GroupPVWrapper>) -> Result<()>;
+        fn group_pv_post(group: Pin<&mut GroupPVWrapper>) -> Result<bool>;
+        fn group_pv_fetch(group: &GroupPVWrapper) -> Result<UniquePtr<ValueWrapper>>;
+        fn server_add_group_pv(server: Pin<&mut ServerWrapper>, name: String, group: Pin<&mut GroupPVWrapper>) -> Result<()>;
+
+        // Array PVs backed by a memory-mapped file region
+        type MappedArrayPVWrapper;
+        fn mapped_array_pv_create() -> Result<UniquePtr<MappedArrayPVWrapper>>;
+        fn mapped_array_pv_open(pv: Pin<&mut MappedArrayPVWrapper>, path: &str, element_type: &str, offset: u64, count: u64, metadata: &NTScalarMetadata) -> Result<()>;
+        fn mapped_array_pv_post(pv: Pin<&mut MappedArrayPVWrapper>) -> Result<()>;
+        fn mapped_array_pv_len(pv: &MappedArrayPVWrapper) -> u64;
+        fn mapped_array_pv_fetch(pv: &MappedArrayPVWrapper) -> Result<UniquePtr<ValueWrapper>>;
+        fn server_add_mapped_array_pv(server: Pin<&mut ServerWrapper>, name: String, pv: Pin<&mut MappedArrayPVWrapper>) -> Result<()>;
+
+        // Post staging - many producers, one flusher thread
+        type PostStagerWrapper;
+        fn post_stager_create(interval: f64) -> Result<UniquePtr<PostStagerWrapper>>;
+        fn post_stager_add(stager: Pin<&mut PostStagerWrapper>, pv: &SharedPVWrapper) -> Result<u64>;
+        fn post_stager_stage_double(stager: &PostStagerWrapper, slot: u64, value: f64) -> Result<()>;
+        fn post_stager_stage_int32(stager: &PostStagerWrapper, slot: u64, value: i32) -> Result<()>;
+        fn post_stager_start(stager: Pin<&mut PostStagerWrapper>) -> Result<()>;
+        fn post_stager_stop(stager: Pin<&mut PostStagerWrapper>) -> Result<()>;
+        fn post_stager_is_running(stager: &PostStagerWrapper) -> bool;
+        fn post_stager_stats(stager: &PostStagerWrapper, staged: &mut u64, coalesced: &mut u64, posted: &mut u64,
+                             failed: &mut u64, flushes: &mut u64, last_latency: &mut f64, max_latency: &mut f64,
+                             mean_latency: &mut f64);
+
+        // Autosave - write-behind snapshots of SharedPV values
+        type AutosaveWrapper;
+        fn autosave_create(path: &str, interval: f64) -> Result<UniquePtr<AutosaveWrapper>>;
+        fn autosave_add(autosave: Pin<&mut AutosaveWrapper>, name: &str, pv: &SharedPVWrapper) -> Result<()>;
+        fn autosave_restore(autosave: Pin<&mut AutosaveWrapper>) -> Result<u64>;
+        fn autosave_save(autosave: Pin<&mut AutosaveWrapper>) -> Result<bool>;
+        fn autosave_start(autosave: Pin<&mut AutosaveWrapper>) -> Result<()>;
+        fn autosave_stop(autosave: Pin<&mut AutosaveWrapper>) -> Result<()>;
+        fn autosave_is_running(autosave: &AutosaveWrapper) -> bool;
+        fn autosave_stats(autosave: &AutosaveWrapper, saves: &mut u64, failed: &mut u64, generation: &mut u64,
+                          bytes: &mut u64, last_duration: &mut f64);
+
+        // Snapshots - every mailbox PV saved to one file and served again in one pass
+        type PVSnapshotWrapper;
+        fn server_save_snapshot(server: &ServerWrapper, path: &str) -> Result<u64>;
+        fn server_load_snapshot(server: Pin<&mut ServerWrapper>, path: &str) -> Result<UniquePtr<PVSnapshotWrapper>>;
+        fn pv_snapshot_len(snapshot: &PVSnapshotWrapper) -> u64;
+        fn pv_snapshot_name(snapshot: &PVSnapshotWrapper, index: u64) -> String;
+        fn pv_snapshot_take(snapshot: Pin<&mut PVSnapshotWrapper>, index: u64) -> Result<UniquePtr<SharedPVWrapper>>;
+
         // StaticSource creation and operations
         fn static_source_create() -> Result<UniquePtr<StaticSourceWrapper>>;
         fn static_source_add_pv(source: Pin<&mut StaticSourceWrapper>, name: String, pv: Pin<&mut SharedPVWrapper>) -> Result<()>;
         fn static_source_remove_pv(source: Pin<&mut StaticSourceWrapper>, name: String) -> Result<()>;
         fn static_source_close_all(source: Pin<&mut StaticSourceWrapper>) -> Result<()>;
-        
+
+        // Relays - client subscription republished through a SharedPV
+        type RelayWrapper;
+        fn context_relay_create(ctx: Pin<&mut ContextWrapper>, upstream: String, target: &SharedPVWrapper) -> Result<UniquePtr<RelayWrapper>>;
+        fn relay_add_scale(relay: Pin<&mut RelayWrapper>, factor: f64, offset: f64) -> Result<()>;
+        fn relay_add_clamp(relay: Pin<&mut RelayWrapper>, low: f64, high: f64) -> Result<()>;
+        fn relay_add_decimate(relay: Pin<&mut RelayWrapper>, every: u64) -> Result<()>;
+        fn relay_add_remap(relay: Pin<&mut RelayWrapper>, from: &str, to: &str) -> Result<()>;
+        fn relay_start(relay: Pin<&mut RelayWrapper>) -> Result<()>;
+        fn relay_stop(relay: Pin<&mut RelayWrapper>) -> Result<()>;
+        fn relay_is_running(relay: &RelayWrapper) -> bool;
+        fn relay_stats(relay: &RelayWrapper, forwarded: &mut u64, decimated: &mut u64, failed: &mut u64);
+
+        // Alarm summaries - incremental per-group alarm counts
+        type AlarmSummaryWrapper;
+        fn context_alarm_summary_create(ctx: Pin<&mut ContextWrapper>) -> Result<UniquePtr<AlarmSummaryWrapper>>;
+        fn alarm_summary_add_pv(summary: Pin<&mut AlarmSummaryWrapper>, pv_name: &str, group: &str) -> Result<()>;
+        fn alarm_summary_publish(summary: Pin<&mut AlarmSummaryWrapper>, server: Pin<&mut ServerWrapper>, prefix: &str) -> Result<()>;
+        fn alarm_summary_start(summary: Pin<&mut AlarmSummaryWrapper>) -> Result<()>;
+        fn alarm_summary_stop(summary: Pin<&mut AlarmSummaryWrapper>) -> Result<()>;
+        fn alarm_summary_is_running(summary: &AlarmSummaryWrapper) -> bool;
+        fn alarm_summary_groups(summary: &AlarmSummaryWrapper) -> Vec<String>;
+        fn alarm_summary_group_stats(summary: &AlarmSummaryWrapper, group: &str, total: &mut u64, no_alarm: &mut u64,
+                                     minor: &mut u64, major: &mut u64, invalid: &mut u64, disconnected: &mut u64,
+                                     max_severity: &mut u8) -> bool;
+        fn alarm_summary_updates(summary: &AlarmSummaryWrapper) -> u64;
+
+        // Array recorders - array updates written to a file from the received buffers
+        type ArrayRecorderWrapper;
+        fn context_array_recorder_create(ctx: Pin<&mut ContextWrapper>, pv_name: &str, path: &str, capacity: u64,
+                                         ring: bool, max_queued: u64, drop_cache: bool) -> Result<UniquePtr<ArrayRecorderWrapper>>;
+        fn array_recorder_start(recorder: Pin<&mut ArrayRecorderWrapper>) -> Result<()>;
+        fn array_recorder_stop(recorder: Pin<&mut ArrayRecorderWrapper>) -> Result<()>;
+        fn array_recorder_is_running(recorder: &ArrayRecorderWrapper) -> bool;
+        fn array_recorder_stats(recorder: &ArrayRecorderWrapper, recorded: &mut u64, dropped: &mut u64, failed: &mut u64,
+                                bytes: &mut u64, batches: &mut u64);
+
+        // Histograms - bin counts of a PV's values served as a SharedPV
+        type HistogramWrapper;
+        fn context_histogram_create(ctx: Pin<&mut ContextWrapper>, pv_name: &str, bins: u64, low: f64, high: f64,
+                                    window: f64, slices: u64) -> Result<UniquePtr<HistogramWrapper>>;
+        fn histogram_publish(histogram: Pin<&mut HistogramWrapper>, server: Pin<&mut ServerWrapper>, name: &str) -> Result<()>;
+        fn histogram_start(histogram: Pin<&mut HistogramWrapper>) -> Result<()>;
+        fn histogram_stop(histogram: Pin<&mut HistogramWrapper>) -> Result<()>;
+        fn histogram_is_running(histogram: &HistogramWrapper) -> bool;
+        fn histogram_counts(histogram: &HistogramWrapper) -> Vec<u64>;
+        fn histogram_stats(histogram: &HistogramWrapper, updates: &mut u64, samples: &mut u64, failed: &mut u64,
+                           expired: &mut u64, underflow: &mut u64, overflow: &mut u64);
+
+        // Timeline tracing
+        fn trace_enable(events_per_thread: u64) -> Result<()>;
+        fn trace_disable();
+        fn trace_is_enabled() -> bool;
+        fn trace_clear();
+        fn trace_dropped() -> u64;
+        fn trace_to_json() -> String;
+        fn trace_begin(name: &str);
+        fn trace_end(name: &str);
+        fn trace_instant(name: &str);
+
+        // Diagnostics
+        fn diagnostics_instance_counts(names: &mut Vec<String>, counts: &mut Vec<u64>) -> Result<()>;
+        fn diagnostics_resident_memory() -> u64;
+        fn diagnostics_allocator_stats(in_use: &mut u64, free_bytes: &mut u64, mapped: &mut u64) -> bool;
+
         // Note: RpcSource creation operations - to be implemented later
     }
 }
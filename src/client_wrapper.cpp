@@ -190,6 +190,48 @@ namespace pvxs_wrapper {
         }
     }
 
+    template <typename T>
+    T ValueWrapper::get_field_as(const std::string& field_name) const {
+        if (!value_.valid()) {
+            throw PvxsError("Value is not valid");
+        }
+
+        try {
+            auto field = value_[field_name];
+            if (!field.valid()) {
+                throw PvxsError("Field '" + field_name + "' not found");
+            }
+            return field.as<T>();
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error getting field '") + field_name + "': " + e.what());
+        }
+    }
+
+    template <typename E>
+    rust::Vec<E> ValueWrapper::get_field_array_as(const std::string& field_name) const {
+        if (!value_.valid()) {
+            throw PvxsError("Value is not valid");
+        }
+
+        try {
+            auto field = value_[field_name];
+            if (!field.valid()) {
+                throw PvxsError("Field '" + field_name + "' not found");
+            }
+
+            // Converts element-wise if the field is stored with another element type
+            auto arr = field.as<pvxs::shared_array<const E>>();
+            rust::Vec<E> result;
+            result.reserve(arr.size());
+            for (size_t i = 0; i < arr.size(); ++i) {
+                result.push_back(arr[i]);
+            }
+            return result;
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error getting array field '") + field_name + "': " + e.what());
+        }
+    }
+
     // ============================================================================
     // ContextWrapper implementation
     // ============================================================================
@@ -204,13 +246,144 @@ namespace pvxs_wrapper {
         }
     }
 
+    std::shared_ptr<AdmissionController::Ticket> ContextWrapper::admit(const std::string& pv_name, double timeout) {
+        // Known-dead PVs fail fast without taking a slot
+        if (breaker_) {
+            breaker_->admit(pv_name);
+        }
+        if (admission_) {
+            return admission_->acquire(pv_name, timeout, priority_);
+        }
+        return nullptr;
+    }
+
+    // Process-wide context. Handles keep it alive, the registry only observes it
+    static std::mutex shared_context_lock;
+    static std::weak_ptr<pvxs::client::Context> shared_context;
+    static std::atomic<bool> shared_context_enabled{true};
+
+    std::unique_ptr<ContextWrapper> ContextWrapper::shared() {
+        if (!shared_context_enabled) {
+            return from_env();
+        }
+        
+        try {
+            std::lock_guard<std::mutex> guard(shared_context_lock);
+            auto ctx = shared_context.lock();
+            if (!ctx) {
+                ctx = std::make_shared<pvxs::client::Context>(pvxs::client::Config::fromEnv().build());
+                shared_context = ctx;
+            }
+            // pvxs::client::Context copies are handles on the same sockets, threads and channel cache
+            auto wrapper = std::make_unique<ContextWrapper>(pvxs::client::Context(*ctx));
+            wrapper->shared_ = std::move(ctx);
+            return wrapper;
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error creating shared context: ") + e.what());
+        }
+    }
+
+    void ContextWrapper::set_sharing_enabled(bool enabled) {
+        shared_context_enabled = enabled;
+    }
+
+    size_t ContextWrapper::shared_handle_count() {
+        std::lock_guard<std::mutex> guard(shared_context_lock);
+        return static_cast<size_t>(shared_context.use_count());
+    }
+
+    template <typename Builder>
+    pvxs::Value ContextWrapper::exec_guarded(const char* operation, const std::string& pv_name, Builder&& builder, double timeout) {
+        TraceSpan span("client", operation, pv_name);
+        builder.priority(priority_);
+        if (!breaker_ && !admission_) {
+            return builder.exec()->wait(timeout);
+        }
+
+        // Time spent queued for admission counts against the caller's timeout
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+        auto ticket = admit(pv_name, timeout);
+        auto state = std::make_shared<OperationState>();
+        auto op = builder.result(OperationState::handler(state)).exec();
+        double remaining = std::chrono::duration<double>(deadline - std::chrono::steady_clock::now()).count();
+        if (!state->wait_for(remaining)) {
+            op->cancel();
+            // cancel() is synchronous, so the result cannot arrive after this check
+            if (!state->done) {
+                if (breaker_) {
+                    breaker_->record_timeout(pv_name);
+                }
+                throw PvxsError("Timeout");
+            }
+        }
+        if (breaker_) {
+            breaker_->record(pv_name, *state);
+        }
+        if (admission_) {
+            admission_->learn(pv_name, state->peer);
+        }
+        if (!state->error.empty()) {
+            throw PvxsError(state->error);
+        }
+        return std::move(state->value);
+    }
+
+    // RpcWrapper::execute_sync() lives in client_wrapper_rpc.cpp
+    template pvxs::Value ContextWrapper::exec_guarded<pvxs::client::RPCBuilder&>(
+        const char* operation, const std::string& pv_name, pvxs::client::RPCBuilder& builder, double timeout);
+
+    std::function<void(pvxs::client::Result&&)> ContextWrapper::completion_handler(
+        const std::string& pv_name,
+        const std::shared_ptr<OperationState>& state,
+        std::shared_ptr<CircuitBreaker> breaker,
+        std::shared_ptr<AdmissionController> admission,
+        std::shared_ptr<AdmissionController::Ticket> ticket) {
+        
+        if (!breaker && !ticket) {
+            return OperationState::handler(state);
+        }
+        return [breaker, admission, ticket, pv_name, state](pvxs::client::Result&& result) {
+            // A result arriving after the deadline failed the operation is not reported
+            bool reported = state->complete(std::move(result));
+            if (breaker && reported) {
+                breaker->record(pv_name, *state);
+            }
+            if (ticket) {
+                if (reported) {
+                    admission->learn(pv_name, state->peer);
+                }
+                ticket->release();
+            }
+        };
+    }
+
+    void ContextWrapper::enable_circuit_breaker(const CircuitBreaker::Config& config) {
+        if (config.failure_threshold == 0) {
+            throw PvxsError("Circuit breaker failure threshold must be at least 1");
+        }
+        breaker_ = std::make_shared<CircuitBreaker>(config);
+    }
+
+    void ContextWrapper::enable_admission_control(const AdmissionController::Config& config) {
+        if (config.max_in_flight == 0 && config.max_per_server == 0) {
+            throw PvxsError("Admission control needs a limit on in-flight operations per context or per server");
+        }
+        admission_ = std::make_shared<AdmissionController>(config);
+    }
+
+    void ContextWrapper::set_priority(int priority) {
+        if (priority < 0 || priority > 99) {
+            throw PvxsError("Priority must be between 0 and 99, got " + std::to_string(priority));
+        }
+        priority_ = priority;
+    }
+
     std::unique_ptr<ValueWrapper> ContextWrapper::get(
         const std::string& pv_name, 
         double timeout) {
         
         try {
-            auto op = context_.get(pv_name).exec();
-            auto result = op->wait(timeout);
+            auto result = exec_guarded("get", pv_name, context_.get(pv_name), timeout);
             return std::make_unique<ValueWrapper>(std::move(result));
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in get for '") + pv_name + "': " + e.what());
@@ -223,10 +396,10 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([value](pvxs::Value&& val) {
                 val["value"] = value;
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -238,10 +411,10 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([value](pvxs::Value&& val) {
                 val["value"] = value;
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -253,10 +426,10 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([&value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([&value](pvxs::Value&& val) {
                 val["value"] = value;
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -269,10 +442,10 @@ namespace pvxs_wrapper {
         
         try {
             // For enums, we need to set value.index, not just value
-            context_.put(pv_name).build([value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([value](pvxs::Value&& val) {
                 val["value.index"] = value;
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -284,7 +457,7 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([&value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([&value](pvxs::Value&& val) {
                 // Convert rust::Vec to pvxs::shared_array
                 pvxs::shared_array<double> arr(value.size());
                 for (size_t i = 0; i < value.size(); ++i) {
@@ -292,7 +465,7 @@ namespace pvxs_wrapper {
                 }
                 val["value"] = arr.freeze();
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -304,7 +477,7 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([&value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([&value](pvxs::Value&& val) {
                 // Convert rust::Vec to pvxs::shared_array
                 pvxs::shared_array<int32_t> arr(value.size());
                 for (size_t i = 0; i < value.size(); ++i) {
@@ -312,7 +485,7 @@ namespace pvxs_wrapper {
                 }
                 val["value"] = arr.freeze();
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -324,7 +497,7 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([&value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([&value](pvxs::Value&& val) {
                 // Convert rust::Vec to pvxs::shared_array
                 pvxs::shared_array<int16_t> arr(value.size());
                 for (size_t i = 0; i < value.size(); ++i) {
@@ -332,7 +505,7 @@ namespace pvxs_wrapper {
                 }
                 val["value"] = arr.freeze();
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -344,7 +517,7 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            context_.put(pv_name).build([&value](pvxs::Value&& val) {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([&value](pvxs::Value&& val) {
                 // Convert rust::Vec<rust::String> to pvxs::shared_array<std::string>
                 pvxs::shared_array<std::string> arr(value.size());
                 for (size_t i = 0; i < value.size(); ++i) {
@@ -352,7 +525,23 @@ namespace pvxs_wrapper {
                 }
                 val["value"] = arr.freeze();
                 return std::move(val);
-            }).exec()->wait(timeout);
+            }), timeout);
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
+        }
+    }
+
+    template <typename T>
+    void ContextWrapper::put_value(
+        const std::string& pv_name,
+        const T& value,
+        double timeout) {
+
+        try {
+            exec_guarded("put", pv_name, context_.put(pv_name).build([&value](pvxs::Value&& val) {
+                val["value"] = value;
+                return std::move(val);
+            }), timeout);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put for '") + pv_name + "': " + e.what());
         }
@@ -363,7 +552,7 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            auto result = context_.info(pv_name).exec()->wait(timeout);
+            auto result = exec_guarded("info", pv_name, context_.info(pv_name), timeout);
             return std::make_unique<ValueWrapper>(std::move(result));
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in info for '") + pv_name + "': " + e.what());
@@ -372,15 +561,37 @@ namespace pvxs_wrapper {
 
     std::unique_ptr<RpcWrapper> ContextWrapper::rpc_create(const std::string& pv_name) {
         try {
-            return std::make_unique<RpcWrapper>(context_, pv_name);
+            return std::make_unique<RpcWrapper>(*this, pv_name);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error creating RPC for '") + pv_name + "': " + e.what());
         }
     }
 
+    std::unique_ptr<RelayWrapper> ContextWrapper::relay_create(const std::string& upstream, const SharedPVWrapper& target) {
+        try {
+            return std::make_unique<RelayWrapper>(context_, priority_, upstream, target);
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error creating relay for '") + upstream + "': " + e.what());
+        }
+    }
+
+    std::unique_ptr<AlarmSummaryWrapper> ContextWrapper::alarm_summary_create() {
+        return std::make_unique<AlarmSummaryWrapper>(context_, priority_);
+    }
+
+    std::unique_ptr<ArrayRecorderWrapper> ContextWrapper::array_recorder_create(const std::string& pv_name, const std::string& path) {
+        return std::make_unique<ArrayRecorderWrapper>(context_, priority_, pv_name, path);
+    }
+
+    std::unique_ptr<HistogramWrapper> ContextWrapper::histogram_create(const std::string& pv_name) {
+        return std::make_unique<HistogramWrapper>(context_, priority_, pv_name);
+    }
+
     std::unique_ptr<MonitorWrapper> ContextWrapper::monitor(const std::string& pv_name) {
         try {
-            return std::make_unique<MonitorWrapper>(context_, pv_name);
+            auto monitor = std::make_unique<MonitorWrapper>(context_, pv_name);
+            monitor->set_priority(priority_);
+            return monitor;
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error creating monitor for '") + pv_name + "': " + e.what());
         }
@@ -388,7 +599,7 @@ namespace pvxs_wrapper {
 
     std::unique_ptr<MonitorBuilderWrapper> ContextWrapper::monitor_builder(const std::string& pv_name) {
         try {
-            return std::make_unique<MonitorBuilderWrapper>(context_, pv_name);
+            return std::make_unique<MonitorBuilderWrapper>(context_, pv_name, priority_);
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error creating monitor builder for '") + pv_name + "': " + e.what());
         }
@@ -402,6 +613,22 @@ namespace pvxs_wrapper {
         return ContextWrapper::from_env();
     }
 
+    std::unique_ptr<ContextWrapper> create_context_shared() {
+        return ContextWrapper::shared();
+    }
+
+    void context_set_sharing_enabled(bool enabled) {
+        ContextWrapper::set_sharing_enabled(enabled);
+    }
+
+    size_t context_shared_handle_count() {
+        return ContextWrapper::shared_handle_count();
+    }
+
+    bool context_is_shared(const ContextWrapper& ctx) {
+        return ctx.is_shared();
+    }
+
     std::unique_ptr<ValueWrapper> context_get(ContextWrapper& ctx, rust::Str pv_name, double timeout) {
         return ctx.get(std::string(pv_name), timeout);
     }
@@ -438,10 +665,90 @@ namespace pvxs_wrapper {
         ctx.put(std::string(pv_name), value, timeout);
     }
 
+    void context_put_int8(ContextWrapper& ctx, rust::Str pv_name, int8_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_int8_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const int8_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const int8_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_uint8(ContextWrapper& ctx, rust::Str pv_name, uint8_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_uint8_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const uint8_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const uint8_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_int16(ContextWrapper& ctx, rust::Str pv_name, int16_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_int16_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const int16_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const int16_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_uint16(ContextWrapper& ctx, rust::Str pv_name, uint16_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_uint16_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const uint16_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const uint16_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_uint32(ContextWrapper& ctx, rust::Str pv_name, uint32_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_uint32_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const uint32_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const uint32_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_int64(ContextWrapper& ctx, rust::Str pv_name, int64_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_int64_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const int64_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const int64_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_uint64(ContextWrapper& ctx, rust::Str pv_name, uint64_t value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_uint64_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const uint64_t> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const uint64_t>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_float32(ContextWrapper& ctx, rust::Str pv_name, float value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_float32_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const float> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const float>(value.begin(), value.end()), timeout);
+    }
+
+    void context_put_bool(ContextWrapper& ctx, rust::Str pv_name, bool value, double timeout) {
+        ctx.put_value(std::string(pv_name), value, timeout);
+    }
+
+    void context_put_bool_array(ContextWrapper& ctx, rust::Str pv_name, rust::Slice<const bool> value, double timeout) {
+        ctx.put_value(std::string(pv_name), pvxs::shared_array<const bool>(value.begin(), value.end()), timeout);
+    }
+
     std::unique_ptr<ValueWrapper> context_info(ContextWrapper& ctx, rust::Str pv_name, double timeout) {
         return ctx.info(std::string(pv_name), timeout);
     }
 
+    void context_set_priority(ContextWrapper& ctx, int32_t priority) {
+        ctx.set_priority(priority);
+    }
+
+    int32_t context_get_priority(const ContextWrapper& ctx) {
+        return ctx.priority();
+    }
+
     // ============================================================================
     // Value accessor functions for Rust FFI
     // ============================================================================
@@ -485,4 +792,76 @@ namespace pvxs_wrapper {
     rust::Vec<rust::String> value_get_field_string_array(const ValueWrapper& val, rust::String field_name) {
         return val.get_field_string_array(std::string(field_name));
     }
+
+    int8_t value_get_field_int8(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<int8_t>(std::string(field_name));
+    }
+
+    rust::Vec<int8_t> value_get_field_int8_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<int8_t>(std::string(field_name));
+    }
+
+    uint8_t value_get_field_uint8(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<uint8_t>(std::string(field_name));
+    }
+
+    rust::Vec<uint8_t> value_get_field_uint8_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<uint8_t>(std::string(field_name));
+    }
+
+    int16_t value_get_field_int16(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<int16_t>(std::string(field_name));
+    }
+
+    rust::Vec<int16_t> value_get_field_int16_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<int16_t>(std::string(field_name));
+    }
+
+    uint16_t value_get_field_uint16(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<uint16_t>(std::string(field_name));
+    }
+
+    rust::Vec<uint16_t> value_get_field_uint16_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<uint16_t>(std::string(field_name));
+    }
+
+    uint32_t value_get_field_uint32(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<uint32_t>(std::string(field_name));
+    }
+
+    rust::Vec<uint32_t> value_get_field_uint32_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<uint32_t>(std::string(field_name));
+    }
+
+    int64_t value_get_field_int64(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<int64_t>(std::string(field_name));
+    }
+
+    rust::Vec<int64_t> value_get_field_int64_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<int64_t>(std::string(field_name));
+    }
+
+    uint64_t value_get_field_uint64(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<uint64_t>(std::string(field_name));
+    }
+
+    rust::Vec<uint64_t> value_get_field_uint64_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<uint64_t>(std::string(field_name));
+    }
+
+    float value_get_field_float32(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<float>(std::string(field_name));
+    }
+
+    rust::Vec<float> value_get_field_float32_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<float>(std::string(field_name));
+    }
+
+    bool value_get_field_bool(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_as<bool>(std::string(field_name));
+    }
+
+    rust::Vec<bool> value_get_field_bool_array(const ValueWrapper& val, rust::String field_name) {
+        return val.get_field_array_as<bool>(std::string(field_name));
+    }
 } // namespace pvxs_wrapper
\ No newline at end of file
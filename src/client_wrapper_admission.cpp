@@ -0,0 +1,252 @@
+// client_wrapper_admission.cpp - Admission control for outstanding client operations
+
+#include "wrapper.h"
+
+namespace pvxs_wrapper {
+
+    // ============================================================================
+    // AdmissionController implementation
+    // ============================================================================
+
+    void AdmissionController::Ticket::release() {
+        if (!released_.exchange(true)) {
+            owner_->release(server_);
+        }
+    }
+
+    bool AdmissionController::fits(const std::string& server) const {
+        if (config_.max_in_flight && in_flight_ >= config_.max_in_flight) {
+            return false;
+        }
+        if (config_.max_per_server && !server.empty()) {
+            auto it = per_server_.find(server);
+            if (it != per_server_.end() && it->second >= config_.max_per_server) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void AdmissionController::take(const std::string& server) {
+        in_flight_++;
+        if (!server.empty()) {
+            per_server_[server]++;
+        }
+        stats_.admitted++;
+    }
+
+    void AdmissionController::release(const std::string& server) {
+        std::vector<std::shared_ptr<Waiter>> granted;
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            in_flight_--;
+            if (!server.empty()) {
+                auto it = per_server_.find(server);
+                if (it != per_server_.end() && --it->second == 0) {
+                    per_server_.erase(it);
+                }
+            }
+            granted = dispatch();
+        }
+        launch(granted);
+    }
+
+    void AdmissionController::count_wait(const Waiter& waiter) {
+        auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waiter.queued_at);
+        uint64_t wait_us = static_cast<uint64_t>(waited.count());
+        stats_.waited++;
+        stats_.total_wait_us += wait_us;
+        if (wait_us > stats_.max_wait_us) {
+            stats_.max_wait_us = wait_us;
+        }
+    }
+
+    std::vector<std::shared_ptr<AdmissionController::Waiter>> AdmissionController::dispatch() {
+        // Highest priority first, oldest first within a priority. A waiter blocked only by its own
+        // server's limit does not hold up waiters for other servers, but nobody overtakes once the
+        // context limit is reached.
+        std::vector<std::shared_ptr<Waiter>> granted;
+        for (auto level = queues_.begin(); level != queues_.end();) {
+            auto& queue = level->second;
+            for (auto it = queue.begin(); it != queue.end();) {
+                if (config_.max_in_flight && in_flight_ >= config_.max_in_flight) {
+                    return granted;
+                }
+                auto& waiter = *it;
+                if (fits(waiter->server)) {
+                    take(waiter->server);
+                    count_wait(*waiter);
+                    waiter->granted = true;
+                    if (waiter->start) {
+                        granted.push_back(waiter);
+                    } else {
+                        waiter->cv.notify_one();
+                    }
+                    it = queue.erase(it);
+                    queued_--;
+                } else {
+                    ++it;
+                }
+            }
+            if (queue.empty()) {
+                level = queues_.erase(level);
+            } else {
+                ++level;
+            }
+        }
+        return granted;
+    }
+
+    void AdmissionController::launch(const std::vector<std::shared_ptr<Waiter>>& granted) {
+        for (auto& waiter : granted) {
+            waiter->start(std::make_shared<Ticket>(shared_from_this(), waiter->server));
+        }
+    }
+
+    std::shared_ptr<AdmissionController::Ticket> AdmissionController::acquire(const std::string& pv_name, double timeout,
+                                                                              int priority) {
+        std::unique_lock<std::mutex> guard(lock_);
+
+        std::string server;
+        if (config_.max_per_server) {
+            auto it = pv_server_.find(pv_name);
+            if (it != pv_server_.end()) {
+                server = it->second;
+            }
+        }
+
+        if (queued_ == 0 && fits(server)) {
+            take(server);
+            return std::make_shared<Ticket>(shared_from_this(), server);
+        }
+
+        auto waiter = std::make_shared<Waiter>();
+        waiter->server = server;
+        waiter->priority = priority;
+        waiter->queued_at = std::chrono::steady_clock::now();
+        queues_[priority].push_back(waiter);
+        queued_++;
+        auto granted = dispatch();
+        if (!granted.empty()) {
+            guard.unlock();
+            launch(granted);
+            guard.lock();
+        }
+
+        auto deadline = waiter->queued_at + std::chrono::duration<double>(timeout);
+        if (!waiter->cv.wait_until(guard, deadline, [&waiter]() { return waiter->granted; })) {
+            auto level = queues_.find(priority);
+            level->second.remove(waiter);
+            if (level->second.empty()) {
+                queues_.erase(level);
+            }
+            queued_--;
+            stats_.timed_out++;
+            throw PvxsError("Timeout waiting for admission (" + std::to_string(in_flight_) + " operations in flight)");
+        }
+        return std::make_shared<Ticket>(shared_from_this(), server);
+    }
+
+    std::shared_ptr<AdmissionController::Waiter> AdmissionController::enqueue(const std::string& pv_name, int priority,
+                                                                              std::function<void(std::shared_ptr<Ticket>)> start) {
+        std::unique_lock<std::mutex> guard(lock_);
+
+        std::string server;
+        if (config_.max_per_server) {
+            auto it = pv_server_.find(pv_name);
+            if (it != pv_server_.end()) {
+                server = it->second;
+            }
+        }
+
+        if (queued_ == 0 && fits(server)) {
+            take(server);
+            guard.unlock();
+            start(std::make_shared<Ticket>(shared_from_this(), server));
+            return nullptr;
+        }
+
+        auto waiter = std::make_shared<Waiter>();
+        waiter->server = server;
+        waiter->priority = priority;
+        waiter->start = std::move(start);
+        waiter->queued_at = std::chrono::steady_clock::now();
+        queues_[priority].push_back(waiter);
+        queued_++;
+        auto granted = dispatch();
+        guard.unlock();
+        launch(granted);
+        return waiter;
+    }
+
+    bool AdmissionController::withdraw(const std::shared_ptr<Waiter>& waiter, bool timed_out) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (waiter->granted) {
+            return false;
+        }
+        auto level = queues_.find(waiter->priority);
+        if (level == queues_.end()) {
+            return false;
+        }
+        auto before = level->second.size();
+        level->second.remove(waiter);
+        if (level->second.size() == before) {
+            return false;
+        }
+        if (level->second.empty()) {
+            queues_.erase(level);
+        }
+        queued_--;
+        if (timed_out) {
+            stats_.timed_out++;
+        }
+        return true;
+    }
+
+    void AdmissionController::learn(const std::string& pv_name, const std::string& peer) {
+        if (!config_.max_per_server || peer.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard(lock_);
+        pv_server_[pv_name] = peer;
+    }
+
+    AdmissionController::Stats AdmissionController::stats() {
+        std::lock_guard<std::mutex> guard(lock_);
+        Stats result = stats_;
+        result.in_flight = in_flight_;
+        result.queued = queued_;
+        return result;
+    }
+
+    // ============================================================================
+    // Admission control functions for Rust FFI
+    // ============================================================================
+
+    void context_enable_admission_control(ContextWrapper& ctx, uint32_t max_in_flight, uint32_t max_per_server) {
+        AdmissionController::Config config;
+        config.max_in_flight = max_in_flight;
+        config.max_per_server = max_per_server;
+        ctx.enable_admission_control(config);
+    }
+
+    void context_disable_admission_control(ContextWrapper& ctx) {
+        ctx.disable_admission_control();
+    }
+
+    void context_admission_stats(const ContextWrapper& ctx, uint64_t& in_flight, uint64_t& queued, uint64_t& admitted,
+                                 uint64_t& waited, uint64_t& timed_out, uint64_t& total_wait_us, uint64_t& max_wait_us) {
+        AdmissionController::Stats stats;
+        if (auto& admission = ctx.admission_controller()) {
+            stats = admission->stats();
+        }
+        in_flight = stats.in_flight;
+        queued = stats.queued;
+        admitted = stats.admitted;
+        waited = stats.waited;
+        timed_out = stats.timed_out;
+        total_wait_us = stats.total_wait_us;
+        max_wait_us = stats.max_wait_us;
+    }
+
+} // namespace pvxs_wrapper
@@ -1,82 +1,423 @@
 #include "wrapper.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace pvxs_wrapper {
     // ============================================================================
-    // OperationWrapper implementation
+    // Completion state shared between operations and waiters
+    // ============================================================================
+
+    void CompletionSignal::notify() {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            generation++;
+        }
+        cv.notify_all();
+    }
+
+    bool OperationState::complete(pvxs::client::Result&& result) {
+        std::vector<std::weak_ptr<CompletionSignal>> to_notify;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (done) {
+                return false;
+            }
+            peer = result.peerName();
+            try {
+                value = result();
+            } catch (const pvxs::client::Disconnect& e) {
+                error = e.what();
+                disconnected = true;
+            } catch (const std::exception& e) {
+                error = e.what();
+            }
+            done = true;
+            to_notify.swap(listeners);
+        }
+        wake(to_notify);
+        return true;
+    }
+
+    bool OperationState::fail(const std::string& message) {
+        std::vector<std::weak_ptr<CompletionSignal>> to_notify;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (done) {
+                return false;
+            }
+            error = message;
+            done = true;
+            to_notify.swap(listeners);
+        }
+        wake(to_notify);
+        return true;
+    }
+
+    void OperationState::wake(std::vector<std::weak_ptr<CompletionSignal>>& to_notify) {
+        if (trace_id) {
+            Tracer::async_end("client", trace_name, trace_id);
+        }
+        done_cv.notify_all();
+
+        // Notify outside of our own lock so waiters may inspect this state
+        for (auto& weak : to_notify) {
+            if (auto signal = weak.lock()) {
+                signal->notify();
+            }
+        }
+    }
+
+    void OperationState::trace(const char* name, const std::string& pv_name) {
+        trace_name = name;
+        trace_id = Tracer::async_begin("client", name, pv_name);
+    }
+
+    bool OperationState::wait_for(double timeout) {
+        std::unique_lock<std::mutex> guard(lock);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+        return done_cv.wait_until(guard, deadline, [this]() { return done.load(); });
+    }
+
+    void OperationState::add_listener(const std::shared_ptr<CompletionSignal>& signal) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (!done) {
+                listeners.push_back(signal);
+                return;
+            }
+        }
+        // Already finished, wake the set so it re-scans
+        signal->notify();
+    }
+
+    std::function<void(pvxs::client::Result&&)> OperationState::handler(const std::shared_ptr<OperationState>& state) {
+        return [state](pvxs::client::Result&& result) {
+            state->complete(std::move(result));
+        };
+    }
+
+    // ============================================================================
+    // OperationHandle implementation
     // ============================================================================
     #ifdef PVXS_ASYNC_ENABLED
 
+    namespace {
+
+        // Deadlines of async operations, all served by one thread
+        class DeadlineTimer
+        {
+        private:
+            std::mutex lock_;
+            std::condition_variable wake_;
+            std::multimap<std::chrono::steady_clock::time_point, std::weak_ptr<OperationHandle>> due_;
+
+            void run() {
+                std::unique_lock<std::mutex> guard(lock_);
+                while (true) {
+                    if (due_.empty()) {
+                        wake_.wait(guard);
+                        continue;
+                    }
+                    auto first = due_.begin();
+                    if (std::chrono::steady_clock::now() < first->first) {
+                        wake_.wait_until(guard, first->first);
+                        continue;
+                    }
+                    auto handle = first->second.lock();
+                    due_.erase(first);
+                    guard.unlock();
+                    if (handle) {
+                        handle->expire();
+                    }
+                    guard.lock();
+                }
+            }
+
+        public:
+            DeadlineTimer() {
+                std::thread([this]() { run(); }).detach();
+            }
+
+            void schedule(std::chrono::steady_clock::time_point when, const std::shared_ptr<OperationHandle>& handle) {
+                std::lock_guard<std::mutex> guard(lock_);
+                due_.emplace(when, handle);
+                wake_.notify_one();
+            }
+        };
+
+        // Never destroyed, its thread may be waiting until the process exits
+        DeadlineTimer& deadline_timer() {
+            static auto* timer = new DeadlineTimer();
+            return *timer;
+        }
+
+    } // namespace
+
+    OperationHandle::~OperationHandle() {
+        // Dropped before admission let it run
+        if (!op && waiter && admission) {
+            admission->withdraw(waiter, false);
+        }
+    }
+
+    void OperationHandle::launch(std::shared_ptr<AdmissionController::Ticket> slot, const Exec& exec) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (state->done) {
+            return; // expired or cancelled while queued, the slot goes straight back
+        }
+        waiter.reset();
+        ticket = slot;
+        try {
+            op = exec(ContextWrapper::completion_handler(pv_name, state, breaker, admission, std::move(slot)));
+        } catch (const std::exception& e) {
+            state->fail(e.what());
+            ticket->release();
+        }
+    }
+
+    void OperationHandle::expire() {
+        if (state->done) {
+            return; // the result came first
+        }
+        std::shared_ptr<pvxs::client::Operation> running;
+        std::shared_ptr<AdmissionController::Ticket> slot;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (!op) {
+                // Still queued. If a slot was granted meanwhile, launch() finds the operation failed
+                if (waiter) {
+                    admission->withdraw(waiter, true);
+                }
+                state->fail("Timeout waiting for admission");
+                return;
+            }
+            running = op;
+            slot = ticket;
+        }
+        running->cancel();
+        // cancel() is synchronous, so the result cannot arrive after this check
+        if (state->done) {
+            return;
+        }
+        // Same as a synchronous call which got no answer in time. Recorded before waiters
+        // wake, so they see the circuit as the timeout left it
+        if (breaker) {
+            breaker->record_timeout(pv_name);
+        }
+        state->fail("Timeout");
+        if (slot) {
+            slot->release();
+        }
+    }
+
+    void OperationHandle::cancel() {
+        std::shared_ptr<pvxs::client::Operation> running;
+        std::shared_ptr<AdmissionController::Ticket> slot;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (!op) {
+                if (waiter) {
+                    admission->withdraw(waiter, false);
+                }
+                state->fail("Operation cancelled");
+                return;
+            }
+            running = op;
+            slot = ticket;
+        }
+        running->cancel();
+        // cancel() is synchronous, so no result can arrive after this
+        state->fail("Operation cancelled");
+        if (slot) {
+            slot->release();
+        }
+    }
+
+    void OperationHandle::arm(const std::shared_ptr<OperationHandle>& handle, double timeout) {
+        if (!std::isfinite(timeout)) {
+            return;
+        }
+        auto deadline = std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(std::max(timeout, 0.0)));
+        deadline_timer().schedule(deadline, handle);
+    }
+
+    // ============================================================================
+    // OperationWrapper implementation
+    // ============================================================================
+
+    OperationWrapper::OperationWrapper(std::shared_ptr<OperationHandle> handle)
+        : handle_(std::move(handle)), state_(handle_->state) {}
+
     std::unique_ptr<ValueWrapper> OperationWrapper::wait(double timeout) const {
-        if (!op_) {
+        if (!handle_) {
             throw PvxsError("Operation is null");
         }
         
-        try {
-            auto result = (*op_).wait(timeout);
-            return std::make_unique<ValueWrapper>(std::move(result));
-        } catch (const std::exception& e) {
-            throw PvxsError(std::string("Error waiting for operation: ") + e.what());
+        std::unique_lock<std::mutex> guard(state_->lock);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+        if (!state_->done_cv.wait_until(guard, deadline, [this]() { return state_->done.load(); })) {
+            throw PvxsError("Error waiting for operation: Timeout");
         }
+        if (!state_->error.empty()) {
+            throw PvxsError(std::string("Error waiting for operation: ") + state_->error);
+        }
+        return std::make_unique<ValueWrapper>(pvxs::Value(state_->value));
     }
 
     bool OperationWrapper::cancel() const {
-        if (!op_) {
+        if (!handle_) {
             return false;
         }
-        (*op_).cancel();
+        handle_->cancel();
         return true;
     }
 
     std::string OperationWrapper::name() const {
-        if (!op_) {
+        if (!handle_) {
             return "(null operation)";
         }
-        return (*op_).name();
+        return handle_->pv_name;
     }
 
     bool OperationWrapper::is_done() const {
-        if (!op_) {
+        if (!handle_) {
             return true; // null operation is "done" in a sense
         }
-        
-        try {
-            // Check if operation is complete by trying a very short wait
-            auto result = (*op_).wait(0.0);
-            return result.valid(); // If we get a valid result, it's done
-        } catch (const std::exception&) {
-            return false; // If exception thrown, probably not done yet
-        }
+        return state_->done;
     }
 
     std::unique_ptr<ValueWrapper> OperationWrapper::get_result() {
-        if (!op_) {
+        if (!handle_) {
             throw PvxsError("Operation is null");
         }
         
-        try {
-            auto result = op_->wait(0.0); // Non-blocking wait
-            if (!result.valid()) {
-                throw PvxsError("Operation result not available yet");
-            }
-            return std::make_unique<ValueWrapper>(std::move(result));
-        } catch (const std::exception& e) {
-            throw PvxsError(std::string("Error getting operation result: ") + e.what());
+        std::lock_guard<std::mutex> guard(state_->lock);
+        if (!state_->done) {
+            throw PvxsError("Operation result not available yet");
+        }
+        if (!state_->error.empty()) {
+            throw PvxsError(std::string("Error getting operation result: ") + state_->error);
         }
+        return std::make_unique<ValueWrapper>(pvxs::Value(state_->value));
     }
 
     bool OperationWrapper::wait_for_completion(uint64_t timeout_ms) {
-        if (!op_) {
+        if (!handle_) {
             return true; // null operation is already "complete"
         }
         
-        try {
-            // Convert milliseconds to seconds for PVXS
-            double timeout_seconds = timeout_ms / 1000.0;
-            auto result = op_->wait(timeout_seconds);
-            return result.valid();
-        } catch (const std::exception&) {
-            return false;
+        std::unique_lock<std::mutex> guard(state_->lock);
+        return state_->done_cv.wait_for(guard, std::chrono::milliseconds(timeout_ms),
+                                        [this]() { return state_->done.load(); });
+    }
+
+    // ============================================================================
+    // OperationSetWrapper implementation
+    // ============================================================================
+
+    size_t OperationSetWrapper::add(const OperationWrapper& op) {
+        if (!op.state()) {
+            throw PvxsError("Cannot add a null operation to an operation set");
+        }
+        ops_.push_back(op.state());
+        reported_.push_back(false);
+        op.state()->add_listener(signal_);
+        return ops_.size() - 1;
+    }
+
+    rust::Vec<size_t> OperationSetWrapper::wait_any(uint64_t timeout_ms) {
+        rust::Vec<size_t> finished;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+        std::unique_lock<std::mutex> guard(signal_->lock);
+        while (true) {
+            bool pending = false;
+            for (size_t i = 0; i < ops_.size(); ++i) {
+                if (reported_[i]) {
+                    continue;
+                }
+                if (ops_[i]->done) {
+                    reported_[i] = true;
+                    finished.push_back(i);
+                } else {
+                    pending = true;
+                }
+            }
+            if (!finished.empty() || !pending) {
+                // Nothing left which could still finish, don't sit out the deadline
+                return finished;
+            }
+            if (signal_->cv.wait_until(guard, deadline) == std::cv_status::timeout) {
+                // One last scan, a completion may have raced with the deadline
+                for (size_t i = 0; i < ops_.size(); ++i) {
+                    if (!reported_[i] && ops_[i]->done) {
+                        reported_[i] = true;
+                        finished.push_back(i);
+                    }
+                }
+                return finished;
+            }
+        }
+    }
+
+    rust::Vec<size_t> OperationSetWrapper::wait_all(uint64_t timeout_ms) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+        std::unique_lock<std::mutex> guard(signal_->lock);
+        signal_->cv.wait_until(guard, deadline, [this]() {
+            for (const auto& state : ops_) {
+                if (!state->done) {
+                    return false;
+                }
+            }
+            return true;
+        });
+
+        rust::Vec<size_t> finished;
+        for (size_t i = 0; i < ops_.size(); ++i) {
+            if (ops_[i]->done) {
+                reported_[i] = true;
+                finished.push_back(i);
+            }
+        }
+        return finished;
+    }
+
+    std::unique_ptr<OperationWrapper> ContextWrapper::start_async(
+        const char* operation,
+        const std::string& pv_name,
+        double timeout,
+        OperationHandle::Exec exec) {
+        
+        // Known-dead PVs fail fast without queueing
+        if (breaker_) {
+            breaker_->admit(pv_name);
+        }
+        auto handle = std::make_shared<OperationHandle>();
+        handle->pv_name = pv_name;
+        handle->state = std::make_shared<OperationState>();
+        handle->state->trace(operation, pv_name);
+        handle->breaker = breaker_;
+        handle->admission = admission_;
+        if (!admission_) {
+            handle->op = exec(completion_handler(pv_name, handle->state, breaker_, nullptr, nullptr));
+        } else {
+            // Runs here if a slot is free, otherwise on the thread which gives one back
+            std::weak_ptr<OperationHandle> weak(handle);
+            auto waiter = admission_->enqueue(pv_name, priority_, [weak, exec](std::shared_ptr<AdmissionController::Ticket> ticket) {
+                if (auto queued = weak.lock()) {
+                    queued->launch(std::move(ticket), exec);
+                }
+            });
+            std::lock_guard<std::mutex> guard(handle->lock);
+            if (!handle->op) {
+                handle->waiter = std::move(waiter);
+            }
         }
+        OperationHandle::arm(handle, timeout);
+        return std::make_unique<OperationWrapper>(std::move(handle));
     }
 
     std::unique_ptr<OperationWrapper> ContextWrapper::get_async(
@@ -84,8 +425,11 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            auto op = context_.get(pv_name).exec();
-            return std::make_unique<OperationWrapper>(std::move(op));
+            auto ctx = context_;
+            int priority = priority_;
+            return start_async("get", pv_name, timeout, [ctx, pv_name, priority](std::function<void(pvxs::client::Result&&)>&& done) mutable {
+                return ctx.get(pv_name).priority(priority).result(std::move(done)).exec();
+            });
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in get_async for '") + pv_name + "': " + e.what());
         }
@@ -97,11 +441,14 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            auto op = context_.put(pv_name).build([value](pvxs::Value&& val) {
-                val["value"] = value;
-                return std::move(val);
-            }).exec();
-            return std::make_unique<OperationWrapper>(std::move(op));
+            auto ctx = context_;
+            int priority = priority_;
+            return start_async("put", pv_name, timeout, [ctx, pv_name, priority, value](std::function<void(pvxs::client::Result&&)>&& done) mutable {
+                return ctx.put(pv_name).priority(priority).build([value](pvxs::Value&& val) {
+                    val["value"] = value;
+                    return std::move(val);
+                }).result(std::move(done)).exec();
+            });
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in put_double_async for '") + pv_name + "': " + e.what());
         }
@@ -112,8 +459,11 @@ namespace pvxs_wrapper {
         double timeout) {
         
         try {
-            auto op = context_.info(pv_name).exec();
-            return std::make_unique<OperationWrapper>(std::move(op));
+            auto ctx = context_;
+            int priority = priority_;
+            return start_async("info", pv_name, timeout, [ctx, pv_name, priority](std::function<void(pvxs::client::Result&&)>&& done) mutable {
+                return ctx.info(pv_name).priority(priority).result(std::move(done)).exec();
+            });
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in info_async for '") + pv_name + "': " + e.what());
         }
@@ -203,8 +553,10 @@ namespace pvxs_wrapper {
             if (arguments_.valid()) {
                 builder = builder.arg("argument", arguments_);
             }
-            auto op = builder.exec();
-            return std::make_unique<OperationWrapper>(std::move(op));
+            int priority = owner_.priority_;
+            return owner_.start_async("rpc", pv_name_, timeout, [builder, priority](std::function<void(pvxs::client::Result&&)>&& done) mutable {
+                return builder.priority(priority).result(std::move(done)).exec();
+            });
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in RPC execute_async for '") + pv_name_ + "': " + e.what());
         }
@@ -274,5 +626,53 @@ namespace pvxs_wrapper {
     #endif
     }
 
+    rust::String operation_name(const OperationWrapper& op) {
+    #ifdef PVXS_ASYNC_ENABLED
+        return op.name();
+    #else
+        throw PvxsError("Async operations are not enabled. Compile with --features async to use async functionality.");
+    #endif
+    }
+
+    // ============================================================================
+    // Operation set functions for Rust FFI
+    // ============================================================================
+
+    std::unique_ptr<OperationSetWrapper> operation_set_create() {
+    #ifdef PVXS_ASYNC_ENABLED
+        return std::make_unique<OperationSetWrapper>();
+    #else
+        throw PvxsError("Async operations are not enabled. Compile with --features async to use async functionality.");
+    #endif
+    }
+
+    size_t operation_set_add(OperationSetWrapper& set, const OperationWrapper& op) {
+    #ifdef PVXS_ASYNC_ENABLED
+        return set.add(op);
+    #else
+        throw PvxsError("Async operations are not enabled. Compile with --features async to use async functionality.");
+    #endif
+    }
+
+    size_t operation_set_size(const OperationSetWrapper& set) {
+        return set.size();
+    }
+
+    rust::Vec<size_t> operation_set_wait_any(OperationSetWrapper& set, uint64_t timeout_ms) {
+    #ifdef PVXS_ASYNC_ENABLED
+        return set.wait_any(timeout_ms);
+    #else
+        throw PvxsError("Async operations are not enabled. Compile with --features async to use async functionality.");
+    #endif
+    }
+
+    rust::Vec<size_t> operation_set_wait_all(OperationSetWrapper& set, uint64_t timeout_ms) {
+    #ifdef PVXS_ASYNC_ENABLED
+        return set.wait_all(timeout_ms);
+    #else
+        throw PvxsError("Async operations are not enabled. Compile with --features async to use async functionality.");
+    #endif
+    }
+
     
 } // namespace pvxs_wrapper
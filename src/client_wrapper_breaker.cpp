@@ -0,0 +1,203 @@
+// client_wrapper_breaker.cpp - Circuit breaker and negative cache for unreachable PVs
+
+#include "wrapper.h"
+
+namespace pvxs_wrapper {
+
+    // Bound on the negative cache before expired names are swept out
+    static constexpr size_t NEGATIVE_CACHE_SWEEP_SIZE = 1024;
+
+    // ============================================================================
+    // CircuitBreaker implementation
+    // ============================================================================
+
+    bool CircuitBreaker::allows(const Circuit& circuit, clock::time_point now) const {
+        switch (circuit.state) {
+        case State::Open:
+            return now >= circuit.open_until;
+        case State::HalfOpen:
+            // Only one probe at a time, unless the previous one never reported back
+            return now >= circuit.probe_until;
+        default:
+            return true;
+        }
+    }
+
+    void CircuitBreaker::enter(Circuit& circuit, clock::time_point now) {
+        if (circuit.state == State::Closed) {
+            return;
+        }
+        // Open past its window, or half-open with a stale probe: this caller becomes the probe
+        circuit.state = State::HalfOpen;
+        circuit.probe_until = now + std::chrono::milliseconds(config_.open_ms);
+    }
+
+    void CircuitBreaker::fail(Circuit& circuit, clock::time_point now) {
+        circuit.failures++;
+        if (circuit.state == State::HalfOpen || circuit.failures >= config_.failure_threshold) {
+            circuit.state = State::Open;
+            circuit.open_until = now + std::chrono::milliseconds(config_.open_ms);
+        }
+    }
+
+    void CircuitBreaker::admit(const std::string& pv_name) {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto now = clock::now();
+
+        auto cached = unreachable_.find(pv_name);
+        if (cached != unreachable_.end()) {
+            if (now < cached->second) {
+                fast_fails_++;
+                throw PvxsError("PV '" + pv_name + "' recently failed to connect (negative cache)");
+            }
+            unreachable_.erase(cached);
+        }
+
+        auto pv = pvs_.find(pv_name);
+        if (pv != pvs_.end() && !allows(pv->second, now)) {
+            fast_fails_++;
+            throw PvxsError("Circuit open for PV '" + pv_name + "'");
+        }
+
+        Circuit* server = nullptr;
+        if (config_.per_server) {
+            auto peer = pv_server_.find(pv_name);
+            if (peer != pv_server_.end()) {
+                auto it = servers_.find(peer->second);
+                if (it != servers_.end()) {
+                    if (!allows(it->second, now)) {
+                        fast_fails_++;
+                        throw PvxsError("Circuit open for server " + peer->second + " serving PV '" + pv_name + "'");
+                    }
+                    server = &it->second;
+                }
+            }
+        }
+
+        // Both circuits let the call through, so only now take the probe slots
+        if (pv != pvs_.end()) {
+            enter(pv->second, now);
+        }
+        if (server) {
+            enter(*server, now);
+        }
+    }
+
+    void CircuitBreaker::record(const std::string& pv_name, const OperationState& state) {
+        if (state.disconnected) {
+            record_timeout(pv_name);
+            return;
+        }
+
+        // Any answer, including a remote error, proves the PV and its server are reachable
+        std::lock_guard<std::mutex> guard(lock_);
+        pvs_.erase(pv_name);
+        unreachable_.erase(pv_name);
+        if (!state.peer.empty()) {
+            pv_server_[pv_name] = state.peer;
+            servers_.erase(state.peer);
+        }
+    }
+
+    void CircuitBreaker::record_timeout(const std::string& pv_name) {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto now = clock::now();
+
+        fail(pvs_[pv_name], now);
+
+        auto peer = pv_server_.find(pv_name);
+        if (peer == pv_server_.end()) {
+            // Never connected, remember the name so repeated lookups fail fast
+            if (unreachable_.size() >= NEGATIVE_CACHE_SWEEP_SIZE) {
+                for (auto it = unreachable_.begin(); it != unreachable_.end();) {
+                    if (now >= it->second) {
+                        it = unreachable_.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+            unreachable_[pv_name] = now + std::chrono::milliseconds(config_.negative_ttl_ms);
+        } else if (config_.per_server) {
+            fail(servers_[peer->second], now);
+        }
+    }
+
+    CircuitBreaker::State CircuitBreaker::state(const std::string& pv_name) {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto now = clock::now();
+
+        auto cached = unreachable_.find(pv_name);
+        if (cached != unreachable_.end() && now < cached->second) {
+            return State::Unreachable;
+        }
+
+        // An open circuit whose window has passed admits the next caller as a probe
+        auto effective = [now](const Circuit& circuit) {
+            return circuit.state == State::Open && now >= circuit.open_until ? State::HalfOpen : circuit.state;
+        };
+
+        State result = State::Closed;
+        auto pv = pvs_.find(pv_name);
+        if (pv != pvs_.end()) {
+            result = effective(pv->second);
+        }
+        if (result == State::Closed && config_.per_server) {
+            auto peer = pv_server_.find(pv_name);
+            if (peer != pv_server_.end()) {
+                auto it = servers_.find(peer->second);
+                if (it != servers_.end()) {
+                    result = effective(it->second);
+                }
+            }
+        }
+        return result;
+    }
+
+    void CircuitBreaker::reset() {
+        std::lock_guard<std::mutex> guard(lock_);
+        pvs_.clear();
+        servers_.clear();
+        unreachable_.clear();
+        fast_fails_ = 0;
+    }
+
+    // ============================================================================
+    // Circuit breaker functions for Rust FFI
+    // ============================================================================
+
+    void context_enable_circuit_breaker(ContextWrapper& ctx, uint32_t failure_threshold, uint64_t open_ms,
+                                        uint64_t negative_ttl_ms, bool per_server) {
+        CircuitBreaker::Config config;
+        config.failure_threshold = failure_threshold;
+        config.open_ms = open_ms;
+        config.negative_ttl_ms = negative_ttl_ms;
+        config.per_server = per_server;
+        ctx.enable_circuit_breaker(config);
+    }
+
+    void context_disable_circuit_breaker(ContextWrapper& ctx) {
+        ctx.disable_circuit_breaker();
+    }
+
+    uint8_t context_circuit_state(const ContextWrapper& ctx, rust::Str pv_name) {
+        auto& breaker = ctx.circuit_breaker();
+        if (!breaker) {
+            return static_cast<uint8_t>(CircuitBreaker::State::Closed);
+        }
+        return static_cast<uint8_t>(breaker->state(std::string(pv_name)));
+    }
+
+    uint64_t context_circuit_fast_fail_count(const ContextWrapper& ctx) {
+        auto& breaker = ctx.circuit_breaker();
+        return breaker ? breaker->fast_fail_count() : 0;
+    }
+
+    void context_circuit_reset(ContextWrapper& ctx) {
+        auto& breaker = ctx.circuit_breaker();
+        if (breaker) {
+            breaker->reset();
+        }
+    }
+
+} // namespace pvxs_wrapper
@@ -1,8 +1,123 @@
 #include "wrapper.h"
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <sstream>
 
 namespace pvxs_wrapper {
 
+    // ============================================================================
+    // DuplicateFilter implementation
+    // ============================================================================
+
+    namespace {
+
+        // Exact comparison of two fields of the same type, without converting through strings where avoidable
+        bool same_content(const pvxs::Value& a, const pvxs::Value& b) {
+            if (a.valid() != b.valid()) {
+                return false;
+            }
+            if (!a.valid()) {
+                return true;
+            }
+            if (a.type() != b.type()) {
+                return false;
+            }
+            switch (a.storageType()) {
+            case pvxs::StoreType::Null:
+                return true;
+            case pvxs::StoreType::Bool:
+                return a.as<bool>() == b.as<bool>();
+            case pvxs::StoreType::Integer:
+                return a.as<int64_t>() == b.as<int64_t>();
+            case pvxs::StoreType::UInteger:
+                return a.as<uint64_t>() == b.as<uint64_t>();
+            case pvxs::StoreType::Real: {
+                // Bitwise, so a repeated NaN counts as a duplicate
+                double x = a.as<double>(), y = b.as<double>();
+                return std::memcmp(&x, &y, sizeof(double)) == 0;
+            }
+            case pvxs::StoreType::String:
+                return a.as<std::string>() == b.as<std::string>();
+            case pvxs::StoreType::Array: {
+                auto x = a.as<pvxs::shared_array<const void>>();
+                auto y = b.as<pvxs::shared_array<const void>>();
+                if (x.original_type() != y.original_type() || x.size() != y.size()) {
+                    return false;
+                }
+                if (x.data() == y.data()) {
+                    return true;
+                }
+                if (x.original_type() == pvxs::ArrayType::String) {
+                    auto xs = x.castTo<const std::string>();
+                    auto ys = y.castTo<const std::string>();
+                    return std::equal(xs.begin(), xs.end(), ys.begin());
+                }
+                if (x.original_type() == pvxs::ArrayType::Value) {
+                    auto xs = x.castTo<const pvxs::Value>();
+                    auto ys = y.castTo<const pvxs::Value>();
+                    for (size_t i = 0; i < xs.size(); i++) {
+                        if (!same_content(xs[i], ys[i])) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                return std::memcmp(x.data(), y.data(), x.size() * pvxs::elementSize(x.original_type())) == 0;
+            }
+            case pvxs::StoreType::Compound:
+                if (a.type() == pvxs::TypeCode::Struct) {
+                    auto ia = a.ichildren();
+                    auto ib = b.ichildren();
+                    auto it_b = ib.begin();
+                    for (auto it_a = ia.begin(); it_a != ia.end(); ++it_a, ++it_b) {
+                        if (!same_content(*it_a, *it_b)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                } else {
+                    // Union and Any members may differ in type, compare their printed form
+                    std::ostringstream x, y;
+                    x << a;
+                    y << b;
+                    return x.str() == y.str();
+                }
+            }
+            return false;
+        }
+
+    } // namespace
+
+    bool DuplicateFilter::is_duplicate(const pvxs::Value& update) {
+        bool duplicate = false;
+        if (previous_.valid()) {
+            bool compared = false;
+            duplicate = true;
+            for (const auto& field : fields_) {
+                auto current = update[field];
+                auto last = previous_[field];
+                if (!current.valid() && !last.valid()) {
+                    continue;
+                }
+                compared = true;
+                if (!same_content(current, last)) {
+                    duplicate = false;
+                    break;
+                }
+            }
+            // None of the selected fields exist, so nothing can be judged a duplicate
+            duplicate = duplicate && compared;
+        }
+        if (duplicate) {
+            suppressed_++;
+        } else {
+            passed_++;
+            previous_ = update;
+        }
+        return duplicate;
+    }
+
     // ============================================================================
     // MonitorWrapper implementation
     // ============================================================================
@@ -22,7 +137,12 @@ namespace pvxs_wrapper {
                 connect_ = context_.connect(pv_name_).exec();
                 
                 // Create the subscription with default masks (for backward compatibility)
-                auto sub = context_.monitor(pv_name_).maskConnected(true).maskDisconnected(true).exec();
+                Tracer::instant("monitor", "subscribe", pv_name_);
+                auto sub = context_.monitor(pv_name_)
+                    .priority(priority_)
+                    .maskConnected(true)
+                    .maskDisconnected(true)
+                    .exec();
                 monitor_ = std::move(sub);
             } catch (const std::exception& e) {
                 throw PvxsError(std::string("Error starting monitor for '") + pv_name_ + "': " + e.what());
@@ -56,14 +176,37 @@ namespace pvxs_wrapper {
         }
     }
 
+    pvxs::Value MonitorWrapper::pop_filtered() {
+        try {
+            while (true) {
+                auto result = monitor_->pop();
+                if (!result.valid() || !duplicates_ || !duplicates_->is_duplicate(result)) {
+                    return result;
+                }
+            }
+        } catch (const pvxs::client::Connected&) {
+            // The server may have restarted, let the first update after (re)connecting through
+            if (duplicates_) {
+                duplicates_->reset();
+            }
+            throw;
+        } catch (const pvxs::client::Disconnect&) {
+            if (duplicates_) {
+                duplicates_->reset();
+            }
+            throw;
+        }
+    }
+
     std::unique_ptr<ValueWrapper> MonitorWrapper::get_update(double timeout) {
+        TraceSpan span("monitor", "pop", pv_name_);
         if (!monitor_) {
             throw PvxsError("Monitor client error: '" + pv_name_ + "' doesn't have an active monitor");
         }
         
         try {
             // Use pop() to get the next update - PVXS doesn't have wait with timeout on Subscription
-            auto result = monitor_->pop();
+            auto result = pop_filtered();
             if (!result.valid()) {
                 throw PvxsError("No update available for '" + pv_name_ + "'");
             }
@@ -86,13 +229,14 @@ namespace pvxs_wrapper {
     }
 
     std::unique_ptr<ValueWrapper> MonitorWrapper::try_get_update() {
+        TraceSpan span("monitor", "pop", pv_name_);
         if (!monitor_) {
             throw PvxsError("Monitor client error: '" + pv_name_ + "' doesn't have an active monitor");
         }
         
         try {
             // Try to get update non-blocking
-            auto result = monitor_->pop();
+            auto result = pop_filtered();
             if (result.valid()) {
                 return std::make_unique<ValueWrapper>(std::move(result));
             } else {
@@ -116,13 +260,14 @@ namespace pvxs_wrapper {
     }
 
     std::unique_ptr<ValueWrapper> MonitorWrapper::pop() {
+        TraceSpan span("monitor", "pop", pv_name_);
         if (!monitor_) {
             throw PvxsError("Monitor client error: '" + pv_name_ + "' doesn't have an active monitor");
         }
         
         try {
             // PVXS-style pop() - returns update or throws exceptions for masked events
-            auto result = monitor_->pop();
+            auto result = pop_filtered();
             if (result.valid()) {
                 return std::make_unique<ValueWrapper>(std::move(result));
             } else {
@@ -215,6 +360,16 @@ namespace pvxs_wrapper {
         return monitor.pop();
     }
 
+    bool monitor_duplicate_stats(const MonitorWrapper& monitor, uint64_t& passed, uint64_t& suppressed) {
+        auto filter = monitor.duplicate_filter();
+        if (!filter) {
+            return false;
+        }
+        passed = filter->passed();
+        suppressed = filter->suppressed();
+        return true;
+    }
+
     // ============================================================================
     // MonitorBuilderWrapper implementation
     // ============================================================================
@@ -231,39 +386,70 @@ namespace pvxs_wrapper {
         rust_callback_ = callback;
     }
 
+    void MonitorBuilderWrapper::set_priority(int priority) {
+        if (priority < 0 || priority > 99) {
+            throw PvxsError("Priority must be between 0 and 99, got " + std::to_string(priority));
+        }
+        priority_ = priority;
+    }
+
+    void MonitorBuilderWrapper::suppress_duplicates(std::vector<std::string> fields) {
+        if (fields.empty()) {
+            fields = {"value", "alarm"};
+        }
+        suppress_duplicates_ = true;
+        duplicate_fields_ = std::move(fields);
+    }
+
+    void MonitorBuilderWrapper::record_option(const std::string& name, const std::string& value) {
+        if (name.empty()) {
+            throw PvxsError("pvRequest record option needs a name");
+        }
+        record_options_.emplace_back(name, value);
+    }
+
+    std::unique_ptr<MonitorWrapper> MonitorBuilderWrapper::build() {
+        auto builder = context_.monitor(pv_name_)
+            .priority(priority_)
+            .maskConnected(mask_connected_)
+            .maskDisconnected(mask_disconnected_);
+        for (const auto& option : record_options_) {
+            builder.record(option.first, option.second);
+        }
+        
+        // Create Connect object for tracking connection state
+        auto connect = context_.connect(pv_name_).exec();
+        
+        Tracer::instant("monitor", "subscribe", pv_name_);
+
+        // If we have a callback or are tracing, set up the PVXS event handler before exec
+        if (rust_callback_ || Tracer::enabled()) {
+            // Capture the callback in a lambda for PVXS
+            auto callback_ptr = rust_callback_;
+            auto pv_name = pv_name_;
+            builder.event([callback_ptr, pv_name](auto& subscription) {
+                Tracer::instant("monitor", "event", pv_name);
+                // Call the Rust callback function (no parameters)
+                if (callback_ptr) {
+                    callback_ptr();
+                }
+            });
+        }
+        auto subscription = builder.exec();
+        
+        // Create wrapper with the subscription, connect, callback, and mask settings
+        auto wrapper = std::make_unique<MonitorWrapper>(
+            std::move(subscription), pv_name_, context_, rust_callback_, mask_connected_, mask_disconnected_);
+        wrapper->set_connect(std::move(connect));
+        if (suppress_duplicates_) {
+            wrapper->suppress_duplicates(duplicate_fields_);
+        }
+        return wrapper;
+    }
+
     std::unique_ptr<MonitorWrapper> MonitorBuilderWrapper::exec() {
         try {
-            auto builder = context_.monitor(pv_name_)
-                .maskConnected(mask_connected_)
-                .maskDisconnected(mask_disconnected_);
-            
-            // Create Connect object for tracking connection state
-            auto connect = context_.connect(pv_name_).exec();
-            
-            // If we have a callback, set up the PVXS event handler and call exec in the chain
-            if (rust_callback_) {
-                // Capture the callback in a lambda for PVXS
-                auto callback_ptr = rust_callback_;
-                auto subscription = builder.event([callback_ptr](auto& subscription) {
-                    // Call the Rust callback function (no parameters)
-                    callback_ptr();
-                }).exec();
-                
-                // Create wrapper with the subscription, connect, callback, and mask settings
-                auto wrapper = std::make_unique<MonitorWrapper>(
-                    std::move(subscription), pv_name_, context_, rust_callback_, mask_connected_, mask_disconnected_);
-                wrapper->set_connect(std::move(connect));
-                return wrapper;
-            } else {
-                // No callback, just exec directly
-                auto subscription = builder.exec();
-                
-                // Create wrapper with the subscription, connect, and mask settings
-                auto wrapper = std::make_unique<MonitorWrapper>(
-                    std::move(subscription), pv_name_, context_, nullptr, mask_connected_, mask_disconnected_);
-                wrapper->set_connect(std::move(connect));
-                return wrapper;
-            }
+            return build();
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error creating monitor for '") + pv_name_ + "': " + e.what());
         }
@@ -273,18 +459,7 @@ namespace pvxs_wrapper {
         try {
             // Store callback ID for future use
             callback_id_ = callback_id;
-            
-            auto builder = context_.monitor(pv_name_)
-                .maskConnected(mask_connected_)
-                .maskDisconnected(mask_disconnected_);
-                
-            // For now, we'll store the callback ID and use it later
-            // TODO: Implement proper callback mechanism
-            auto subscription = builder.exec();
-            
-            // Create wrapper with the subscription
-            return std::make_unique<MonitorWrapper>(
-                std::move(subscription), pv_name_, context_);
+            return build();
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error creating monitor with callback for '") + pv_name_ + "': " + e.what());
         }
@@ -316,6 +491,22 @@ namespace pvxs_wrapper {
         builder.set_event_callback(rust_fn);
     }
 
+    void monitor_builder_priority(MonitorBuilderWrapper& builder, int32_t priority) {
+        builder.set_priority(priority);
+    }
+
+    void monitor_builder_suppress_duplicates(MonitorBuilderWrapper& builder, rust::Vec<rust::String> fields) {
+        std::vector<std::string> names;
+        for (const auto& field : fields) {
+            names.emplace_back(std::string(field));
+        }
+        builder.suppress_duplicates(std::move(names));
+    }
+
+    void monitor_builder_record_option(MonitorBuilderWrapper& builder, rust::Str name, rust::Str value) {
+        builder.record_option(std::string(name), std::string(value));
+    }
+
     std::unique_ptr<MonitorWrapper> monitor_builder_exec(MonitorBuilderWrapper& builder) {
         return builder.exec();
     }
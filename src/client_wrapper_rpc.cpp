@@ -43,7 +43,7 @@ namespace pvxs_wrapper {
             if (arguments_.valid()) {
                 builder = builder.arg("argument", arguments_);
             }
-            auto result = builder.exec()->wait(timeout);
+            auto result = owner_.exec_guarded("rpc", pv_name_, builder, timeout);
             return std::make_unique<ValueWrapper>(std::move(result));
         } catch (const std::exception& e) {
             throw PvxsError(std::string("Error in RPC execute_sync for '") + pv_name_ + "': " + e.what());
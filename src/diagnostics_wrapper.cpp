@@ -0,0 +1,75 @@
+// diagnostics_wrapper.cpp - Process memory and pvxs instance counters for long-running checks
+
+#include "wrapper.h"
+#include <pvxs/util.h>
+#include <fstream>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(__linux__)
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#endif
+
+namespace pvxs_wrapper {
+
+// ============================================================================
+// Diagnostics functions for Rust FFI
+// ============================================================================
+
+void diagnostics_instance_counts(rust::Vec<rust::String>& names, rust::Vec<uint64_t>& counts) {
+    try {
+        std::map<std::string, size_t> snapshot;
+        pvxs::instanceSnapshot(snapshot);
+        for (const auto& entry : snapshot) {
+            names.push_back(rust::String(entry.first));
+            counts.push_back(static_cast<uint64_t>(entry.second));
+        }
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error reading instance counters: ") + e.what());
+    }
+}
+
+uint64_t diagnostics_resident_memory() {
+#if defined(__linux__)
+    // Second field of statm is the resident set in pages
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0, resident = 0;
+    if (statm >> size >> resident) {
+        return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        return static_cast<uint64_t>(info.resident_size);
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+bool diagnostics_allocator_stats(uint64_t& in_use, uint64_t& free_bytes, uint64_t& mapped) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    auto info = mallinfo2();
+    in_use = static_cast<uint64_t>(info.uordblks) + static_cast<uint64_t>(info.hblkhd);
+    free_bytes = static_cast<uint64_t>(info.fordblks);
+    mapped = static_cast<uint64_t>(info.arena) + static_cast<uint64_t>(info.hblkhd);
+    return true;
+#elif defined(__GLIBC__)
+    // Older glibc only has the int counters, which wrap past 2 GiB
+    auto info = mallinfo();
+    in_use = static_cast<uint64_t>(static_cast<unsigned>(info.uordblks)) + static_cast<unsigned>(info.hblkhd);
+    free_bytes = static_cast<unsigned>(info.fordblks);
+    mapped = static_cast<uint64_t>(static_cast<unsigned>(info.arena)) + static_cast<unsigned>(info.hblkhd);
+    return true;
+#else
+    in_use = free_bytes = mapped = 0;
+    return false;
+#endif
+}
+
+} // namespace pvxs_wrapper
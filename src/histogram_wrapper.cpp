@@ -0,0 +1,359 @@
+// histogram_wrapper.cpp - Histograms of PV values, maintained per update and served as SharedPVs
+
+#include "wrapper.h"
+#include <algorithm>
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    // Elements binned per pass over the index scratch buffer
+    const size_t chunk_size = 4096;
+
+    // Below this many samples, counters are incremented directly
+    const size_t lane_threshold = 64;
+
+    pvxs::Value histogram_prototype() {
+        using pvxs::Member;
+        using pvxs::TypeCode;
+        auto def = pvxs::nt::NTScalar{TypeCode::UInt64A}.build();
+        def += {
+            Member(TypeCode::Float64, "low"),
+            Member(TypeCode::Float64, "high"),
+            Member(TypeCode::UInt64, "underflow"),
+            Member(TypeCode::UInt64, "overflow"),
+            Member(TypeCode::UInt64, "entries"),
+        };
+        return def.create();
+    }
+
+    // Counter of each element: 0 below low (NaN included), bins + 1 at or above high. Branch-free
+    // and with a fixed trip count, so compilers vectorize it for every element type
+    template <typename T>
+    void bin_indices(const T *data, size_t count, double low, double scale, double top, int32_t *out) {
+        for (size_t i = 0; i < count; i++) {
+            double x = (static_cast<double>(data[i]) - low) * scale + 1.0;
+            x = x >= 1.0 ? x : 0.0;
+            x = x < top ? x : top;
+            out[i] = static_cast<int32_t>(x);
+        }
+    }
+
+    // Four sets of counters, so runs of samples in the same bin don't wait on each other's increments
+    void count_indices(const int32_t *indices, size_t count, uint64_t *lanes, size_t width) {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            lanes[indices[i]]++;
+            lanes[width + indices[i + 1]]++;
+            lanes[2 * width + indices[i + 2]]++;
+            lanes[3 * width + indices[i + 3]]++;
+        }
+        for (; i < count; i++) {
+            lanes[indices[i]]++;
+        }
+    }
+
+} // namespace
+
+// ============================================================================
+// HistogramWrapper implementation
+// ============================================================================
+
+void HistogramWrapper::State::reset(const Config& config) {
+    this->config = config;
+    scale = static_cast<double>(config.bins) / (config.high - config.low);
+    slice_length = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(config.window / static_cast<double>(config.slices)));
+    slice_end = std::chrono::steady_clock::now() + slice_length;
+    auto width = config.bins + 2;
+    counts.assign(width, 0);
+    slices.assign(config.window > 0.0 ? config.slices * width : 0, 0);
+    slice = 0;
+    indices.resize(chunk_size);
+    lanes.resize(4 * width);
+    stats = Stats();
+}
+
+void HistogramWrapper::State::advance(std::chrono::steady_clock::time_point now) {
+    if (slices.empty() || now < slice_end) {
+        return;
+    }
+    auto width = counts.size();
+    // Each slice which ended since the last update leaves the window, at most all of them
+    for (size_t step = 0; step < config.slices && now >= slice_end; step++) {
+        slice = (slice + 1) % config.slices;
+        auto expiring = &slices[slice * width];
+        for (size_t b = 0; b < width; b++) {
+            counts[b] -= expiring[b];
+        }
+        std::fill(expiring, expiring + width, 0);
+        slice_end += slice_length;
+        stats.expired++;
+    }
+    if (now >= slice_end) {
+        // Idle for longer than the window
+        slice_end = now + slice_length;
+    }
+}
+
+template <typename T>
+void HistogramWrapper::State::bin(const T* data, size_t count) {
+    auto width = counts.size();
+    auto current = slices.empty() ? nullptr : &slices[slice * width];
+    double top = static_cast<double>(config.bins + 1);
+    if (count < lane_threshold) {
+        for (size_t i = 0; i < count; i++) {
+            int32_t index;
+            bin_indices(data + i, 1, config.low, scale, top, &index);
+            counts[index]++;
+            if (current) {
+                current[index]++;
+            }
+        }
+    } else {
+        std::fill(lanes.begin(), lanes.end(), 0);
+        for (size_t at = 0; at < count; at += chunk_size) {
+            auto n = std::min(chunk_size, count - at);
+            bin_indices(data + at, n, config.low, scale, top, indices.data());
+            count_indices(indices.data(), n, lanes.data(), width);
+        }
+        for (size_t b = 0; b < width; b++) {
+            auto added = lanes[b] + lanes[width + b] + lanes[2 * width + b] + lanes[3 * width + b];
+            counts[b] += added;
+            if (current) {
+                current[b] += added;
+            }
+        }
+    }
+    stats.samples += count;
+}
+
+void HistogramWrapper::State::add(const pvxs::Value& update) {
+    auto value = update["value"];
+    std::lock_guard<std::mutex> guard(lock);
+    if (value && !value.isMarked()) {
+        // Only metadata changed
+        return;
+    }
+    advance(std::chrono::steady_clock::now());
+
+    auto type = value ? value.type() : pvxs::TypeCode::Null;
+    if (type.isarray()) {
+        auto elements = value.as<pvxs::shared_array<const void>>();
+        auto data = elements.data();
+        auto count = elements.size();
+        switch (elements.original_type()) {
+        case pvxs::ArrayType::Int8:
+            bin(static_cast<const int8_t *>(data), count);
+            break;
+        case pvxs::ArrayType::Int16:
+            bin(static_cast<const int16_t *>(data), count);
+            break;
+        case pvxs::ArrayType::Int32:
+            bin(static_cast<const int32_t *>(data), count);
+            break;
+        case pvxs::ArrayType::Int64:
+            bin(static_cast<const int64_t *>(data), count);
+            break;
+        case pvxs::ArrayType::UInt8:
+            bin(static_cast<const uint8_t *>(data), count);
+            break;
+        case pvxs::ArrayType::UInt16:
+            bin(static_cast<const uint16_t *>(data), count);
+            break;
+        case pvxs::ArrayType::UInt32:
+            bin(static_cast<const uint32_t *>(data), count);
+            break;
+        case pvxs::ArrayType::UInt64:
+            bin(static_cast<const uint64_t *>(data), count);
+            break;
+        case pvxs::ArrayType::Float32:
+            bin(static_cast<const float *>(data), count);
+            break;
+        case pvxs::ArrayType::Float64:
+            bin(static_cast<const double *>(data), count);
+            break;
+        default:
+            if (count) {
+                stats.failed++;
+                return;
+            }
+            break;
+        }
+    } else {
+        auto storage = value ? value.storageType() : pvxs::StoreType::Null;
+        if (storage != pvxs::StoreType::Integer && storage != pvxs::StoreType::UInteger &&
+            storage != pvxs::StoreType::Real) {
+            stats.failed++;
+            return;
+        }
+        double sample = value.as<double>();
+        bin(&sample, 1);
+    }
+    stats.updates++;
+    post();
+}
+
+void HistogramWrapper::State::post() {
+    auto update = pv->get_template().cloneEmpty();
+    pvxs::shared_array<uint64_t> bins(counts.begin() + 1, counts.end() - 1);
+    update["value"] = bins.freeze();
+    update["low"] = config.low;
+    update["high"] = config.high;
+    update["underflow"] = counts.front();
+    update["overflow"] = counts.back();
+    uint64_t entries = 0;
+    for (auto count : counts) {
+        entries += count;
+    }
+    update["entries"] = entries;
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+    update["timeStamp.secondsPastEpoch"] = static_cast<int64_t>(seconds.count());
+    update["timeStamp.nanoseconds"] = static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count());
+    pv->post_value(ValueWrapper(std::move(update)));
+}
+
+HistogramWrapper::HistogramWrapper(const pvxs::client::Context& ctx, int priority, const std::string& pv_name)
+    : context_(ctx), priority_(priority), pv_name_(pv_name) {
+    state_->reset(Config());
+    state_->pv->open(ValueWrapper(histogram_prototype()));
+    state_->post();
+}
+
+HistogramWrapper::~HistogramWrapper() {
+    stop();
+}
+
+void HistogramWrapper::configure(const Config& config) {
+    if (is_running()) {
+        throw PvxsError("Histogram of '" + pv_name_ + "' can't be changed while running");
+    }
+    if (config.bins == 0 || config.bins > (1u << 24)) {
+        throw PvxsError("Histogram needs 1 to 16777216 bins");
+    }
+    if (!(config.high > config.low)) {
+        throw PvxsError("Histogram high edge must be above its low edge");
+    }
+    if (!(config.window >= 0.0) || config.slices == 0) {
+        throw PvxsError("Histogram window must be >= 0 and have at least one slice");
+    }
+    std::lock_guard<std::mutex> guard(state_->lock);
+    state_->reset(config);
+    state_->post();
+}
+
+void HistogramWrapper::publish(ServerWrapper& server, const std::string& name) {
+    server.add_pv(name, *state_->pv);
+}
+
+void HistogramWrapper::start() {
+    if (is_running()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(state_->lock);
+        state_->reset(state_->config);
+        state_->post();
+    }
+    auto state = state_;
+    try {
+        subscription_ = context_.monitor(pv_name_)
+            .priority(priority_)
+            .maskConnected(true)
+            .maskDisconnected(true)
+            .event([state](pvxs::client::Subscription& sub) {
+                while (true) {
+                    try {
+                        auto update = sub.pop();
+                        if (!update) {
+                            break;
+                        }
+                        state->add(update);
+                    } catch (const pvxs::client::Finished&) {
+                        break;
+                    } catch (const std::exception&) {
+                        std::lock_guard<std::mutex> guard(state->lock);
+                        state->stats.failed++;
+                    }
+                }
+            })
+            .exec();
+    } catch (const std::exception& e) {
+        subscription_.reset();
+        throw PvxsError(std::string("Error starting histogram of '") + pv_name_ + "': " + e.what());
+    }
+}
+
+void HistogramWrapper::stop() {
+    subscription_.reset();
+}
+
+std::vector<uint64_t> HistogramWrapper::counts() const {
+    std::lock_guard<std::mutex> guard(state_->lock);
+    return std::vector<uint64_t>(state_->counts.begin() + 1, state_->counts.end() - 1);
+}
+
+HistogramWrapper::Stats HistogramWrapper::stats() const {
+    std::lock_guard<std::mutex> guard(state_->lock);
+    auto stats = state_->stats;
+    stats.underflow = state_->counts.front();
+    stats.overflow = state_->counts.back();
+    return stats;
+}
+
+// ============================================================================
+// Bridge functions for histograms
+// ============================================================================
+
+std::unique_ptr<HistogramWrapper> context_histogram_create(ContextWrapper& ctx, rust::Str pv_name, uint64_t bins,
+                                                           double low, double high, double window, uint64_t slices) {
+    auto histogram = ctx.histogram_create(std::string(pv_name));
+    HistogramWrapper::Config config;
+    config.bins = static_cast<size_t>(bins);
+    config.low = low;
+    config.high = high;
+    config.window = window;
+    config.slices = static_cast<size_t>(slices);
+    histogram->configure(config);
+    return histogram;
+}
+
+void histogram_publish(HistogramWrapper& histogram, ServerWrapper& server, rust::Str name) {
+    histogram.publish(server, std::string(name));
+}
+
+void histogram_start(HistogramWrapper& histogram) {
+    histogram.start();
+}
+
+void histogram_stop(HistogramWrapper& histogram) {
+    histogram.stop();
+}
+
+bool histogram_is_running(const HistogramWrapper& histogram) {
+    return histogram.is_running();
+}
+
+rust::Vec<uint64_t> histogram_counts(const HistogramWrapper& histogram) {
+    rust::Vec<uint64_t> counts;
+    auto bins = histogram.counts();
+    counts.reserve(bins.size());
+    for (auto count : bins) {
+        counts.push_back(count);
+    }
+    return counts;
+}
+
+void histogram_stats(const HistogramWrapper& histogram, uint64_t& updates, uint64_t& samples, uint64_t& failed,
+                     uint64_t& expired, uint64_t& underflow, uint64_t& overflow) {
+    auto stats = histogram.stats();
+    updates = stats.updates;
+    samples = stats.samples;
+    failed = stats.failed;
+    expired = stats.expired;
+    underflow = stats.underflow;
+    overflow = stats.overflow;
+}
+
+} // namespace pvxs_wrapper
@@ -16,6 +16,7 @@
 //! - **MONITOR operations**: Subscribe to value changes with callbacks
 //! - **MonitorBuilder**: Advanced monitor configuration with PVXS-style API
 //! - **Array support**: Read/write arrays of double, int32, and string values
+//! - **Native-width types**: bool, integer and float32 scalars and arrays via [`NativeType`]
 //! - **Server support**: Create and manage PVAccess servers
 //! - Thread-safe client context
 //! 
@@ -25,7 +26,7 @@ pub mod bridge;
 use cxx::UniquePtr;
 use std::fmt;
 
-pub use bridge::{ContextWrapper, ValueWrapper, RpcWrapper, MonitorWrapper, MonitorBuilderWrapper, ServerWrapper, SharedPVWrapper, StaticSourceWrapper};
+pub use bridge::{ContextWrapper, ValueWrapper, RpcWrapper, MonitorWrapper, MonitorBuilderWrapper, ServerWrapper, SharedPVWrapper, StaticSourceWrapper, RelayWrapper, AlarmSummaryWrapper, ArrayRecorderWrapper, GroupPVWrapper, MappedArrayPVWrapper, PostStagerWrapper, AutosaveWrapper, PVSnapshotWrapper, HistogramWrapper};
 
 // Re-export for testing callbacks
 pub use std::sync::atomic::{AtomicUsize, Ordering};
@@ -105,6 +106,12 @@ pub struct Context {
 }
 
 impl Context {
+    /// Default operation priority, used for bulk traffic
+    pub const PRIORITY_DEFAULT: i32 = 0;
+
+    /// Highest operation priority
+    pub const PRIORITY_MAX: i32 = 99;
+
     /// Create a new Context configured from environment variables
     /// 
     /// Reads configuration from `EPICS_PVA_*` environment variables:
@@ -127,6 +134,63 @@ impl Context {
         let inner = bridge::create_context_from_env()?;
         Ok(Self { inner })
     }
+
+    /// Get a handle on the process-wide shared context
+    /// 
+    /// The first call creates a context from the `EPICS_PVA_*` environment
+    /// variables, like [`Context::from_env`]. Later calls return handles on
+    /// the same context, so its sockets, worker threads, search traffic and
+    /// channel cache are shared by every library in the process. The context
+    /// is closed when the last handle is dropped, and re-created by the next
+    /// call.
+    /// 
+    /// Circuit breaker, admission control and priority settings belong to
+    /// each handle, so libraries sharing the context do not affect each
+    /// other's policies.
+    /// 
+    /// Use [`Context::from_env`] for a private context, or
+    /// [`Context::set_sharing_enabled`] to make every call to this function
+    /// return a private context.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the context cannot be created.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// use pvxs_sys::Context;
+    /// 
+    /// let mut a = Context::shared()?;
+    /// let mut b = Context::shared()?;
+    /// assert!(a.is_shared() && b.is_shared());
+    /// assert_eq!(Context::shared_handle_count(), 2);
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn shared() -> Result<Self> {
+        let inner = bridge::create_context_shared()?;
+        Ok(Self { inner })
+    }
+
+    /// Enable or disable the process-wide shared context (enabled by default)
+    /// 
+    /// While disabled, [`Context::shared`] returns private contexts. Handles
+    /// obtained earlier keep working.
+    pub fn set_sharing_enabled(enabled: bool) {
+        bridge::context_set_sharing_enabled(enabled);
+    }
+
+    /// Number of live handles on the process-wide shared context
+    /// 
+    /// Zero when the shared context does not currently exist.
+    pub fn shared_handle_count() -> usize {
+        bridge::context_shared_handle_count()
+    }
+
+    /// Check if this is a handle on the process-wide shared context
+    pub fn is_shared(&self) -> bool {
+        bridge::context_is_shared(&self.inner)
+    }
     
     /// Perform a synchronous GET operation
     /// 
@@ -358,6 +422,37 @@ impl Context {
         Ok(())
     }
 
+    /// Perform a synchronous PUT operation with a value of any [`NativeType`]
+    /// 
+    /// The value is sent at its own width and converted by the server if
+    /// the PV's value field has another numeric type.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// ctx.put_native("my:pv:adc", 1234u16, 5.0).expect("PUT failed");
+    /// ```
+    pub fn put_native<T: NativeType>(&mut self, pv_name: &str, value: T, timeout: f64) -> Result<()> {
+        T::put(self.inner.pin_mut(), pv_name, value, timeout)?;
+        Ok(())
+    }
+
+    /// Perform a synchronous PUT operation with an array of any [`NativeType`]
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// ctx.put_native_array("my:pv:image", &[0u8, 127, 255], 5.0).expect("PUT failed");
+    /// ```
+    pub fn put_native_array<T: NativeType>(&mut self, pv_name: &str, value: &[T], timeout: f64) -> Result<()> {
+        T::put_array(self.inner.pin_mut(), pv_name, value, timeout)?;
+        Ok(())
+    }
+
 
     
     /// Get type information about a process variable
@@ -471,6 +566,373 @@ impl Context {
         let inner = bridge::context_monitor_builder_create(self.inner.pin_mut(), pv_name.to_string())?;
         Ok(MonitorBuilder { inner })
     }
+
+    /// Create a relay republishing `upstream` through a local SharedPV
+    /// 
+    /// The relay subscribes to `upstream` with this context and posts each
+    /// update to `target`. Updates are converted and posted on the client
+    /// worker thread, they never cross into Rust. See [`Relay`] for the
+    /// available transforms.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `upstream` - Name of the PV to subscribe to
+    /// * `target` - SharedPV receiving the updates, must be open before [`Relay::start`]
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Context, Server, NTScalarMetadataBuilder};
+    /// let mut server = Server::from_env()?;
+    /// let pv = server.create_pv_double("BEAM:CURRENT:mA", 0.0, NTScalarMetadataBuilder::new())?;
+    /// server.start()?;
+    /// 
+    /// let mut ctx = Context::from_env()?;
+    /// let mut relay = ctx.relay("BEAM:CURRENT", &pv)?;
+    /// relay.scale(1000.0, 0.0)?.decimate(10)?;
+    /// relay.start()?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn relay(&mut self, upstream: &str, target: &SharedPV) -> Result<Relay> {
+        let inner = bridge::context_relay_create(self.inner.pin_mut(), upstream.to_string(), &target.inner)?;
+        Ok(Relay { inner })
+    }
+
+    /// Create an alarm summary engine subscribing through this context
+    /// 
+    /// See [`AlarmSummary`].
+    pub fn alarm_summary(&mut self) -> Result<AlarmSummary> {
+        let inner = bridge::context_alarm_summary_create(self.inner.pin_mut())?;
+        Ok(AlarmSummary { inner })
+    }
+
+    /// Create a recorder writing each update of an array PV to a file
+    /// 
+    /// See [`ArrayRecorder`] for the file layout.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the configuration is invalid (a ring without
+    /// capacity, or an empty queue).
+    pub fn array_recorder(&mut self, pv_name: &str, path: &str, config: ArrayRecorderConfig) -> Result<ArrayRecorder> {
+        let inner = bridge::context_array_recorder_create(self.inner.pin_mut(), pv_name, path, config.capacity,
+                                                          config.ring, config.max_queued, config.drop_cache)?;
+        Ok(ArrayRecorder { inner })
+    }
+
+    /// Create a histogram of the values of a PV
+    /// 
+    /// See [`Histogram`].
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the configuration is invalid (no bins, an empty
+    /// range, a negative window or no slices).
+    pub fn histogram(&mut self, pv_name: &str, config: HistogramConfig) -> Result<Histogram> {
+        let inner = bridge::context_histogram_create(self.inner.pin_mut(), pv_name, config.bins, config.low,
+                                                     config.high, config.window, config.slices)?;
+        Ok(Histogram { inner })
+    }
+
+    /// Enable the circuit breaker for GET, PUT and INFO operations
+    /// 
+    /// Once a PV (or the server which last answered for it) has failed
+    /// `failure_threshold` times in a row, further calls fail immediately
+    /// for `open_duration` seconds. After that a single call is let through
+    /// as a probe: success closes the circuit, failure re-opens it. Names
+    /// which time out without ever connecting are kept in a negative cache
+    /// for `negative_cache_ttl` seconds and fail immediately as well.
+    /// 
+    /// Enabling replaces any previous breaker and forgets its state.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `failure_threshold` is zero.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Context, CircuitBreakerConfig};
+    /// let mut ctx = Context::from_env()?;
+    /// ctx.enable_circuit_breaker(CircuitBreakerConfig::new()
+    ///     .failure_threshold(2)
+    ///     .open_duration(10.0))?;
+    /// 
+    /// // The first call waits for the full timeout, later ones fail fast
+    /// for _ in 0..3 {
+    ///     if let Err(e) = ctx.get("dead:ioc:pv", 2.0) {
+    ///         println!("{}", e);
+    ///     }
+    /// }
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn enable_circuit_breaker(&mut self, config: CircuitBreakerConfig) -> Result<()> {
+        bridge::context_enable_circuit_breaker(
+            self.inner.pin_mut(),
+            config.failure_threshold,
+            (config.open_duration.max(0.0) * 1000.0) as u64,
+            (config.negative_cache_ttl.max(0.0) * 1000.0) as u64,
+            config.per_server,
+        )?;
+        Ok(())
+    }
+
+    /// Disable the circuit breaker
+    pub fn disable_circuit_breaker(&mut self) {
+        bridge::context_disable_circuit_breaker(self.inner.pin_mut());
+    }
+
+    /// Get the state of the circuit guarding a PV
+    /// 
+    /// Always [`CircuitState::Closed`] when the circuit breaker is disabled.
+    pub fn circuit_state(&self, pv_name: &str) -> CircuitState {
+        match bridge::context_circuit_state(&self.inner, pv_name) {
+            1 => CircuitState::Open,
+            2 => CircuitState::HalfOpen,
+            3 => CircuitState::Unreachable,
+            _ => CircuitState::Closed,
+        }
+    }
+
+    /// Number of calls rejected by the circuit breaker without touching the network
+    pub fn circuit_fast_fail_count(&self) -> u64 {
+        bridge::context_circuit_fast_fail_count(&self.inner)
+    }
+
+    /// Close every circuit and clear the negative cache
+    pub fn reset_circuit_breaker(&mut self) {
+        bridge::context_circuit_reset(self.inner.pin_mut());
+    }
+
+    /// Enable admission control for GET, PUT, INFO and RPC operations
+    /// 
+    /// Limits how many operations of this context may be outstanding at
+    /// once. Synchronous callers over the limit wait in a FIFO queue until a
+    /// slot frees up; the wait counts against the operation's own timeout.
+    /// Async starts (`start_get` and friends) return at once and their
+    /// operation waits in the same queue, so its timeout covers the time
+    /// spent queued as well as the time spent running. A per-server
+    /// limit applies to PVs once the server answering for them is known from
+    /// an earlier reply.
+    /// 
+    /// Operations already admitted keep their slots when the limits change.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if neither limit is set.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Context, AdmissionConfig};
+    /// let mut ctx = Context::from_env()?;
+    /// ctx.enable_admission_control(AdmissionConfig::new()
+    ///     .max_in_flight(64)
+    ///     .max_per_server(16))?;
+    /// 
+    /// let stats = ctx.admission_stats();
+    /// println!("{} queued, mean wait {:.3}s", stats.queued, stats.mean_wait());
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn enable_admission_control(&mut self, config: AdmissionConfig) -> Result<()> {
+        bridge::context_enable_admission_control(self.inner.pin_mut(), config.max_in_flight, config.max_per_server)?;
+        Ok(())
+    }
+
+    /// Disable admission control
+    pub fn disable_admission_control(&mut self) {
+        bridge::context_disable_admission_control(self.inner.pin_mut());
+    }
+
+    /// Set the priority of operations and monitors created from now on
+    /// 
+    /// The priority is sent to servers as the PVA channel priority, and
+    /// orders the admission queue when admission control is enabled: queued
+    /// operations with a higher priority are dispatched first, FIFO within
+    /// the same priority. Use a high priority for interactive control
+    /// writes and leave bulk reads at [`Context::PRIORITY_DEFAULT`].
+    /// 
+    /// Client-side ordering only applies with admission control enabled
+    /// (see [`Context::enable_admission_control`]). Without it operations
+    /// are sent as soon as they are started, whatever their priority, and
+    /// only the server may act on the channel priority.
+    /// 
+    /// Channels are shared per name and priority, so the same PV accessed
+    /// at two priorities uses two channels.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `priority` - From [`Context::PRIORITY_DEFAULT`] (0) to [`Context::PRIORITY_MAX`] (99)
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the priority is out of range.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// let mut ctx = Context::from_env()?;
+    /// ctx.set_priority(Context::PRIORITY_MAX)?;
+    /// ctx.put_double("magnet:setpoint", 12.5, 1.0)?;
+    /// ctx.set_priority(Context::PRIORITY_DEFAULT)?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn set_priority(&mut self, priority: i32) -> Result<()> {
+        bridge::context_set_priority(self.inner.pin_mut(), priority)?;
+        Ok(())
+    }
+
+    /// Get the priority of new operations
+    pub fn priority(&self) -> i32 {
+        bridge::context_get_priority(&self.inner)
+    }
+
+    /// Get admission control counters
+    /// 
+    /// All zero when admission control is disabled.
+    pub fn admission_stats(&self) -> AdmissionStats {
+        let (mut in_flight, mut queued, mut admitted, mut waited, mut timed_out) = (0, 0, 0, 0, 0);
+        let (mut total_wait_us, mut max_wait_us) = (0u64, 0u64);
+        bridge::context_admission_stats(&self.inner, &mut in_flight, &mut queued, &mut admitted,
+                                        &mut waited, &mut timed_out, &mut total_wait_us, &mut max_wait_us);
+        AdmissionStats {
+            in_flight,
+            queued,
+            admitted,
+            waited,
+            timed_out,
+            total_wait: total_wait_us as f64 / 1e6,
+            max_wait: max_wait_us as f64 / 1e6,
+        }
+    }
+}
+
+/// Limits for client-side admission control
+/// 
+/// See [`Context::enable_admission_control`]. A limit of 0 means unlimited.
+#[derive(Clone, Debug, Default)]
+pub struct AdmissionConfig {
+    max_in_flight: u32,
+    max_per_server: u32,
+}
+
+impl AdmissionConfig {
+    /// Create a configuration without limits
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Set the maximum number of outstanding operations for the context
+    pub fn max_in_flight(mut self, operations: u32) -> Self {
+        self.max_in_flight = operations;
+        self
+    }
+
+    /// Set the maximum number of outstanding operations per server
+    pub fn max_per_server(mut self, operations: u32) -> Self {
+        self.max_per_server = operations;
+        self
+    }
+}
+
+/// Admission control counters of a context
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct AdmissionStats {
+    /// Operations currently holding a slot
+    pub in_flight: u64,
+    /// Callers currently waiting for a slot
+    pub queued: u64,
+    /// Total operations admitted
+    pub admitted: u64,
+    /// Operations which had to wait in the queue before being admitted
+    pub waited: u64,
+    /// Callers which gave up because their timeout passed while queued
+    pub timed_out: u64,
+    /// Total time spent queued by admitted operations, in seconds
+    pub total_wait: f64,
+    /// Longest time an admitted operation spent queued, in seconds
+    pub max_wait: f64,
+}
+
+impl AdmissionStats {
+    /// Mean time spent queued by operations which had to wait, in seconds
+    pub fn mean_wait(&self) -> f64 {
+        if self.waited == 0 {
+            0.0
+        } else {
+            self.total_wait / self.waited as f64
+        }
+    }
+}
+
+/// Configuration for the client-side circuit breaker
+/// 
+/// See [`Context::enable_circuit_breaker`].
+#[derive(Clone, Debug)]
+pub struct CircuitBreakerConfig {
+    failure_threshold: u32,
+    open_duration: f64,
+    negative_cache_ttl: f64,
+    per_server: bool,
+}
+
+impl CircuitBreakerConfig {
+    /// Create a configuration with default values
+    /// 
+    /// Defaults: 3 consecutive failures, 5 second fast-fail window,
+    /// 30 second negative cache, per-server tracking enabled.
+    pub fn new() -> Self {
+        Self {
+            failure_threshold: 3,
+            open_duration: 5.0,
+            negative_cache_ttl: 30.0,
+            per_server: true,
+        }
+    }
+
+    /// Set the number of consecutive failures which opens a circuit
+    pub fn failure_threshold(mut self, failures: u32) -> Self {
+        self.failure_threshold = failures;
+        self
+    }
+
+    /// Set how long (in seconds) an open circuit fails fast before probing
+    pub fn open_duration(mut self, seconds: f64) -> Self {
+        self.open_duration = seconds;
+        self
+    }
+
+    /// Set how long (in seconds) a name which never connected stays in the negative cache
+    pub fn negative_cache_ttl(mut self, seconds: f64) -> Self {
+        self.negative_cache_ttl = seconds;
+        self
+    }
+
+    /// Also track failures per server, so one dead IOC trips all of its PVs
+    pub fn per_server(mut self, enabled: bool) -> Self {
+        self.per_server = enabled;
+        self
+    }
+}
+
+impl Default for CircuitBreakerConfig {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// State of the circuit guarding a PV
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum CircuitState {
+    /// Calls go through normally
+    Closed,
+    /// Calls fail immediately
+    Open,
+    /// The next call is let through as a probe
+    HalfOpen,
+    /// The name recently failed to connect and is in the negative cache
+    Unreachable,
 }
 
 // Context is safe to send between threads
@@ -553,6 +1015,60 @@ impl Context {
         self.wait_for_operation(operation).await
     }
     
+    /// Start a GET operation and return a handle without waiting for it
+    /// 
+    /// Unlike [`Context::get_async`], the returned [`Operation`] can be added
+    /// to an [`OperationSet`] so that many requests can be waited on together.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `pv_name` - The name of the process variable
+    /// * `timeout` - Deadline in seconds, after which the operation is cancelled and fails with a timeout
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Context, OperationSet};
+    /// let mut ctx = Context::from_env()?;
+    /// let mut set = OperationSet::new()?;
+    /// let ops: Vec<_> = ["pv:a", "pv:b", "pv:c"].iter()
+    ///     .map(|name| ctx.start_get(name, 5.0))
+    ///     .collect::<Result<_, _>>()?;
+    /// for op in &ops {
+    ///     set.add(op)?;
+    /// }
+    /// let finished = set.wait_all(5.0)?;
+    /// println!("{} of {} finished", finished.len(), ops.len());
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn start_get(&mut self, pv_name: &str, timeout: f64) -> Result<Operation> {
+        let inner = bridge::context_get_async(self.inner.pin_mut(), pv_name, timeout)?;
+        Ok(Operation { inner })
+    }
+
+    /// Start a PUT operation with a double value and return a handle without waiting for it
+    /// 
+    /// # Arguments
+    /// 
+    /// * `pv_name` - The name of the process variable
+    /// * `value` - The value to write
+    /// * `timeout` - Deadline in seconds, after which the operation is cancelled and fails with a timeout
+    pub fn start_put_double(&mut self, pv_name: &str, value: f64, timeout: f64) -> Result<Operation> {
+        let inner = bridge::context_put_double_async(self.inner.pin_mut(), pv_name, value, timeout)?;
+        Ok(Operation { inner })
+    }
+
+    /// Start an INFO operation and return a handle without waiting for it
+    /// 
+    /// # Arguments
+    /// 
+    /// * `pv_name` - The name of the process variable
+    /// * `timeout` - Deadline in seconds, after which the operation is cancelled and fails with a timeout
+    pub fn start_info(&mut self, pv_name: &str, timeout: f64) -> Result<Operation> {
+        let inner = bridge::context_info_async(self.inner.pin_mut(), pv_name, timeout)?;
+        Ok(Operation { inner })
+    }
+    
     /// Wait for an operation to complete using Tokio's async runtime
     async fn wait_for_operation(&self, mut operation: cxx::UniquePtr<bridge::OperationWrapper>) -> Result<Value> {
         use tokio::time::{sleep, Duration};
@@ -569,36 +1085,197 @@ impl Context {
     }
 }
 
-/// A PVAccess value container
-/// 
-/// Represents a structured data value returned from PVXS operations.
-/// Values have a hierarchical structure with named fields.
-/// 
-/// # Field Access
-/// 
-/// Values are accessed by field name. Common fields include:
-/// - `"value"`: The primary data value
-/// - `"alarm.severity"`: Alarm severity level
-/// - `"alarm.status"`: Alarm status code
-/// - `"timeStamp.secondsPastEpoch"`: Timestamp seconds
-/// 
-/// # Example
-/// 
-/// ```no_run
-/// # use pvxs_sys::{Context, Value};
-/// # let mut ctx = Context::from_env().unwrap();
-/// let value: Value = ctx.get("my:pv:name", 5.0).unwrap();
+/// Handle to an in-flight client operation (GET, PUT, INFO or RPC)
 /// 
-/// // Access different field types
-/// let v = value.get_field_double("value").unwrap();
-/// let severity = value.get_field_int32("alarm.severity").unwrap();
-/// ```
-pub struct Value {
-    inner: UniquePtr<ValueWrapper>,
+/// Created by [`Context::start_get`], [`Context::start_put_double`],
+/// [`Context::start_info`] and [`Rpc::start_execute`]. Completion is
+/// signalled from the PVXS worker thread, so checking or waiting on an
+/// operation never polls the network.
+#[cfg(feature = "async")]
+pub struct Operation {
+    inner: UniquePtr<bridge::OperationWrapper>,
 }
 
-impl Value {
-    /// Check if this value is valid
+#[cfg(feature = "async")]
+impl Operation {
+    /// Check if the operation has finished, successfully or not
+    pub fn is_done(&self) -> bool {
+        bridge::operation_is_done(&self.inner)
+    }
+
+    /// Get the result of a finished operation
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the operation has not finished yet, or if it failed.
+    pub fn result(&mut self) -> Result<Value> {
+        let inner = bridge::operation_get_result(self.inner.pin_mut())?;
+        Ok(Value { inner })
+    }
+
+    /// Block until the operation finishes or the timeout expires
+    /// 
+    /// # Arguments
+    /// 
+    /// * `timeout` - Maximum time to wait in seconds
+    /// 
+    /// # Returns
+    /// 
+    /// `true` if the operation finished within the timeout.
+    pub fn wait(&mut self, timeout: f64) -> Result<bool> {
+        let timeout_ms = (timeout.max(0.0) * 1000.0) as u64;
+        Ok(bridge::operation_wait_for_completion(self.inner.pin_mut(), timeout_ms)?)
+    }
+
+    /// Cancel the operation
+    /// 
+    /// An operation which has not finished yet then fails, so anything
+    /// waiting on it returns instead of waiting out its timeout.
+    pub fn cancel(&mut self) {
+        bridge::operation_cancel(self.inner.pin_mut());
+    }
+
+    /// Get the name of the PV this operation targets
+    pub fn name(&self) -> Result<String> {
+        Ok(bridge::operation_name(&self.inner)?)
+    }
+}
+
+// Operation completion state is synchronized in C++
+#[cfg(feature = "async")]
+unsafe impl Send for Operation {}
+
+/// A set of operations which can be waited on together
+/// 
+/// All operations in a set notify one shared completion signal, so waiting
+/// on hundreds of concurrent requests costs a single blocking wait instead
+/// of polling each operation in turn. Indices returned by the wait calls are
+/// the ones handed out by [`OperationSet::add`].
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Context, OperationSet};
+/// let mut ctx = Context::from_env()?;
+/// let mut set = OperationSet::new()?;
+/// let mut ops = Vec::new();
+/// for i in 0..100 {
+///     let op = ctx.start_get(&format!("pv:{}", i), 5.0)?;
+///     set.add(&op)?;
+///     ops.push(op);
+/// }
+/// loop {
+///     let finished = set.wait_any(1.0)?;
+///     if finished.is_empty() {
+///         break; // deadline passed with nothing new
+///     }
+///     for index in finished {
+///         match ops[index].result() {
+///             Ok(value) => println!("{}: {}", index, value),
+///             Err(e) => println!("{} failed: {}", index, e),
+///         }
+///     }
+/// }
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+#[cfg(feature = "async")]
+pub struct OperationSet {
+    inner: UniquePtr<bridge::OperationSetWrapper>,
+}
+
+#[cfg(feature = "async")]
+impl OperationSet {
+    /// Create an empty operation set
+    pub fn new() -> Result<Self> {
+        let inner = bridge::operation_set_create()?;
+        Ok(Self { inner })
+    }
+
+    /// Add an operation to the set
+    /// 
+    /// The set only observes the operation; the caller keeps ownership and
+    /// uses it to fetch the result.
+    /// 
+    /// # Returns
+    /// 
+    /// The index of the operation within the set.
+    pub fn add(&mut self, op: &Operation) -> Result<usize> {
+        Ok(bridge::operation_set_add(self.inner.pin_mut(), &op.inner)?)
+    }
+
+    /// Number of operations in the set
+    pub fn len(&self) -> usize {
+        bridge::operation_set_size(&self.inner)
+    }
+
+    /// Check if the set is empty
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Wait until at least one operation finishes
+    /// 
+    /// Returns the indices of operations which finished since the previous
+    /// call to `wait_any`. Each index is reported once. An empty vector means
+    /// the timeout expired without any new completion, or that every
+    /// operation had already been reported, in which case it returns at once.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `timeout` - Global deadline for this call in seconds
+    pub fn wait_any(&mut self, timeout: f64) -> Result<Vec<usize>> {
+        let timeout_ms = (timeout.max(0.0) * 1000.0) as u64;
+        Ok(bridge::operation_set_wait_any(self.inner.pin_mut(), timeout_ms)?)
+    }
+
+    /// Wait until every operation finishes
+    /// 
+    /// Returns the indices of all finished operations in ascending order.
+    /// If the result is shorter than [`OperationSet::len`], the timeout
+    /// expired first.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `timeout` - Global deadline for this call in seconds
+    pub fn wait_all(&mut self, timeout: f64) -> Result<Vec<usize>> {
+        let timeout_ms = (timeout.max(0.0) * 1000.0) as u64;
+        Ok(bridge::operation_set_wait_all(self.inner.pin_mut(), timeout_ms)?)
+    }
+}
+
+#[cfg(feature = "async")]
+unsafe impl Send for OperationSet {}
+
+/// A PVAccess value container
+/// 
+/// Represents a structured data value returned from PVXS operations.
+/// Values have a hierarchical structure with named fields.
+/// 
+/// # Field Access
+/// 
+/// Values are accessed by field name. Common fields include:
+/// - `"value"`: The primary data value
+/// - `"alarm.severity"`: Alarm severity level
+/// - `"alarm.status"`: Alarm status code
+/// - `"timeStamp.secondsPastEpoch"`: Timestamp seconds
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Context, Value};
+/// # let mut ctx = Context::from_env().unwrap();
+/// let value: Value = ctx.get("my:pv:name", 5.0).unwrap();
+/// 
+/// // Access different field types
+/// let v = value.get_field_double("value").unwrap();
+/// let severity = value.get_field_int32("alarm.severity").unwrap();
+/// ```
+pub struct Value {
+    inner: UniquePtr<ValueWrapper>,
+}
+
+impl Value {
+    /// Check if this value is valid
     /// 
     /// Returns `false` if the value is empty or uninitialized.
     pub fn is_valid(&self) -> bool {
@@ -735,6 +1412,35 @@ impl Value {
     pub fn get_field_string_array(&self, field_name: &str) -> Result<Vec<String>> {
         Ok(bridge::value_get_field_string_array(&self.inner, field_name.to_string())?)
     }
+
+    /// Get a field value as any [`NativeType`]
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the field doesn't exist or cannot be
+    /// converted to `T`.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// let value = ctx.get("my:pv:counter", 5.0).unwrap();
+    /// let counter: u64 = value.get_field_native("value").unwrap();
+    /// ```
+    pub fn get_field_native<T: NativeType>(&self, field_name: &str) -> Result<T> {
+        Ok(T::get(&self.inner, field_name.to_string())?)
+    }
+
+    /// Get a field value as an array of any [`NativeType`]
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the field doesn't exist or cannot be
+    /// converted to an array of `T`.
+    pub fn get_field_native_array<T: NativeType>(&self, field_name: &str) -> Result<Vec<T>> {
+        Ok(T::get_array(&self.inner, field_name.to_string())?)
+    }
 }
 
 impl fmt::Display for Value {
@@ -1056,6 +1762,28 @@ impl Monitor {
     pub fn name(&self) -> String {
         bridge::monitor_get_name(&self.inner)
     }
+
+    /// Counters of the duplicate filter
+    /// 
+    /// Returns `None` unless the monitor was built with
+    /// [`MonitorBuilder::suppress_duplicates`].
+    pub fn duplicate_stats(&self) -> Option<DuplicateStats> {
+        let mut stats = DuplicateStats::default();
+        if bridge::monitor_duplicate_stats(&self.inner, &mut stats.passed, &mut stats.suppressed) {
+            Some(stats)
+        } else {
+            None
+        }
+    }
+}
+
+/// Counters of a monitor's duplicate filter
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct DuplicateStats {
+    /// Updates delivered to Rust
+    pub passed: u64,
+    /// Updates dropped because they repeated the previous one
+    pub suppressed: u64,
 }
 
 /// MonitorBuilder provides a builder pattern for creating monitors with advanced configuration
@@ -1130,6 +1858,165 @@ impl MonitorBuilder {
         self
     }
     
+    /// Set the PVA channel priority of the subscription
+    /// 
+    /// Defaults to the priority of the context (see [`Context::set_priority`]).
+    /// Values are clamped to the range 0 to 99.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// let monitor = ctx.monitor_builder("MY:PV")?
+    ///     .priority(Context::PRIORITY_MAX)
+    ///     .exec()?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn priority(mut self, priority: i32) -> Self {
+        let priority = priority.clamp(Context::PRIORITY_DEFAULT, Context::PRIORITY_MAX);
+        let _ = bridge::monitor_builder_priority(self.inner.pin_mut(), priority);
+        self
+    }
+    
+    /// Drop updates which repeat the previous update
+    /// 
+    /// Each update is compared in C++ with the last one delivered, and
+    /// dropped before it reaches Rust if all the given fields are exactly
+    /// equal. An empty list compares `value` and `alarm`, which ignores
+    /// updates that only carry a new timestamp. The comparison restarts
+    /// after a connection event. See [`Monitor::duplicate_stats`] for the
+    /// counters.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `fields` - Field names to compare, e.g. `["value", "alarm.severity"]`
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// let mut monitor = ctx.monitor_builder("MY:PV")?
+    ///     .suppress_duplicates(&[])
+    ///     .exec()?;
+    /// // ... later
+    /// if let Some(stats) = monitor.duplicate_stats() {
+    ///     println!("{} duplicates dropped", stats.suppressed);
+    /// }
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn suppress_duplicates(mut self, fields: &[&str]) -> Self {
+        let fields = fields.iter().map(|f| f.to_string()).collect();
+        let _ = bridge::monitor_builder_suppress_duplicates(self.inner.pin_mut(), fields);
+        self
+    }
+
+    /// Add a pvRequest record option (`record[name=value]`)
+    /// 
+    /// Options are interpreted by the server. Servers of this crate
+    /// understand `dec`, `interval`, `deadband`, `deadbandPercent`, `start`,
+    /// `count` and `stride`, see [`MonitorBuilder::server_decimation`],
+    /// [`MonitorBuilder::server_min_interval`], [`MonitorBuilder::server_deadband`]
+    /// and [`MonitorBuilder::server_slice`].
+    pub fn record(mut self, name: &str, value: &str) -> Self {
+        let _ = bridge::monitor_builder_record_option(self.inner.pin_mut(), name, value);
+        self
+    }
+
+    /// Ask the server to forward only one post out of every `every`
+    /// 
+    /// Sent as `record[dec=N]`. The server folds the skipped posts into the
+    /// next forwarded one, so no field change is lost, and other clients of
+    /// the same PV keep the full rate. When posts stop before the next one
+    /// is due, the folded posts are sent on their own once the PV has been
+    /// quiet for as long as `every` posts took at the rate seen so far, so
+    /// the last value always arrives. Servers which don't know the option
+    /// ignore it.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// let monitor = ctx.monitor_builder("FAST:PV")?
+    ///     .server_decimation(10)
+    ///     .exec()?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn server_decimation(self, every: u32) -> Self {
+        self.record("dec", &every.to_string())
+    }
+
+    /// Ask the server to leave at least `interval` between updates
+    /// 
+    /// Sent as `record[interval=seconds]`. Posts arriving sooner are folded
+    /// together and sent once the interval has passed, so the last value is
+    /// always delivered.
+    pub fn server_min_interval(self, interval: std::time::Duration) -> Self {
+        self.record("interval", &interval.as_secs_f64().to_string())
+    }
+
+    /// Ask the server to hold back value changes of at most `band`
+    /// 
+    /// Sent as `record[deadband=X]`. The server compares each scalar value
+    /// with the last one sent to this subscriber, so slow drifts still get
+    /// through once they add up. Updates which change the alarm or other
+    /// fields besides `value` and `timeStamp` are always sent; array and
+    /// string values are not filtered.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// let monitor = ctx.monitor_builder("TEMP:PV")?
+    ///     .server_deadband(0.5)
+    ///     .exec()?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn server_deadband(self, band: f64) -> Self {
+        self.record("deadband", &band.to_string())
+    }
+
+    /// Ask the server to hold back value changes of at most `percent` of the last value sent
+    /// 
+    /// Sent as `record[deadbandPercent=P]`. Combined with
+    /// [`MonitorBuilder::server_deadband`], a change leaving either band is sent.
+    pub fn server_deadband_percent(self, percent: f64) -> Self {
+        self.record("deadbandPercent", &percent.to_string())
+    }
+
+    /// Ask the server to send only part of an array value
+    /// 
+    /// Sent as `record[start=N,count=N,stride=N]`. The server picks every
+    /// `stride`-th element from `start`, at most `count` of them, for this
+    /// subscriber only. Ranges past the end of the array are cut short.
+    /// The PV's value must be an array.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `start` - Index of the first element
+    /// * `count` - Maximum number of elements to send
+    /// * `stride` - Distance between elements, at least 1
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::Context;
+    /// # let mut ctx = Context::from_env().unwrap();
+    /// // Every tenth point of the first 10000
+    /// let monitor = ctx.monitor_builder("WAVEFORM:PV")?
+    ///     .server_slice(0, 1000, 10)
+    ///     .exec()?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn server_slice(self, start: usize, count: usize, stride: usize) -> Self {
+        self.record("start", &start.to_string())
+            .record("count", &count.to_string())
+            .record("stride", &stride.to_string())
+    }
+    
     /// Set an event callback function that will be invoked when the subscription queue becomes not-empty
     /// 
     /// This follows the PVXS pattern where the callback is invoked when events are available,
@@ -1299,6 +2186,18 @@ impl Rpc {
 /// Async implementation for RPC
 #[cfg(feature = "async")]
 impl Rpc {
+    /// Start the RPC call and return a handle without waiting for it
+    /// 
+    /// The returned [`Operation`] can be added to an [`OperationSet`].
+    /// 
+    /// # Arguments
+    /// 
+    /// * `timeout` - Deadline in seconds, after which the operation is cancelled and fails with a timeout
+    pub fn start_execute(mut self, timeout: f64) -> Result<Operation> {
+        let inner = bridge::rpc_execute_async(self.inner.pin_mut(), timeout)?;
+        Ok(Operation { inner })
+    }
+
     /// Execute the RPC call asynchronously
     /// 
     /// # Arguments
@@ -1394,6 +2293,36 @@ impl Server {
         let inner = bridge::server_create_isolated()?;
         Ok(Self { inner })
     }
+
+    /// Create a client context which talks to this server directly
+    /// 
+    /// The context is configured with the server's own address and ports
+    /// instead of the `EPICS_PVA_*` environment variables, and doesn't
+    /// broadcast searches. Paired with [`Server::create_isolated`], each test
+    /// gets a private server and client on ephemeral ports, so tests can run
+    /// in parallel even when they serve the same PV names.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the context cannot be created.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// use pvxs_sys::{Server, NTScalarMetadataBuilder};
+    /// 
+    /// let mut server = Server::create_isolated()?;
+    /// server.create_pv_double("test:pv", 42.0, NTScalarMetadataBuilder::new())?;
+    /// server.start()?;
+    /// 
+    /// let mut ctx = server.client_context()?;
+    /// assert_eq!(ctx.get("test:pv", 5.0)?.get_field_double("value")?, 42.0);
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn client_context(&self) -> Result<Context> {
+        let inner = bridge::server_create_client_context(&self.inner)?;
+        Ok(Context { inner })
+    }
     
     /// Start the server
     /// 
@@ -1445,6 +2374,71 @@ impl Server {
         Ok(())
     }
     
+    /// Save the type, metadata and value of every mailbox PV to a snapshot file
+    /// 
+    /// Covers the PVs made by the `create_pv_*` methods, except computed PVs.
+    /// The file is written aside and renamed over `path`, so a crash leaves
+    /// either the previous snapshot or the new one. Returns the number of PVs
+    /// saved.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if a PV has a field type snapshots can't hold (unions,
+    /// variants and structure arrays) or the file can't be written.
+    pub fn save_snapshot(&self, path: impl AsRef<std::path::Path>) -> Result<usize> {
+        let path = path.as_ref();
+        let path = path.to_str()
+            .ok_or_else(|| PvxsError::new(format!("Path '{}' is not valid UTF-8", path.display())))?;
+        Ok(bridge::server_save_snapshot(&self.inner, path)? as usize)
+    }
+
+    /// Serve every PV of a snapshot file written by [`Server::save_snapshot`]
+    /// 
+    /// The file is memory-mapped and read in one pass: each PV is opened
+    /// straight away with its saved type, metadata and value, without being
+    /// created with defaults and posted again. PVs of the same type share
+    /// one type definition. All PVs are added to the server under one lock,
+    /// or none of them if a name is already served.
+    /// 
+    /// Returns the handles of the restored mailbox PVs by name. Restored enum
+    /// PVs refuse PUTs of an index outside their choices, like the PVs made
+    /// by [`Server::create_pv_enum`].
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the file is missing, truncated or corrupt, or if
+    /// one of its PV names is already served.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Server, NTScalarMetadataBuilder};
+    /// let mut server = Server::from_env()?;
+    /// let mut pvs = server.warm_start("/var/lib/ioc/pvs.snap")?;
+    /// server.start()?;
+    /// 
+    /// if let Some(setpoint) = pvs.get_mut("MOTOR:SETPOINT") {
+    ///     setpoint.post_double(1.5)?;
+    /// }
+    /// // ... and from time to time
+    /// server.save_snapshot("/var/lib/ioc/pvs.snap")?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn warm_start(&mut self, path: impl AsRef<std::path::Path>) -> Result<std::collections::HashMap<String, SharedPV>> {
+        let path = path.as_ref();
+        let path = path.to_str()
+            .ok_or_else(|| PvxsError::new(format!("Path '{}' is not valid UTF-8", path.display())))?;
+        let mut snapshot = bridge::server_load_snapshot(self.inner.pin_mut(), path)?;
+        let len = bridge::pv_snapshot_len(&snapshot);
+        let mut pvs = std::collections::HashMap::with_capacity(len as usize);
+        for index in 0..len {
+            let name = bridge::pv_snapshot_name(&snapshot, index);
+            let inner = bridge::pv_snapshot_take(snapshot.pin_mut(), index)?;
+            pvs.insert(name, SharedPV { inner });
+        }
+        Ok(pvs)
+    }
+    
     /// Add a static source to the server
     /// 
     /// Static sources provide collections of PVs with a common configuration.
@@ -1472,16 +2466,92 @@ impl Server {
     pub fn udp_port(&self) -> u16 {
         bridge::server_get_udp_port(&self.inner)
     }
-    
-    /// Create and add a new mailbox SharedPV with a double value and metadata
+
+    /// Enable per-client send limits for monitor subscriptions
     /// 
-    /// Mailbox PVs allow both reading and writing by clients.
-    /// The PV is automatically added to the server with the given name.
+    /// Counts the updates queued for each client across all of its
+    /// subscriptions. A client whose queue reaches the alert threshold is
+    /// reported as slow and the alert callback fires; once it reaches the
+    /// queue limit, further updates for its subscriptions are squashed into
+    /// one held-back update carrying the latest value, which is sent as soon
+    /// as the client catches up. Other clients are not held back by a slow
+    /// one and keep receiving every update.
     /// 
-    /// # Arguments
+    /// Applies to subscriptions made after the call to PVs created through
+    /// this server's `create_pv_*` methods.
     /// 
-    /// * `name` - The PV name that clients will use
-    /// * `initial_value` - Initial value for the PV
+    /// # Errors
+    /// 
+    /// Returns an error if neither a queue limit nor an alert threshold is
+    /// set, or if the alert threshold exceeds the queue limit.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Server, SendLimits};
+    /// extern "C" fn slow_client() {
+    ///     eprintln!("a client is falling behind");
+    /// }
+    /// 
+    /// let mut server = Server::from_env()?;
+    /// server.enable_send_limits(SendLimits::new()
+    ///     .max_queued_per_client(1000)
+    ///     .alert_threshold(500)
+    ///     .on_alert(slow_client))?;
+    /// server.start()?;
+    /// 
+    /// for client in server.slow_clients() {
+    ///     println!("{} has {} updates queued", client.peer, client.queued);
+    /// }
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn enable_send_limits(&mut self, limits: SendLimits) -> Result<()> {
+        let callback = limits.on_alert.map_or(0, |callback| callback as usize);
+        bridge::server_enable_send_limits(self.inner.pin_mut(), limits.max_queued_per_client,
+                                          limits.alert_threshold, callback)?;
+        Ok(())
+    }
+
+    /// Disable per-client send limits for subscriptions made from now on
+    pub fn disable_send_limits(&mut self) {
+        bridge::server_disable_send_limits(self.inner.pin_mut());
+    }
+
+    /// Get send-queue statistics of every client with a limited subscription
+    /// 
+    /// Empty when send limits are disabled.
+    pub fn client_send_stats(&self) -> Vec<ClientSendStats> {
+        bridge::server_send_clients(&self.inner)
+            .into_iter()
+            .filter_map(|peer| {
+                let mut stats = ClientSendStats { peer, ..Default::default() };
+                let found = bridge::server_client_send_stats(&self.inner, &stats.peer, &mut stats.subscriptions,
+                                                             &mut stats.queued, &mut stats.max_queued,
+                                                             &mut stats.squashed, &mut stats.alerts, &mut stats.slow);
+                found.then_some(stats)
+            })
+            .collect()
+    }
+
+    /// Get the clients currently over the alert threshold
+    pub fn slow_clients(&self) -> Vec<ClientSendStats> {
+        self.client_send_stats().into_iter().filter(|client| client.slow).collect()
+    }
+
+    /// Total number of slow-client alerts since send limits were enabled
+    pub fn send_alert_count(&self) -> u64 {
+        bridge::server_send_alert_count(&self.inner)
+    }
+    
+    /// Create and add a new mailbox SharedPV with a double value and metadata
+    /// 
+    /// Mailbox PVs allow both reading and writing by clients.
+    /// The PV is automatically added to the server with the given name.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `name` - The PV name that clients will use
+    /// * `initial_value` - Initial value for the PV
     /// * `metadata` - Metadata for the scalar PV
     /// 
     /// # Example
@@ -1591,6 +2661,118 @@ impl Server {
         Ok(pv)
     }
 
+    /// Create and add a new mailbox SharedPV with a value of any [`NativeType`]
+    /// 
+    /// The value field keeps the width of `T`, e.g. `UInt16` for `u16`.
+    /// The PV is automatically added to the server with the given name.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `name` - The PV name that clients will use
+    /// * `initial_value` - Initial value for the PV
+    /// * `metadata` - Metadata for the scalar PV
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Server, NTScalarMetadataBuilder};
+    /// # let mut server = Server::create_isolated().unwrap();
+    /// let pv = server.create_pv_native("test:adc", 0u16, NTScalarMetadataBuilder::new())?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn create_pv_native<T: NativeType>(&mut self, name: &str, initial_value: T, metadata: NTScalarMetadataBuilder) -> Result<SharedPV> {
+        let mut pv = SharedPV::create_mailbox()?;
+        pv.open_native(initial_value, metadata)?;
+        self.add_pv(name, &mut pv)?;
+        Ok(pv)
+    }
+
+    /// Create and add a new mailbox SharedPV with an array of any [`NativeType`]
+    /// 
+    /// Create should fail if array is empty.
+    /// The PV is automatically added to the server with the given name.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `name` - The PV name that clients will use
+    /// * `initial_value` - Initial array value for the PV
+    /// * `metadata` - Metadata for the array PV
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Server, NTScalarMetadataBuilder};
+    /// # let mut server = Server::create_isolated().unwrap();
+    /// let image = vec![0u8; 640 * 480];
+    /// let pv = server.create_pv_native_array("test:image", &image, NTScalarMetadataBuilder::new())?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn create_pv_native_array<T: NativeType>(&mut self, name: &str, initial_value: &[T], metadata: NTScalarMetadataBuilder) -> Result<SharedPV> {
+        if initial_value.is_empty() {
+            return Err(PvxsError::new(format!("Initial {} array cannot be empty", T::NAME)));
+        }
+        let mut pv = SharedPV::create_mailbox()?;
+        pv.open_native_array(initial_value, metadata)?;
+        self.add_pv(name, &mut pv)?;
+        Ok(pv)
+    }
+
+    /// Create and add a read-only double PV whose value is computed when a client reads it
+    /// 
+    /// Nothing is posted continuously: each GET calls `compute` and serves its
+    /// result, unless the last result is younger than `ttl` seconds, in which
+    /// case that is served again. Concurrent GETs of a stale value share one
+    /// call. Computed results are also posted, so subscribers see a fresh value
+    /// soon after they subscribe and whenever a GET computes one. PUTs are refused.
+    /// 
+    /// `compute` runs on a worker thread shared by all computed PVs, and GETs
+    /// are answered once it returns, so a slow function never holds up the
+    /// server's other PVs. It does hold up other computed PVs' evaluations.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `name` - The PV name that clients will use
+    /// * `compute` - Produces the value, called from the computed PV worker thread
+    /// * `ttl` - Seconds a result is served from cache, 0 to compute on every GET
+    /// * `metadata` - Metadata for the scalar PV
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `ttl` is negative or the name is already in use.
+    /// 
+    /// # Example
+    /// 
+    /// ```no_run
+    /// # use pvxs_sys::{Server, NTScalarMetadataBuilder};
+    /// extern "C" fn disk_usage() -> f64 {
+    ///     // Expensive: walks a directory tree
+    ///     42.0
+    /// }
+    /// 
+    /// let mut server = Server::from_env()?;
+    /// let pv = server.create_pv_computed_double("DIAG:DISK:USAGE", disk_usage, 10.0, NTScalarMetadataBuilder::new())?;
+    /// server.start()?;
+    /// # Ok::<(), pvxs_sys::PvxsError>(())
+    /// ```
+    pub fn create_pv_computed_double(&mut self, name: &str, compute: extern "C" fn() -> f64, ttl: f64, metadata: NTScalarMetadataBuilder) -> Result<SharedPV> {
+        let mut pv = SharedPV::create_readonly()?;
+        pv.open_double(0.0, metadata)?;
+        bridge::shared_pv_set_computed_double(pv.inner.pin_mut(), compute as usize, ttl)?;
+        self.add_pv(name, &mut pv)?;
+        Ok(pv)
+    }
+
+    /// Create and add a read-only int32 PV whose value is computed when a client reads it
+    /// 
+    /// See [`Server::create_pv_computed_double`].
+    pub fn create_pv_computed_int32(&mut self, name: &str, compute: extern "C" fn() -> i32, ttl: f64, metadata: NTScalarMetadataBuilder) -> Result<SharedPV> {
+        let mut pv = SharedPV::create_readonly()?;
+        pv.open_int32(0, metadata)?;
+        bridge::shared_pv_set_computed_int32(pv.inner.pin_mut(), compute as usize, ttl)?;
+        self.add_pv(name, &mut pv)?;
+        Ok(pv)
+    }
+
     /// Create and add a new mailbox SharedPV with an enum value and metadata
     /// 
     /// The PV is automatically added to the server with the given name.
@@ -1624,6 +2806,110 @@ impl Server {
         self.add_pv(name, &mut pv)?;
         Ok(pv)
     }
+
+    /// Create and add a readonly group PV
+    /// 
+    /// The PV is a structure with one NTScalar member per definition in
+    /// `builder`. See [`GroupPV`].
+    /// 
+    /// # Arguments
+    /// 
+    /// * `name` - The PV name that clients will use
+    /// * `builder` - Member definitions and initial values
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the builder has no members, defines a member
+    /// twice or a member name contains `.`.
+    pub fn create_group_pv(&mut self, name: &str, builder: GroupPVBuilder) -> Result<GroupPV> {
+        let mut group = GroupPV::create(builder)?;
+        bridge::server_add_group_pv(self.inner.pin_mut(), name.to_string(), group.inner.pin_mut())?;
+        Ok(group)
+    }
+
+    /// Create and add a readonly array PV backed by a memory-mapped file
+    /// 
+    /// See [`MappedArrayPV`].
+    /// 
+    /// # Arguments
+    /// 
+    /// * `name` - The PV name that clients will use
+    /// * `path` - File holding the array in native byte order
+    /// * `offset` - Byte offset of the first element, a multiple of the element size
+    /// * `len` - Number of elements, or 0 for everything up to the end of the file
+    /// * `metadata` - Metadata for the array PV
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the file can't be opened or mapped, or is too
+    /// short for `len` elements from `offset`.
+    pub fn create_mapped_array_pv<T: NativeType>(&mut self, name: &str, path: impl AsRef<std::path::Path>, offset: u64, len: usize,
+                                                 metadata: NTScalarMetadataBuilder) -> Result<MappedArrayPV> {
+        let mut pv = MappedArrayPV::create::<T>(path, offset, len, metadata)?;
+        bridge::server_add_mapped_array_pv(self.inner.pin_mut(), name.to_string(), pv.inner.pin_mut())?;
+        Ok(pv)
+    }
+}
+
+/// Per-client send limits for a server
+/// 
+/// See [`Server::enable_send_limits`]. Limits count queued updates, not
+/// bytes; a limit of 0 means unlimited.
+#[derive(Clone, Debug, Default)]
+pub struct SendLimits {
+    max_queued_per_client: u64,
+    alert_threshold: u64,
+    on_alert: Option<extern "C" fn()>,
+}
+
+impl SendLimits {
+    /// Create a configuration without limits
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Set how many updates may be queued for one client before its
+    /// subscriptions are squashed to the latest value
+    pub fn max_queued_per_client(mut self, updates: u64) -> Self {
+        self.max_queued_per_client = updates;
+        self
+    }
+
+    /// Set the queue depth at which a client is reported as slow
+    /// 
+    /// Defaults to three quarters of the queue limit. A client stops being
+    /// slow once its queue drops to half the threshold.
+    pub fn alert_threshold(mut self, updates: u64) -> Self {
+        self.alert_threshold = updates;
+        self
+    }
+
+    /// Set a callback fired each time a client becomes slow
+    /// 
+    /// Called from a server thread; keep it short.
+    pub fn on_alert(mut self, callback: extern "C" fn()) -> Self {
+        self.on_alert = Some(callback);
+        self
+    }
+}
+
+/// Send-queue statistics of one client
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct ClientSendStats {
+    /// Address of the client
+    pub peer: String,
+    /// Limited subscriptions the client has open
+    pub subscriptions: u64,
+    /// Updates waiting to be sent to the client
+    pub queued: u64,
+    /// Highest number of updates queued at once
+    pub max_queued: u64,
+    /// Updates folded into a later one instead of being sent
+    pub squashed: u64,
+    /// Times the client crossed the alert threshold
+    pub alerts: u64,
+    /// Whether the client is currently over the alert threshold
+    pub slow: bool,
 }
 
 /// A shared process variable that can be hosted by a server
@@ -1776,6 +3062,30 @@ impl SharedPV {
         bridge::shared_pv_open_string_array(self.inner.pin_mut(), initial_value, &meta)?;
         Ok(())
     }
+
+    /// Open the PV with a value of any [`NativeType`] and metadata
+    /// 
+    /// # Arguments
+    /// 
+    /// * `initial_value` - The initial value for the PV
+    /// * `metadata` - Metadata builder for the scalar PV
+    pub(crate) fn open_native<T: NativeType>(&mut self, initial_value: T, metadata: NTScalarMetadataBuilder) -> Result<()> {
+        let meta = metadata.build()?;
+        T::open(self.inner.pin_mut(), initial_value, &meta)?;
+        Ok(())
+    }
+
+    /// Open the PV with an array of any [`NativeType`] and metadata
+    /// 
+    /// # Arguments
+    /// 
+    /// * `initial_value` - The initial array value for the PV
+    /// * `metadata` - Metadata builder for the array PV
+    pub(crate) fn open_native_array<T: NativeType>(&mut self, initial_value: &[T], metadata: NTScalarMetadataBuilder) -> Result<()> {
+        let meta = metadata.build()?;
+        T::open_array(self.inner.pin_mut(), initial_value, &meta)?;
+        Ok(())
+    }
     
     /// Check if the PV is open
     pub fn is_open(&self) -> bool {
@@ -1880,6 +3190,33 @@ impl SharedPV {
         bridge::shared_pv_post_string_array(self.inner.pin_mut(), value.to_vec())?;
         Ok(())
     }
+
+    /// Post a new value of any [`NativeType`] to the PV
+    /// 
+    /// The value is converted to the type the PV was opened with.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `value` - The new value to post
+    pub fn post_native<T: NativeType>(&mut self, value: T) -> Result<()> {
+        T::post(self.inner.pin_mut(), value)?;
+        Ok(())
+    }
+
+    /// Post a new array of any [`NativeType`] to the PV
+    /// 
+    /// The elements are passed to C++ without an intermediate copy.
+    /// 
+    /// # Arguments
+    /// 
+    /// * `value` - The new array to post
+    pub fn post_native_array<T: NativeType>(&mut self, value: &[T]) -> Result<()> {
+        if value.is_empty() {
+            return Err(PvxsError::new(format!("Cannot post empty {} array", T::NAME)));
+        }
+        T::post_array(self.inner.pin_mut(), value)?;
+        Ok(())
+    }
     
     /// Fetch the current value of the PV
     /// 
@@ -1888,6 +3225,33 @@ impl SharedPV {
         let inner = bridge::shared_pv_fetch(&self.inner)?;
         Ok(Value { inner })
     }
+
+    /// Make the next GET of a computed PV call its function, even if the cached result is still fresh
+    /// 
+    /// Does nothing for other PVs.
+    pub fn invalidate(&mut self) {
+        bridge::shared_pv_invalidate_computed(self.inner.pin_mut());
+    }
+
+    /// Evaluation counters of a computed PV, `None` for other PVs
+    pub fn computed_stats(&self) -> Option<ComputedStats> {
+        let mut stats = ComputedStats::default();
+        bridge::shared_pv_computed_stats(&self.inner, &mut stats.evaluations, &mut stats.cache_hits, &mut stats.failed)
+            .then_some(stats)
+    }
+}
+
+/// Counters of a computed PV
+/// 
+/// See [`Server::create_pv_computed_double`].
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct ComputedStats {
+    /// Calls of the function
+    pub evaluations: u64,
+    /// Reads served from the cached result
+    pub cache_hits: u64,
+    /// Calls which failed
+    pub failed: u64,
 }
 
 /// A static source for organizing collections of PVs
@@ -1952,6 +3316,1433 @@ impl StaticSource {
     }
 }
 
+// ============================================================================
+// Native-width value types
+// ============================================================================
+
+mod native {
+    use super::bridge::{self, ContextWrapper, SharedPVWrapper, ValueWrapper};
+    use std::pin::Pin;
+
+    type Result<T> = std::result::Result<T, cxx::Exception>;
+
+    /// Bridge calls for one element type. Not exported, so the set of types stays closed
+    pub trait Bridged: Copy {
+        const NAME: &'static str;
+        fn open(pv: Pin<&mut SharedPVWrapper>, value: Self, metadata: &bridge::NTScalarMetadata) -> Result<()>;
+        fn open_array(pv: Pin<&mut SharedPVWrapper>, value: &[Self], metadata: &bridge::NTScalarMetadata) -> Result<()>;
+        fn post(pv: Pin<&mut SharedPVWrapper>, value: Self) -> Result<()>;
+        fn post_array(pv: Pin<&mut SharedPVWrapper>, value: &[Self]) -> Result<()>;
+        fn put(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: Self, timeout: f64) -> Result<()>;
+        fn put_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[Self], timeout: f64) -> Result<()>;
+        fn get(val: &ValueWrapper, field_name: String) -> Result<Self>;
+        fn get_array(val: &ValueWrapper, field_name: String) -> Result<Vec<Self>>;
+    }
+
+    // Arrays cross the bridge as slices, except for the original f64 and i32 functions taking a Vec
+    macro_rules! native_type {
+        (@array slice, $value:expr) => { $value };
+        (@array vec, $value:expr) => { $value.to_vec() };
+        ($t:ty, $name:literal, $arrays:ident, $open:ident, $open_array:ident, $post:ident, $post_array:ident,
+         $put:ident, $put_array:ident, $get:ident, $get_array:ident) => {
+            impl Bridged for $t {
+                const NAME: &'static str = $name;
+                fn open(pv: Pin<&mut SharedPVWrapper>, value: Self, metadata: &bridge::NTScalarMetadata) -> Result<()> {
+                    bridge::$open(pv, value, metadata)
+                }
+                fn open_array(pv: Pin<&mut SharedPVWrapper>, value: &[Self], metadata: &bridge::NTScalarMetadata) -> Result<()> {
+                    bridge::$open_array(pv, native_type!(@array $arrays, value), metadata)
+                }
+                fn post(pv: Pin<&mut SharedPVWrapper>, value: Self) -> Result<()> {
+                    bridge::$post(pv, value)
+                }
+                fn post_array(pv: Pin<&mut SharedPVWrapper>, value: &[Self]) -> Result<()> {
+                    bridge::$post_array(pv, native_type!(@array $arrays, value))
+                }
+                fn put(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: Self, timeout: f64) -> Result<()> {
+                    bridge::$put(ctx, pv_name, value, timeout)
+                }
+                fn put_array(ctx: Pin<&mut ContextWrapper>, pv_name: &str, value: &[Self], timeout: f64) -> Result<()> {
+                    bridge::$put_array(ctx, pv_name, native_type!(@array $arrays, value), timeout)
+                }
+                fn get(val: &ValueWrapper, field_name: String) -> Result<Self> {
+                    bridge::$get(val, field_name)
+                }
+                fn get_array(val: &ValueWrapper, field_name: String) -> Result<Vec<Self>> {
+                    bridge::$get_array(val, field_name)
+                }
+            }
+        };
+    }
+
+    native_type!(f64, "double", vec, shared_pv_open_double, shared_pv_open_double_array, shared_pv_post_double, shared_pv_post_double_array,
+                 context_put_double, context_put_double_array, value_get_field_double, value_get_field_double_array);
+    native_type!(i32, "int32", vec, shared_pv_open_int32, shared_pv_open_int32_array, shared_pv_post_int32, shared_pv_post_int32_array,
+                 context_put_int32, context_put_int32_array, value_get_field_int32, value_get_field_int32_array);
+    native_type!(i8, "int8", slice, shared_pv_open_int8, shared_pv_open_int8_array, shared_pv_post_int8, shared_pv_post_int8_array,
+                 context_put_int8, context_put_int8_array, value_get_field_int8, value_get_field_int8_array);
+    native_type!(u8, "uint8", slice, shared_pv_open_uint8, shared_pv_open_uint8_array, shared_pv_post_uint8, shared_pv_post_uint8_array,
+                 context_put_uint8, context_put_uint8_array, value_get_field_uint8, value_get_field_uint8_array);
+    native_type!(i16, "int16", slice, shared_pv_open_int16, shared_pv_open_int16_array, shared_pv_post_int16, shared_pv_post_int16_array,
+                 context_put_int16, context_put_int16_array, value_get_field_int16, value_get_field_int16_array);
+    native_type!(u16, "uint16", slice, shared_pv_open_uint16, shared_pv_open_uint16_array, shared_pv_post_uint16, shared_pv_post_uint16_array,
+                 context_put_uint16, context_put_uint16_array, value_get_field_uint16, value_get_field_uint16_array);
+    native_type!(u32, "uint32", slice, shared_pv_open_uint32, shared_pv_open_uint32_array, shared_pv_post_uint32, shared_pv_post_uint32_array,
+                 context_put_uint32, context_put_uint32_array, value_get_field_uint32, value_get_field_uint32_array);
+    native_type!(i64, "int64", slice, shared_pv_open_int64, shared_pv_open_int64_array, shared_pv_post_int64, shared_pv_post_int64_array,
+                 context_put_int64, context_put_int64_array, value_get_field_int64, value_get_field_int64_array);
+    native_type!(u64, "uint64", slice, shared_pv_open_uint64, shared_pv_open_uint64_array, shared_pv_post_uint64, shared_pv_post_uint64_array,
+                 context_put_uint64, context_put_uint64_array, value_get_field_uint64, value_get_field_uint64_array);
+    native_type!(f32, "float32", slice, shared_pv_open_float32, shared_pv_open_float32_array, shared_pv_post_float32, shared_pv_post_float32_array,
+                 context_put_float32, context_put_float32_array, value_get_field_float32, value_get_field_float32_array);
+    native_type!(bool, "bool", slice, shared_pv_open_bool, shared_pv_open_bool_array, shared_pv_post_bool, shared_pv_post_bool_array,
+                 context_put_bool, context_put_bool_array, value_get_field_bool, value_get_field_bool_array);
+}
+
+/// Element types which PVs, PUTs and field reads can use at their native width
+/// 
+/// Implemented for `bool`, `i8`, `u8`, `i16`, `u16`, `i32`, `u32`, `i64`,
+/// `u64`, `f32` and `f64`. A `u16` PV has a `UInt16` value field, so 16-bit
+/// ADC data or image bytes are neither widened in memory nor on the wire.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Server, NTScalarMetadataBuilder};
+/// # let mut server = Server::create_isolated().unwrap();
+/// let mut pv = server.create_pv_native_array("adc:raw", &[0u16; 4096], NTScalarMetadataBuilder::new())?;
+/// pv.post_native_array(&[512u16; 4096])?;
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub trait NativeType: native::Bridged {}
+
+impl<T: native::Bridged> NativeType for T {}
+
+// ============================================================================
+// Group PVs
+// ============================================================================
+
+#[derive(Clone, Debug)]
+enum GroupMember {
+    Double(f64),
+    Int32(i32),
+    String(String),
+    DoubleArray(Vec<f64>),
+    Int32Array(Vec<i32>),
+    StringArray(Vec<String>),
+}
+
+/// Member definitions of a [`GroupPV`]
+/// 
+/// Members keep the order in which they are defined.
+#[derive(Clone, Debug, Default)]
+pub struct GroupPVBuilder {
+    members: Vec<(String, GroupMember)>,
+}
+
+impl GroupPVBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Add a double member
+    pub fn double(mut self, name: &str, initial_value: f64) -> Self {
+        self.members.push((name.to_string(), GroupMember::Double(initial_value)));
+        self
+    }
+
+    /// Add an int32 member
+    pub fn int32(mut self, name: &str, initial_value: i32) -> Self {
+        self.members.push((name.to_string(), GroupMember::Int32(initial_value)));
+        self
+    }
+
+    /// Add a string member
+    pub fn string(mut self, name: &str, initial_value: &str) -> Self {
+        self.members.push((name.to_string(), GroupMember::String(initial_value.to_string())));
+        self
+    }
+
+    /// Add a double array member
+    pub fn double_array(mut self, name: &str, initial_value: Vec<f64>) -> Self {
+        self.members.push((name.to_string(), GroupMember::DoubleArray(initial_value)));
+        self
+    }
+
+    /// Add an int32 array member
+    pub fn int32_array(mut self, name: &str, initial_value: Vec<i32>) -> Self {
+        self.members.push((name.to_string(), GroupMember::Int32Array(initial_value)));
+        self
+    }
+
+    /// Add a string array member
+    pub fn string_array(mut self, name: &str, initial_value: Vec<String>) -> Self {
+        self.members.push((name.to_string(), GroupMember::StringArray(initial_value)));
+        self
+    }
+}
+
+/// Composite PV combining several related values
+/// 
+/// Each member is an NTScalar structure (`value`, `alarm`, `timeStamp`)
+/// named after the member, e.g. `position.value`. Changes made with the
+/// `set_*` methods are staged until [`GroupPV::post`], which sends them to
+/// subscribers as a single update in which only the changed members are
+/// marked. Clients therefore need one subscription and always see the
+/// members in a consistent state. Changed members share one time stamp.
+/// 
+/// Group PVs are readonly for clients.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Server, GroupPVBuilder};
+/// let mut server = Server::from_env()?;
+/// let mut motor = server.create_group_pv("MOTOR:1", GroupPVBuilder::new()
+///     .double("position", 0.0)
+///     .double("velocity", 0.0)
+///     .int32("status", 0))?;
+/// server.start()?;
+/// 
+/// motor.set_double("position", 12.5)?
+///     .set_double("velocity", 0.8)?
+///     .set_int32("status", 1)?;
+/// motor.post()?;
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct GroupPV {
+    inner: UniquePtr<GroupPVWrapper>,
+}
+
+impl GroupPV {
+    /// Create and open a group PV which is not served yet
+    /// 
+    /// Prefer [`Server::create_group_pv`].
+    pub fn create(builder: GroupPVBuilder) -> Result<Self> {
+        let mut inner = bridge::group_pv_create()?;
+        for (name, member) in &builder.members {
+            let member_type = match member {
+                GroupMember::Double(_) => "double",
+                GroupMember::Int32(_) => "int32",
+                GroupMember::String(_) => "string",
+                GroupMember::DoubleArray(_) => "double[]",
+                GroupMember::Int32Array(_) => "int32[]",
+                GroupMember::StringArray(_) => "string[]",
+            };
+            bridge::group_pv_add_member(inner.pin_mut(), name, member_type)?;
+        }
+        let mut group = Self { inner };
+        for (name, member) in builder.members {
+            match member {
+                GroupMember::Double(v) => group.set_double(&name, v)?,
+                GroupMember::Int32(v) => group.set_int32(&name, v)?,
+                GroupMember::String(v) => group.set_string(&name, &v)?,
+                GroupMember::DoubleArray(v) => group.set_double_array(&name, &v)?,
+                GroupMember::Int32Array(v) => group.set_int32_array(&name, &v)?,
+                GroupMember::StringArray(v) => group.set_string_array(&name, &v)?,
+            };
+        }
+        bridge::group_pv_open(group.inner.pin_mut())?;
+        Ok(group)
+    }
+
+    /// Stage a new value for a double member
+    pub fn set_double(&mut self, member: &str, value: f64) -> Result<&mut Self> {
+        bridge::group_pv_set_double(self.inner.pin_mut(), member, value)?;
+        Ok(self)
+    }
+
+    /// Stage a new value for an int32 member
+    pub fn set_int32(&mut self, member: &str, value: i32) -> Result<&mut Self> {
+        bridge::group_pv_set_int32(self.inner.pin_mut(), member, value)?;
+        Ok(self)
+    }
+
+    /// Stage a new value for a string member
+    pub fn set_string(&mut self, member: &str, value: &str) -> Result<&mut Self> {
+        bridge::group_pv_set_string(self.inner.pin_mut(), member, value.to_string())?;
+        Ok(self)
+    }
+
+    /// Stage a new value for a double array member
+    pub fn set_double_array(&mut self, member: &str, value: &[f64]) -> Result<&mut Self> {
+        bridge::group_pv_set_double_array(self.inner.pin_mut(), member, value.to_vec())?;
+        Ok(self)
+    }
+
+    /// Stage a new value for an int32 array member
+    pub fn set_int32_array(&mut self, member: &str, value: &[i32]) -> Result<&mut Self> {
+        bridge::group_pv_set_int32_array(self.inner.pin_mut(), member, value.to_vec())?;
+        Ok(self)
+    }
+
+    /// Stage a new value for a string array member
+    pub fn set_string_array(&mut self, member: &str, value: &[String]) -> Result<&mut Self> {
+        bridge::group_pv_set_string_array(self.inner.pin_mut(), member, value.to_vec())?;
+        Ok(self)
+    }
+
+    /// Stage a new alarm for a member
+    pub fn set_alarm(&mut self, member: &str, severity: i32, status: i32, message: &str) -> Result<&mut Self> {
+        bridge::group_pv_set_alarm(self.inner.pin_mut(), member, severity, status, message.to_string())?;
+        Ok(self)
+    }
+
+    /// Post all staged changes as one update
+    /// 
+    /// Returns `false` without posting if nothing was staged.
+    pub fn post(&mut self) -> Result<bool> {
+        Ok(bridge::group_pv_post(self.inner.pin_mut())?)
+    }
+
+    /// Get the current value of the whole group
+    pub fn fetch(&self) -> Result<Value> {
+        let inner = bridge::group_pv_fetch(&self.inner)?;
+        Ok(Value { inner })
+    }
+}
+
+// ============================================================================
+// Memory-mapped array PVs
+// ============================================================================
+
+/// A readonly array PV whose value is read straight from a memory-mapped file
+/// 
+/// Nothing is loaded or copied into Rust: the served array points into the
+/// mapping, which stays mapped as long as the PV or any queued update refers
+/// to it. To publish new contents, write them into the file (from this or any
+/// other process) and call [`MappedArrayPV::post`].
+/// 
+/// The file may be rewritten in place but must never be truncated below the
+/// mapped region while the PV exists. Reading a mapped page past the end of
+/// the file raises `SIGBUS`, which kills the process. [`MappedArrayPV::post`]
+/// refuses to publish once the file has shrunk, but updates already queued
+/// for clients, or a truncation racing with a post, can still hit it. Replace
+/// the file by renaming a new one over it instead: the mapping keeps the old
+/// contents until the PV is recreated.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Server, NTScalarMetadataBuilder};
+/// # let mut server = Server::create_isolated().unwrap();
+/// // A table of 4096 doubles stored after a 64 byte header
+/// let mut table = server.create_mapped_array_pv::<f64>(
+///     "calib:table", "/data/calibration.bin", 64, 4096, NTScalarMetadataBuilder::new())?;
+/// // ... rewrite the table in the file ...
+/// table.post()?;
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct MappedArrayPV {
+    inner: UniquePtr<MappedArrayPVWrapper>,
+}
+
+impl MappedArrayPV {
+    /// Map a file region and open a PV over it which is not served yet
+    /// 
+    /// Prefer [`Server::create_mapped_array_pv`].
+    pub fn create<T: NativeType>(path: impl AsRef<std::path::Path>, offset: u64, len: usize, metadata: NTScalarMetadataBuilder) -> Result<Self> {
+        let path = path.as_ref();
+        let path = path.to_str()
+            .ok_or_else(|| PvxsError::new(format!("Path '{}' is not valid UTF-8", path.display())))?;
+        let meta = metadata.build()?;
+        let mut inner = bridge::mapped_array_pv_create()?;
+        bridge::mapped_array_pv_open(inner.pin_mut(), path, T::NAME, offset, len as u64, &meta)?;
+        Ok(Self { inner })
+    }
+
+    /// Republish the mapped region
+    /// 
+    /// Clients receive the current file contents. Nothing is copied.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the file has been truncated below the mapped
+    /// region since the PV was created.
+    pub fn post(&mut self) -> Result<()> {
+        bridge::mapped_array_pv_post(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Number of elements in the mapped region
+    pub fn len(&self) -> usize {
+        bridge::mapped_array_pv_len(&self.inner) as usize
+    }
+
+    /// Get the current value of the PV
+    pub fn fetch(&self) -> Result<Value> {
+        let inner = bridge::mapped_array_pv_fetch(&self.inner)?;
+        Ok(Value { inner })
+    }
+}
+
+// ============================================================================
+// Post staging
+// ============================================================================
+
+/// Slot of a PV in a [`PostStager`]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct StagedPV(u64);
+
+/// Funnels posts from many threads through a single flusher thread
+/// 
+/// Producers stage the latest value of a PV with [`PostStager::stage_double`]
+/// or [`PostStager::stage_int32`]. Staging only stores the value into the
+/// PV's slot with atomic operations: it never locks, never calls into PVXS
+/// and never waits for other producers. A value staged before the previous
+/// one was flushed replaces it (see [`PostStagerStats::coalesced`]).
+/// 
+/// Every `interval` seconds the flusher thread posts each PV with a staged
+/// value once, in the order the PVs were added, so contended posting
+/// becomes one ordered batch per interval. Each post carries the time its
+/// value was staged as `timeStamp`, not the time of the flush.
+/// [`PostStagerStats`] reports how long values wait between being staged
+/// and posted.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{PostStager, Server, NTScalarMetadataBuilder};
+/// # use std::sync::Arc;
+/// let mut server = Server::from_env()?;
+/// let pv = server.create_pv_double("DAQ:RATE", 0.0, NTScalarMetadataBuilder::new())?;
+/// server.start()?;
+/// 
+/// let mut stager = PostStager::new(0.01)?;
+/// let rate = stager.add(&pv)?;
+/// stager.start()?;
+/// 
+/// let stager = Arc::new(stager);
+/// let workers: Vec<_> = (0..4).map(|i| {
+///     let stager = Arc::clone(&stager);
+///     std::thread::spawn(move || stager.stage_double(rate, i as f64))
+/// }).collect();
+/// for worker in workers {
+///     worker.join().unwrap()?;
+/// }
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct PostStager {
+    inner: UniquePtr<PostStagerWrapper>,
+}
+
+// Staging only touches atomics; everything else takes &mut self
+unsafe impl Send for PostStager {}
+unsafe impl Sync for PostStager {}
+
+impl PostStager {
+    /// Create a stopped stager flushing every `interval` seconds
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `interval` is not positive.
+    pub fn new(interval: f64) -> Result<Self> {
+        let inner = bridge::post_stager_create(interval)?;
+        Ok(Self { inner })
+    }
+
+    /// Give a PV a slot
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the stager is running, or the PV is not an open
+    /// double or int32 scalar PV.
+    pub fn add(&mut self, pv: &SharedPV) -> Result<StagedPV> {
+        Ok(StagedPV(bridge::post_stager_add(self.inner.pin_mut(), &pv.inner)?))
+    }
+
+    /// Stage the next value of a double PV, from any thread
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the slot belongs to an int32 PV or to another stager.
+    pub fn stage_double(&self, pv: StagedPV, value: f64) -> Result<()> {
+        bridge::post_stager_stage_double(&self.inner, pv.0, value)?;
+        Ok(())
+    }
+
+    /// Stage the next value of an int32 PV, from any thread
+    pub fn stage_int32(&self, pv: StagedPV, value: i32) -> Result<()> {
+        bridge::post_stager_stage_int32(&self.inner, pv.0, value)?;
+        Ok(())
+    }
+
+    /// Start the flusher thread
+    pub fn start(&mut self) -> Result<()> {
+        bridge::post_stager_start(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Post what is staged and stop the flusher thread
+    pub fn stop(&mut self) -> Result<()> {
+        bridge::post_stager_stop(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Check if the flusher thread is running
+    pub fn is_running(&self) -> bool {
+        bridge::post_stager_is_running(&self.inner)
+    }
+
+    /// Counters and flush latencies since creation
+    pub fn stats(&self) -> PostStagerStats {
+        let mut stats = PostStagerStats::default();
+        bridge::post_stager_stats(&self.inner, &mut stats.staged, &mut stats.coalesced, &mut stats.posted,
+                                  &mut stats.failed, &mut stats.flushes, &mut stats.last_latency,
+                                  &mut stats.max_latency, &mut stats.mean_latency);
+        stats
+    }
+}
+
+/// Counters of a [`PostStager`]
+/// 
+/// Latencies are in seconds, from the oldest value of a flush being staged
+/// until the flush had posted all of its values.
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct PostStagerStats {
+    /// Values staged by producers
+    pub staged: u64,
+    /// Staged values replaced by a later one before being flushed
+    pub coalesced: u64,
+    /// Values posted by the flusher
+    pub posted: u64,
+    /// Posts which failed
+    pub failed: u64,
+    /// Intervals which posted at least one value
+    pub flushes: u64,
+    pub last_latency: f64,
+    pub max_latency: f64,
+    pub mean_latency: f64,
+}
+
+// ============================================================================
+// Autosave
+// ============================================================================
+
+/// Periodically saves the values of SharedPVs to disk, off the posting path
+/// 
+/// A writer thread wakes every `interval` seconds and writes a snapshot only
+/// if one of the PVs was posted since the last one; only PVs posted since
+/// then are encoded again. Posting never waits for the disk.
+/// 
+/// Snapshots alternate between `<path>.0` and `<path>.1` and carry a
+/// generation and a checksum, so a crash while writing one leaves the
+/// previous snapshot intact. [`Autosave::restore`] loads the newest valid one.
+/// 
+/// Saved values are numeric and string scalars, NTEnum indexes and arrays.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Autosave, Server, NTScalarMetadataBuilder};
+/// let mut server = Server::from_env()?;
+/// let setpoint = server.create_pv_double("MOTOR:SETPOINT", 0.0, NTScalarMetadataBuilder::new())?;
+/// 
+/// let mut autosave = Autosave::new("/var/lib/ioc/motor.sav", 5.0)?;
+/// autosave.add("MOTOR:SETPOINT", &setpoint)?;
+/// autosave.restore()?;
+/// autosave.start()?;
+/// server.start()?;
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct Autosave {
+    inner: UniquePtr<AutosaveWrapper>,
+}
+
+impl Autosave {
+    /// Create a stopped autosave writing snapshots to `<path>.0` and `<path>.1`
+    /// 
+    /// Generations continue from the snapshots already there.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `interval` is not positive or `path` is not UTF-8.
+    pub fn new(path: impl AsRef<std::path::Path>, interval: f64) -> Result<Self> {
+        let path = path.as_ref();
+        let path = path.to_str()
+            .ok_or_else(|| PvxsError::new(format!("Path '{}' is not valid UTF-8", path.display())))?;
+        let inner = bridge::autosave_create(path, interval)?;
+        Ok(Self { inner })
+    }
+
+    /// Save a PV under `name`, the key of its value in snapshots
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the autosave is running, the name is taken, or
+    /// the PV is closed or has a value type which can't be saved.
+    pub fn add(&mut self, name: &str, pv: &SharedPV) -> Result<()> {
+        bridge::autosave_add(self.inner.pin_mut(), name, &pv.inner)?;
+        Ok(())
+    }
+
+    /// Post the values of the newest valid snapshot to the added PVs
+    /// 
+    /// Saved names which were not added, and values which no longer fit
+    /// their PV, are skipped. Returns the number of PVs restored.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the autosave is running or the snapshot is corrupt.
+    pub fn restore(&mut self) -> Result<usize> {
+        Ok(bridge::autosave_restore(self.inner.pin_mut())? as usize)
+    }
+
+    /// Write a snapshot now if anything changed, returning whether one was written
+    pub fn save(&mut self) -> Result<bool> {
+        Ok(bridge::autosave_save(self.inner.pin_mut())?)
+    }
+
+    /// Start the writer thread
+    pub fn start(&mut self) -> Result<()> {
+        bridge::autosave_start(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Save what changed and stop the writer thread
+    pub fn stop(&mut self) -> Result<()> {
+        bridge::autosave_stop(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Check if the writer thread is running
+    pub fn is_running(&self) -> bool {
+        bridge::autosave_is_running(&self.inner)
+    }
+
+    /// Counters since creation
+    pub fn stats(&self) -> AutosaveStats {
+        let mut stats = AutosaveStats::default();
+        bridge::autosave_stats(&self.inner, &mut stats.saves, &mut stats.failed, &mut stats.generation,
+                               &mut stats.bytes, &mut stats.last_duration);
+        stats
+    }
+}
+
+/// Counters of an [`Autosave`]
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct AutosaveStats {
+    /// Snapshots written
+    pub saves: u64,
+    /// Snapshots which failed to write
+    pub failed: u64,
+    /// Generation of the newest snapshot on disk, 0 if there is none
+    pub generation: u64,
+    /// Size of the last snapshot written
+    pub bytes: u64,
+    /// Seconds taken to encode and write the last snapshot
+    pub last_duration: f64,
+}
+
+// ============================================================================
+// Relays
+// ============================================================================
+
+/// Client subscription republished through a local SharedPV
+/// 
+/// Created with [`Context::relay`]. Each upstream update goes through the
+/// transforms in the order they were added and is posted to the target PV.
+/// By default the outgoing `value`, `alarm` and `timeStamp` are copied
+/// from the upstream fields of the same name, converting between numeric
+/// types as needed. While the upstream PV is disconnected the target
+/// carries an INVALID alarm.
+/// 
+/// Transforms can only be added while the relay is stopped.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Context, Server, NTScalarMetadataBuilder};
+/// # let mut server = Server::from_env()?;
+/// # let pv = server.create_pv_double("TEMP:F", 32.0, NTScalarMetadataBuilder::new())?;
+/// # let mut ctx = Context::from_env()?;
+/// // Celsius to Fahrenheit, limited to the sensor range
+/// let mut relay = ctx.relay("TEMP:C", &pv)?;
+/// relay.scale(1.8, 32.0)?.clamp(-40.0, 250.0)?;
+/// relay.start()?;
+/// // ...
+/// println!("{} updates forwarded", relay.stats().forwarded);
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct Relay {
+    inner: UniquePtr<RelayWrapper>,
+}
+
+impl Relay {
+    /// Append `value = value * factor + offset`
+    /// 
+    /// Applies to every element of array values.
+    pub fn scale(&mut self, factor: f64, offset: f64) -> Result<&mut Self> {
+        bridge::relay_add_scale(self.inner.pin_mut(), factor, offset)?;
+        Ok(self)
+    }
+
+    /// Append a clamp of the value to `[low, high]`
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `low > high`.
+    pub fn clamp(&mut self, low: f64, high: f64) -> Result<&mut Self> {
+        bridge::relay_add_clamp(self.inner.pin_mut(), low, high)?;
+        Ok(self)
+    }
+
+    /// Append a decimation step forwarding one update out of every `every`
+    /// 
+    /// The first update is always forwarded.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `every` is 0.
+    pub fn decimate(&mut self, every: u64) -> Result<&mut Self> {
+        bridge::relay_add_decimate(self.inner.pin_mut(), every)?;
+        Ok(self)
+    }
+
+    /// Take the outgoing field `to` from the upstream field `from`
+    /// 
+    /// Replaces the default same-name mapping for `to`, e.g.
+    /// `remap("setpoint", "value")` publishes the upstream setpoint as the
+    /// target's value. Nested fields use dotted names.
+    pub fn remap(&mut self, from: &str, to: &str) -> Result<&mut Self> {
+        bridge::relay_add_remap(self.inner.pin_mut(), from, to)?;
+        Ok(self)
+    }
+
+    /// Subscribe to the upstream PV and start forwarding
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the target PV is not open or the subscription
+    /// can't be created.
+    pub fn start(&mut self) -> Result<()> {
+        bridge::relay_start(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Stop forwarding; the target keeps its last value
+    pub fn stop(&mut self) -> Result<()> {
+        bridge::relay_stop(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Check if the relay is subscribed
+    pub fn is_running(&self) -> bool {
+        bridge::relay_is_running(&self.inner)
+    }
+
+    /// Counters since the relay was created
+    pub fn stats(&self) -> RelayStats {
+        let mut stats = RelayStats::default();
+        bridge::relay_stats(&self.inner, &mut stats.forwarded, &mut stats.decimated, &mut stats.failed);
+        stats
+    }
+}
+
+/// Counters of a [`Relay`]
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct RelayStats {
+    /// Updates posted to the target
+    pub forwarded: u64,
+    /// Updates dropped by decimation
+    pub decimated: u64,
+    /// Upstream errors and updates the transforms could not handle
+    pub failed: u64,
+}
+
+// ============================================================================
+// Alarm summaries
+// ============================================================================
+
+/// Worst alarm severity and per-severity counts over groups of PVs
+/// 
+/// Each PV added with [`AlarmSummary::add_pv`] belongs to one group. Groups
+/// form a hierarchy through `:` in their names: a PV in `LINAC:RF:CAV1` is
+/// also counted in `LINAC:RF` and `LINAC`. The engine only looks at
+/// `alarm.severity` and keeps the counts up to date incrementally, so an
+/// alarm change costs the same however many PVs are summarized, and value
+/// updates without an alarm change cost nothing beyond receiving them.
+/// 
+/// PVs count as disconnected until their first update and whenever their
+/// subscription is lost; a disconnected PV makes its groups INVALID.
+/// 
+/// Each group is also available as a read-only PV (see
+/// [`AlarmSummary::publish`]). Its `value` and `alarm.severity` hold the
+/// worst severity, and the fields `total`, `noAlarm`, `minor`, `major`,
+/// `invalid` and `disconnected` hold the counts.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Context, Server};
+/// let mut ctx = Context::from_env()?;
+/// let mut summary = ctx.alarm_summary()?;
+/// summary.add_pv("LINAC:RF:CAV1:AMP", "LINAC:RF")?;
+/// summary.add_pv("LINAC:RF:CAV2:AMP", "LINAC:RF")?;
+/// summary.add_pv("LINAC:VAC:GAUGE1", "LINAC:VAC")?;
+/// 
+/// // Serves ALARM:LINAC, ALARM:LINAC:RF and ALARM:LINAC:VAC
+/// let mut server = Server::from_env()?;
+/// summary.publish(&mut server, "ALARM:")?;
+/// server.start()?;
+/// summary.start()?;
+/// 
+/// if let Some(linac) = summary.group_stats("LINAC") {
+///     println!("{} of {} PVs in MAJOR alarm", linac.major, linac.total);
+/// }
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct AlarmSummary {
+    inner: UniquePtr<AlarmSummaryWrapper>,
+}
+
+impl AlarmSummary {
+    /// Add a PV to a group
+    /// 
+    /// The group and its ancestors are created as needed. If the engine is
+    /// running the PV is subscribed to immediately.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the PV was already added or the group name is
+    /// empty or starts or ends with `:`.
+    pub fn add_pv(&mut self, pv_name: &str, group: &str) -> Result<()> {
+        bridge::alarm_summary_add_pv(self.inner.pin_mut(), pv_name, group)?;
+        Ok(())
+    }
+
+    /// Serve each group's summary PV as `<prefix><group>`
+    /// 
+    /// Covers the groups existing at the time of the call, so call it after
+    /// adding the PVs.
+    pub fn publish(&mut self, server: &mut Server, prefix: &str) -> Result<()> {
+        bridge::alarm_summary_publish(self.inner.pin_mut(), server.inner.pin_mut(), prefix)?;
+        Ok(())
+    }
+
+    /// Subscribe to all PVs
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if no PV was added.
+    pub fn start(&mut self) -> Result<()> {
+        bridge::alarm_summary_start(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Drop all subscriptions; every PV counts as disconnected afterwards
+    pub fn stop(&mut self) -> Result<()> {
+        bridge::alarm_summary_stop(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Check if the engine is subscribed
+    pub fn is_running(&self) -> bool {
+        bridge::alarm_summary_is_running(&self.inner)
+    }
+
+    /// Names of all groups, ancestors included, in creation order
+    pub fn groups(&self) -> Vec<String> {
+        bridge::alarm_summary_groups(&self.inner)
+    }
+
+    /// Current counts of a group, `None` if there is no such group
+    pub fn group_stats(&self, group: &str) -> Option<AlarmGroupStats> {
+        let mut stats = AlarmGroupStats::default();
+        if bridge::alarm_summary_group_stats(&self.inner, group, &mut stats.total, &mut stats.no_alarm,
+                                             &mut stats.minor, &mut stats.major, &mut stats.invalid,
+                                             &mut stats.disconnected, &mut stats.max_severity) {
+            Some(stats)
+        } else {
+            None
+        }
+    }
+
+    /// Number of PV severity changes applied so far
+    pub fn updates(&self) -> u64 {
+        bridge::alarm_summary_updates(&self.inner)
+    }
+}
+
+/// Alarm counts of one [`AlarmSummary`] group, descendants included
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct AlarmGroupStats {
+    /// PVs in the group
+    pub total: u64,
+    pub no_alarm: u64,
+    pub minor: u64,
+    pub major: u64,
+    pub invalid: u64,
+    pub disconnected: u64,
+    /// Worst severity (0 to 3), disconnected PVs count as INVALID (3)
+    pub max_severity: u8,
+}
+
+// ============================================================================
+// Array recorders
+// ============================================================================
+
+/// Records every update of an array PV to a file
+/// 
+/// Each update is written as a 40-byte [`ArrayRecordHeader`] followed by
+/// the raw elements, padded with zeros to a multiple of 8 bytes. The
+/// elements are written from the buffer the client received: the
+/// subscription callback only queues a reference to it, and a dedicated
+/// thread writes everything queued so far with one gathered write. No
+/// update passes through Rust, and no element is copied on the way to the
+/// file.
+/// 
+/// With a capacity the file is preallocated to that size. Once it is full,
+/// further updates are dropped, or, in ring mode, recording continues from
+/// the start of the file after a wrap marker. Gaps in the header sequence
+/// numbers show updates dropped because the queue or the file was full.
+/// 
+/// A ring also has an end marker after its newest record. To read a ring in
+/// order, start at the offset given by [`ArrayRecordHeader::oldest`] of the
+/// end marker, if any, and read up to the wrap marker, then read from the
+/// start of the file up to the end marker.
+/// 
+/// Only numeric and boolean arrays can be recorded; other updates are
+/// counted as failed.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{ArrayRecorderConfig, Context};
+/// let mut ctx = Context::from_env()?;
+/// let config = ArrayRecorderConfig::new().capacity(1 << 30).ring(true);
+/// let mut recorder = ctx.array_recorder("SCOPE:CH1:WAVEFORM", "/data/ch1.rec", config)?;
+/// recorder.start()?;
+/// // ...
+/// recorder.stop()?;
+/// println!("{} updates recorded", recorder.stats().recorded);
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct ArrayRecorder {
+    inner: UniquePtr<ArrayRecorderWrapper>,
+}
+
+impl ArrayRecorder {
+    /// Create (or truncate) the file and subscribe to the PV
+    /// 
+    /// Counters restart from 0.
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the file can't be created or preallocated.
+    pub fn start(&mut self) -> Result<()> {
+        bridge::array_recorder_start(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Unsubscribe, write out the queued updates and close the file
+    pub fn stop(&mut self) -> Result<()> {
+        bridge::array_recorder_stop(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Check if the recorder is subscribed
+    pub fn is_running(&self) -> bool {
+        bridge::array_recorder_is_running(&self.inner)
+    }
+
+    /// Counters of the current or last run
+    pub fn stats(&self) -> ArrayRecorderStats {
+        let mut stats = ArrayRecorderStats::default();
+        bridge::array_recorder_stats(&self.inner, &mut stats.recorded, &mut stats.dropped, &mut stats.failed,
+                                     &mut stats.bytes, &mut stats.batches);
+        stats
+    }
+}
+
+/// Configuration of an [`ArrayRecorder`]
+#[derive(Clone, Debug)]
+pub struct ArrayRecorderConfig {
+    capacity: u64,
+    ring: bool,
+    max_queued: u64,
+    drop_cache: bool,
+}
+
+impl ArrayRecorderConfig {
+    /// Create a configuration with default values
+    /// 
+    /// Defaults: no capacity (the file grows without limit), no ring,
+    /// 1024 queued updates, page cache kept.
+    pub fn new() -> Self {
+        Self {
+            capacity: 0,
+            ring: false,
+            max_queued: 1024,
+            drop_cache: false,
+        }
+    }
+
+    /// Preallocate the file to this many bytes and never write beyond them
+    pub fn capacity(mut self, bytes: u64) -> Self {
+        self.capacity = bytes;
+        self
+    }
+
+    /// Wrap to the start of the file when it is full, instead of dropping updates
+    pub fn ring(mut self, enabled: bool) -> Self {
+        self.ring = enabled;
+        self
+    }
+
+    /// Set how many updates may wait for the writer before new ones are dropped
+    pub fn max_queued(mut self, updates: u64) -> Self {
+        self.max_queued = updates;
+        self
+    }
+
+    /// Evict written data from the page cache after each batch (POSIX only)
+    /// 
+    /// Keeps long recordings from pushing everything else out of memory.
+    pub fn drop_cache(mut self, enabled: bool) -> Self {
+        self.drop_cache = enabled;
+        self
+    }
+}
+
+impl Default for ArrayRecorderConfig {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// Counters of an [`ArrayRecorder`]
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct ArrayRecorderStats {
+    /// Updates written to the file
+    pub recorded: u64,
+    /// Updates dropped because the queue or the file was full
+    pub dropped: u64,
+    /// Updates without a numeric array value, remote errors and failed writes
+    pub failed: u64,
+    /// Bytes written, headers and padding included
+    pub bytes: u64,
+    /// Gathered writes issued by the writer thread
+    pub batches: u64,
+}
+
+/// Header written before the elements of each [`ArrayRecorder`] update
+/// 
+/// Stored in host byte order, with the layout of this `#[repr(C)]` struct.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct ArrayRecordHeader {
+    /// [`ArrayRecordHeader::MAGIC`]
+    pub magic: u32,
+    /// [`ArrayRecordHeader::VERSION`]
+    pub version: u8,
+    /// PVXS array type code of the elements, 0 for a ring's markers
+    pub element_type: u8,
+    /// Size of one element in bytes
+    pub element_size: u16,
+    /// Update number from 0
+    pub sequence: u64,
+    /// `timeStamp.secondsPastEpoch` of the update
+    pub seconds: i64,
+    /// `timeStamp.nanoseconds` of the update
+    pub nanoseconds: u32,
+    /// [`ArrayRecordHeader::WRAP`] or [`ArrayRecordHeader::END`] for a marker, 0 for a record
+    pub marker: u32,
+    /// Number of elements following the header, for an end marker the
+    /// offset of the oldest record
+    pub count: u64,
+}
+
+impl ArrayRecordHeader {
+    /// "PVAR" read as a little-endian `u32`
+    pub const MAGIC: u32 = 0x5241_5650;
+    pub const VERSION: u8 = 1;
+    /// Size of the header in the file
+    pub const SIZE: usize = 40;
+    /// Marker where a lap of a ring stopped
+    pub const WRAP: u32 = 1;
+    /// Marker after the newest record of a ring
+    pub const END: u32 = 2;
+
+    /// Decode a header from the start of `bytes`, `None` if too short or the magic doesn't match
+    pub fn parse(bytes: &[u8]) -> Option<Self> {
+        if bytes.len() < Self::SIZE {
+            return None;
+        }
+        let u32_at = |at: usize| u32::from_ne_bytes(bytes[at..at + 4].try_into().unwrap());
+        let u64_at = |at: usize| u64::from_ne_bytes(bytes[at..at + 8].try_into().unwrap());
+        let header = Self {
+            magic: u32_at(0),
+            version: bytes[4],
+            element_type: bytes[5],
+            element_size: u16::from_ne_bytes([bytes[6], bytes[7]]),
+            sequence: u64_at(8),
+            seconds: u64_at(16) as i64,
+            nanoseconds: u32_at(24),
+            marker: u32_at(28),
+            count: u64_at(32),
+        };
+        if header.magic == Self::MAGIC { Some(header) } else { None }
+    }
+
+    /// Check if this is a marker rather than a record
+    pub fn is_marker(&self) -> bool {
+        self.element_type == 0
+    }
+
+    /// Check if this is the wrap marker of a ring
+    pub fn is_wrap(&self) -> bool {
+        self.is_marker() && self.marker == Self::WRAP
+    }
+
+    /// Check if this is the end marker of a ring
+    pub fn is_end(&self) -> bool {
+        self.is_marker() && self.marker == Self::END
+    }
+
+    /// For an end marker, the offset of the oldest record of the previous
+    /// lap still intact, `None` if the ring hasn't wrapped or nothing is left
+    pub fn oldest(&self) -> Option<u64> {
+        if self.is_end() && self.count != 0 { Some(self.count) } else { None }
+    }
+
+    /// Bytes taken by the elements in the file, padding included
+    pub fn padded_len(&self) -> usize {
+        ((self.count as usize * self.element_size as usize) + 7) & !7
+    }
+}
+
+// ============================================================================
+// Histograms
+// ============================================================================
+
+/// A histogram of a PV's values, kept up to date per update and served as a PV
+/// 
+/// Each scalar update adds one sample and each array update adds all of its
+/// elements, binned where the update arrives without passing through Rust.
+/// Counts are adjusted in place, never recomputed from past data. Array
+/// elements of any numeric type are binned straight from the received
+/// buffer in a branch-free loop the compiler vectorizes.
+/// 
+/// With a window, only recent samples are counted. The window is cut into
+/// slices; when a slice falls out of the window, its counts are subtracted.
+/// With one slice the histogram is reset every window. The window only
+/// moves when an update arrives.
+/// 
+/// The published PV is an NTScalar whose `value` holds the bin counts, with
+/// extra `low`, `high`, `underflow`, `overflow` and `entries` fields. NaN
+/// samples count as underflow.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Context, HistogramConfig, Server};
+/// let mut server = Server::from_env()?;
+/// let mut ctx = Context::from_env()?;
+/// // Counts of the last 10 seconds, moving every second
+/// let config = HistogramConfig::new().bins(256).range(-1.0, 1.0).window(10.0, 10);
+/// let mut histogram = ctx.histogram("SCOPE:CH1:WAVEFORM", config)?;
+/// histogram.publish(&mut server, "SCOPE:CH1:HISTOGRAM")?;
+/// histogram.start()?;
+/// server.start()?;
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct Histogram {
+    inner: UniquePtr<HistogramWrapper>,
+}
+
+impl Histogram {
+    /// Serve the histogram as `name`
+    pub fn publish(&mut self, server: &mut Server, name: &str) -> Result<()> {
+        bridge::histogram_publish(self.inner.pin_mut(), server.inner.pin_mut(), name)?;
+        Ok(())
+    }
+
+    /// Zero the counts and subscribe to the PV
+    /// 
+    /// Counters restart from 0.
+    pub fn start(&mut self) -> Result<()> {
+        bridge::histogram_start(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Unsubscribe, keeping the counts
+    pub fn stop(&mut self) -> Result<()> {
+        bridge::histogram_stop(self.inner.pin_mut())?;
+        Ok(())
+    }
+
+    /// Check if the histogram is subscribed
+    pub fn is_running(&self) -> bool {
+        bridge::histogram_is_running(&self.inner)
+    }
+
+    /// Counts of the bins in the window, out of range samples excluded
+    pub fn counts(&self) -> Vec<u64> {
+        bridge::histogram_counts(&self.inner)
+    }
+
+    /// Counters of the current or last run
+    pub fn stats(&self) -> HistogramStats {
+        let mut stats = HistogramStats::default();
+        bridge::histogram_stats(&self.inner, &mut stats.updates, &mut stats.samples, &mut stats.failed,
+                                &mut stats.expired, &mut stats.underflow, &mut stats.overflow);
+        stats
+    }
+}
+
+/// Configuration of a [`Histogram`]
+#[derive(Clone, Debug)]
+pub struct HistogramConfig {
+    bins: u64,
+    low: f64,
+    high: f64,
+    window: f64,
+    slices: u64,
+}
+
+impl HistogramConfig {
+    /// Create a configuration with default values
+    /// 
+    /// Defaults: 100 bins from 0 to 1, no window.
+    pub fn new() -> Self {
+        Self {
+            bins: 100,
+            low: 0.0,
+            high: 1.0,
+            window: 0.0,
+            slices: 1,
+        }
+    }
+
+    /// Set the number of bins, from 1 to 2^24
+    pub fn bins(mut self, bins: u64) -> Self {
+        self.bins = bins;
+        self
+    }
+
+    /// Set the lower edge of the first bin and the upper edge of the last one
+    pub fn range(mut self, low: f64, high: f64) -> Self {
+        self.low = low;
+        self.high = high;
+        self
+    }
+
+    /// Count only the samples of the last `seconds`, moving in `slices` steps
+    /// 
+    /// A `seconds` of 0 counts everything since start.
+    pub fn window(mut self, seconds: f64, slices: u64) -> Self {
+        self.window = seconds;
+        self.slices = slices;
+        self
+    }
+}
+
+impl Default for HistogramConfig {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// Counters of a [`Histogram`]
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct HistogramStats {
+    /// Updates binned
+    pub updates: u64,
+    /// Samples binned, out of range ones included
+    pub samples: u64,
+    /// Updates without a numeric value, and remote errors
+    pub failed: u64,
+    /// Slices which fell out of the window
+    pub expired: u64,
+    /// Samples below the range in the window, NaN included
+    pub underflow: u64,
+    /// Samples at or above the range in the window
+    pub overflow: u64,
+}
+
+// ============================================================================
+// Timeline tracing
+// ============================================================================
+
+/// Process-wide timeline of client and server activity
+/// 
+/// While enabled, client operations (GET, PUT, INFO, RPC), monitor pops,
+/// subscription events, server posts and PUT handlers are recorded into
+/// per-thread buffers. The recording is exported in the Chrome Trace Event
+/// format, which loads directly into `chrome://tracing` or Perfetto.
+/// 
+/// Recording takes no lock once a thread has its buffer. Buffers do not
+/// wrap: when a thread's buffer is full further events are counted in
+/// [`Tracer::dropped_events`] and discarded.
+/// 
+/// # Example
+/// 
+/// ```no_run
+/// # use pvxs_sys::{Context, Tracer};
+/// Tracer::enable(Tracer::DEFAULT_EVENTS_PER_THREAD)?;
+/// let mut ctx = Context::from_env()?;
+/// {
+///     let _span = Tracer::span("read batch");
+///     ctx.get("my:pv:name", 5.0)?;
+/// }
+/// Tracer::disable();
+/// Tracer::write_json("timeline.json")?;
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct Tracer;
+
+impl Tracer {
+    /// Buffer size used when there is no reason to pick another one
+    pub const DEFAULT_EVENTS_PER_THREAD: u64 = 65536;
+
+    /// Start a new recording, discarding any earlier one
+    /// 
+    /// # Arguments
+    /// 
+    /// * `events_per_thread` - Events each thread can record before dropping
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if `events_per_thread` is 0.
+    pub fn enable(events_per_thread: u64) -> Result<()> {
+        bridge::trace_enable(events_per_thread)?;
+        Ok(())
+    }
+
+    /// Stop recording; the events recorded so far are kept for export
+    pub fn disable() {
+        bridge::trace_disable();
+    }
+
+    /// Check whether events are being recorded
+    pub fn is_enabled() -> bool {
+        bridge::trace_is_enabled()
+    }
+
+    /// Discard recorded events; recording continues if enabled
+    pub fn clear() {
+        bridge::trace_clear();
+    }
+
+    /// Number of events discarded because a thread's buffer was full
+    pub fn dropped_events() -> u64 {
+        bridge::trace_dropped()
+    }
+
+    /// Export the recording as Chrome Trace Event JSON
+    pub fn to_json() -> String {
+        bridge::trace_to_json()
+    }
+
+    /// Write the recording as Chrome Trace Event JSON to a file
+    /// 
+    /// # Errors
+    /// 
+    /// Returns an error if the file cannot be written.
+    pub fn write_json(path: impl AsRef<std::path::Path>) -> Result<()> {
+        let path = path.as_ref();
+        std::fs::write(path, Self::to_json())
+            .map_err(|e| PvxsError::new(format!("Failed to write trace to '{}': {}", path.display(), e)))
+    }
+
+    /// Record a single point in time on the calling thread
+    pub fn instant(name: &str) {
+        bridge::trace_instant(name);
+    }
+
+    /// Record a span on the calling thread lasting until the guard is dropped
+    pub fn span(name: &str) -> TraceSpan {
+        let active = bridge::trace_is_enabled();
+        if active {
+            bridge::trace_begin(name);
+        }
+        TraceSpan { name: name.to_string(), active }
+    }
+}
+
+/// Guard returned by [`Tracer::span`]
+/// 
+/// Must be dropped on the thread which created it.
+pub struct TraceSpan {
+    name: String,
+    active: bool,
+}
+
+impl Drop for TraceSpan {
+    fn drop(&mut self) {
+        if self.active {
+            bridge::trace_end(&self.name);
+        }
+    }
+}
+
+// ============================================================================
+// Process diagnostics
+// ============================================================================
+
+/// Memory and object counters for spotting leaks in long-running processes
+///
+/// # Example
+///
+/// ```no_run
+/// # use pvxs_sys::Diagnostics;
+/// if let Some(rss) = Diagnostics::resident_memory() {
+///     println!("RSS: {} KiB", rss / 1024);
+/// }
+/// for (name, count) in Diagnostics::instance_counts()? {
+///     println!("{}: {}", name, count);
+/// }
+/// # Ok::<(), pvxs_sys::PvxsError>(())
+/// ```
+pub struct Diagnostics;
+
+impl Diagnostics {
+    /// Live objects counted by PVXS, keyed by type name
+    ///
+    /// Counts of client operations, subscriptions, connections and values
+    /// which keep growing under a steady load point at a leak.
+    pub fn instance_counts() -> Result<std::collections::BTreeMap<String, u64>> {
+        let mut names = Vec::new();
+        let mut counts = Vec::new();
+        bridge::diagnostics_instance_counts(&mut names, &mut counts)?;
+        Ok(names.into_iter().zip(counts).collect())
+    }
+
+    /// Resident set size of the process in bytes
+    ///
+    /// Returns `None` on platforms where it cannot be read.
+    pub fn resident_memory() -> Option<u64> {
+        match bridge::diagnostics_resident_memory() {
+            0 => None,
+            bytes => Some(bytes),
+        }
+    }
+
+    /// Heap statistics of the C allocator, which also serves Rust allocations
+    ///
+    /// Returns `None` when the allocator does not report statistics.
+    pub fn allocator_stats() -> Option<AllocatorStats> {
+        let mut stats = AllocatorStats::default();
+        if bridge::diagnostics_allocator_stats(&mut stats.in_use, &mut stats.free, &mut stats.mapped) {
+            Some(stats)
+        } else {
+            None
+        }
+    }
+}
+
+/// Heap statistics reported by the C allocator
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct AllocatorStats {
+    /// Bytes in allocated blocks
+    pub in_use: u64,
+    /// Bytes held by the allocator but not allocated
+    pub free: u64,
+    /// Bytes obtained from the operating system
+    pub mapped: u64,
+}
+
 // ============================================================================
 // NTScalar Metadata Support with C++ std::optional
 // ============================================================================
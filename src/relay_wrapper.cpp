@@ -0,0 +1,252 @@
+// relay_wrapper.cpp - Client subscriptions republished through local SharedPVs
+
+#include "wrapper.h"
+#include <algorithm>
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    // Apply fn to each element of a numeric scalar or array field
+    template <typename Fn>
+    void map_numeric(pvxs::Value &field, const char *step, Fn &&fn) {
+        switch (field.storageType()) {
+        case pvxs::StoreType::Integer:
+        case pvxs::StoreType::UInteger:
+        case pvxs::StoreType::Real:
+            field = fn(field.as<double>());
+            break;
+        case pvxs::StoreType::Array: {
+            // as<>() converts integer arrays, assignment converts back to the field's element type
+            auto input = field.as<pvxs::shared_array<const double>>();
+            pvxs::shared_array<double> output(input.size());
+            for (size_t i = 0; i < input.size(); i++) {
+                output[i] = fn(input[i]);
+            }
+            field = output.freeze();
+            break;
+        }
+        default:
+            throw PvxsError(std::string(step) + " needs a numeric value field");
+        }
+    }
+
+} // namespace
+
+// ============================================================================
+// RelayWrapper implementation
+// ============================================================================
+
+RelayWrapper::RelayWrapper(const pvxs::client::Context& ctx, int priority, const std::string& upstream, const SharedPVWrapper& target)
+    : context_(ctx), priority_(priority), state_(std::make_shared<State>()) {
+    state_->upstream = upstream;
+    state_->pv = target.get();
+    state_->hub = target.hub();
+}
+
+RelayWrapper::~RelayWrapper() {
+    stop();
+}
+
+void RelayWrapper::add(const RelayTransform& transform) {
+    if (subscription_) {
+        throw PvxsError("Relay for '" + state_->upstream + "' can't be changed while running");
+    }
+    if (transform.kind == RelayTransform::Kind::Decimate && transform.every == 0) {
+        throw PvxsError("Relay decimation factor must be at least 1");
+    }
+    if (transform.kind == RelayTransform::Kind::Clamp && !(transform.a <= transform.b)) {
+        throw PvxsError("Relay clamp needs low <= high");
+    }
+    if (transform.kind == RelayTransform::Kind::Remap && (transform.field.empty() || transform.source.empty())) {
+        throw PvxsError("Relay remap needs both field names");
+    }
+    transforms_.push_back(transform);
+}
+
+void RelayWrapper::start() {
+    if (subscription_) {
+        return;
+    }
+    auto state = state_;
+    try {
+        if (!state->pv.isOpen()) {
+            throw PvxsError("target SharedPV is not open");
+        }
+        state->prototype = state->pv.fetch().cloneEmpty();
+
+        // Remaps only decide where outgoing fields come from, the remaining steps run in order
+        state->fields = {{"value", "value"}, {"alarm", "alarm"}, {"timeStamp", "timeStamp"}};
+        state->chain.clear();
+        for (const auto& t : transforms_) {
+            if (t.kind != RelayTransform::Kind::Remap) {
+                state->chain.push_back(t);
+                continue;
+            }
+            auto it = std::find_if(state->fields.begin(), state->fields.end(),
+                                   [&t](const std::pair<std::string, std::string>& f) { return f.first == t.field; });
+            if (it != state->fields.end()) {
+                it->second = t.source;
+            } else {
+                state->fields.emplace_back(t.field, t.source);
+            }
+        }
+        state->seen.assign(state->chain.size(), 0);
+
+        Tracer::instant("relay", "subscribe", state->upstream);
+        subscription_ = context_.monitor(state->upstream)
+            .priority(priority_)
+            .maskConnected(true)
+            .maskDisconnected(false)
+            .event([state](pvxs::client::Subscription& sub) {
+                while (true) {
+                    try {
+                        auto update = sub.pop();
+                        if (!update) {
+                            break;
+                        }
+                        TraceSpan span("relay", "forward", state->upstream);
+                        if (state->forward(update)) {
+                            state->forwarded.fetch_add(1, std::memory_order_relaxed);
+                        } else {
+                            state->decimated.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    } catch (const pvxs::client::Finished&) {
+                        // Derives from Disconnect, so caught first
+                        break;
+                    } catch (const pvxs::client::Disconnect&) {
+                        state->disconnected();
+                    } catch (const std::exception&) {
+                        // Remote errors and updates the transforms can't handle
+                        state->failed.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            })
+            .exec();
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error starting relay for '") + state->upstream + "': " + e.what());
+    }
+}
+
+void RelayWrapper::stop() {
+    if (subscription_) {
+        subscription_.reset();
+    }
+}
+
+RelayWrapper::Stats RelayWrapper::stats() const {
+    Stats stats;
+    stats.forwarded = state_->forwarded.load(std::memory_order_relaxed);
+    stats.decimated = state_->decimated.load(std::memory_order_relaxed);
+    stats.failed = state_->failed.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool RelayWrapper::State::forward(const pvxs::Value& update) {
+    // Only Decimate steps drop updates, so they can all be checked before copying anything.
+    // A later step only counts the updates an earlier one let through
+    for (size_t i = 0; i < chain.size(); i++) {
+        if (chain[i].kind == RelayTransform::Kind::Decimate && seen[i]++ % chain[i].every != 0) {
+            return false;
+        }
+    }
+
+    auto out = prototype.cloneEmpty();
+    for (const auto& f : fields) {
+        auto src = update[f.second];
+        auto dst = out[f.first];
+        if (src && dst && src.isMarked(true, true)) {
+            dst.assign(src);
+        }
+    }
+
+    auto value = out["value"];
+    if (value && value.isMarked()) {
+        for (const auto& t : chain) {
+            if (t.kind == RelayTransform::Kind::Scale) {
+                map_numeric(value, "scale", [&t](double v) { return v * t.a + t.b; });
+            } else if (t.kind == RelayTransform::Kind::Clamp) {
+                map_numeric(value, "clamp", [&t](double v) { return std::min(std::max(v, t.a), t.b); });
+            }
+        }
+    }
+
+    hub->post(pv, out);
+    return true;
+}
+
+void RelayWrapper::State::disconnected() {
+    auto out = prototype.cloneEmpty();
+    auto alarm = out["alarm"];
+    if (!alarm) {
+        return;
+    }
+    alarm["severity"] = 3; // INVALID
+    alarm["status"] = 1;   // DEVICE
+    alarm["message"] = std::string("Upstream disconnected");
+    try {
+        hub->post(pv, out);
+    } catch (const std::exception&) {
+        failed.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// Bridge functions for relays
+// ============================================================================
+
+std::unique_ptr<RelayWrapper> context_relay_create(ContextWrapper& ctx, rust::String upstream, const SharedPVWrapper& target) {
+    return ctx.relay_create(std::string(upstream), target);
+}
+
+void relay_add_scale(RelayWrapper& relay, double factor, double offset) {
+    RelayTransform t;
+    t.kind = RelayTransform::Kind::Scale;
+    t.a = factor;
+    t.b = offset;
+    relay.add(t);
+}
+
+void relay_add_clamp(RelayWrapper& relay, double low, double high) {
+    RelayTransform t;
+    t.kind = RelayTransform::Kind::Clamp;
+    t.a = low;
+    t.b = high;
+    relay.add(t);
+}
+
+void relay_add_decimate(RelayWrapper& relay, uint64_t every) {
+    RelayTransform t;
+    t.kind = RelayTransform::Kind::Decimate;
+    t.every = every;
+    relay.add(t);
+}
+
+void relay_add_remap(RelayWrapper& relay, rust::Str from, rust::Str to) {
+    RelayTransform t;
+    t.kind = RelayTransform::Kind::Remap;
+    t.source = std::string(from);
+    t.field = std::string(to);
+    relay.add(t);
+}
+
+void relay_start(RelayWrapper& relay) {
+    relay.start();
+}
+
+void relay_stop(RelayWrapper& relay) {
+    relay.stop();
+}
+
+bool relay_is_running(const RelayWrapper& relay) {
+    return relay.is_running();
+}
+
+void relay_stats(const RelayWrapper& relay, uint64_t& forwarded, uint64_t& decimated, uint64_t& failed) {
+    auto stats = relay.stats();
+    forwarded = stats.forwarded;
+    decimated = stats.decimated;
+    failed = stats.failed;
+}
+
+} // namespace pvxs_wrapper
@@ -4,6 +4,7 @@
 #include <sstream>
 #include <chrono>
 #include <thread>
+#include <algorithm>
 #include <pvxs/log.h>
 
 namespace pvxs_wrapper {
@@ -17,17 +18,49 @@ void SharedPVWrapper::open(const ValueWrapper& initial_value) {
         // Store the template value for future cloneEmpty() operations
         template_value_ = initial_value.get();
         pv_.open(initial_value.get());
+        hub_->open(initial_value.get());
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error opening SharedPV: ") + e.what());
     }
 }
 
+void SharedPVWrapper::check_enum_puts() {
+    auto choices = template_value_["value.choices"].as<pvxs::shared_array<const std::string>>();
+    // Add an onPut handler to validate enum indices
+    auto hub = hub_;
+    auto onPut = [choices, hub](pvxs::server::SharedPV& spv, std::unique_ptr<pvxs::server::ExecOp>&& op, pvxs::Value&& value) {
+        TraceSpan span("server", "onPut", hub->name());
+        try {
+            // Check if value.index is being set
+            auto new_index = value["value.index"].as<int16_t>();
+            
+            // Validate the index
+            if (new_index < 0) {
+                op->error("Enum index cannot be negative");
+                return;
+            }
+            if (static_cast<size_t>(new_index) >= choices.size()) {
+                op->error("Enum index " + std::to_string(new_index) + " is out of range (max: " + std::to_string(choices.size() - 1) + ")");
+                return;
+            }
+            
+            // If validation passes, apply the update
+            hub->post(spv, value);
+            op->reply();
+        } catch (const std::exception& e) {
+            op->error(std::string("Error validating enum PUT: ") + e.what());
+        }
+    };
+    pv_.onPut(onPut);
+}
+
 bool SharedPVWrapper::is_open() const {
     return pv_.isOpen();
 }
 
 void SharedPVWrapper::close() {
     try {
+        hub_->close();
         pv_.close();
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error closing SharedPV: ") + e.what());
@@ -36,7 +69,7 @@ void SharedPVWrapper::close() {
 
 void SharedPVWrapper::post_value(const ValueWrapper& value) {
     try {
-        pv_.post(value.get());
+        hub_->post(pv_, value.get());
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error posting value to SharedPV: ") + e.what());
     }
@@ -54,7 +87,24 @@ std::unique_ptr<ValueWrapper> SharedPVWrapper::fetch_value() const {
 std::unique_ptr<SharedPVWrapper> SharedPVWrapper::create_mailbox() {
     try {
         auto pv = pvxs::server::SharedPV::buildMailbox();
-        return std::make_unique<SharedPVWrapper>(std::move(pv));
+        auto wrapper = std::make_unique<SharedPVWrapper>(std::move(pv));
+        wrapper->mailbox_ = true;
+
+        // Same as the pvxs mailbox, except that puts reach subscribers through the hub
+        auto hub = wrapper->hub();
+        wrapper->get().onPut([hub](pvxs::server::SharedPV& spv, std::unique_ptr<pvxs::server::ExecOp>&& op, pvxs::Value&& value) {
+            TraceSpan span("server", "onPut", hub->name());
+            auto ts = value["timeStamp"];
+            if (ts && !ts.isMarked(true, true)) {
+                auto now = std::chrono::system_clock::now().time_since_epoch();
+                auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+                ts["secondsPastEpoch"] = static_cast<int64_t>(seconds.count());
+                ts["nanoseconds"] = static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count());
+            }
+            hub->post(spv, value);
+            op->reply();
+        });
+        return wrapper;
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error creating mailbox SharedPV: ") + e.what());
     }
@@ -110,6 +160,10 @@ std::unique_ptr<StaticSourceWrapper> StaticSourceWrapper::create() {
 // ServerWrapper implementation
 // ============================================================================
 
+ServerWrapper::ServerWrapper(pvxs::server::Server&& server) : server_(std::move(server)) {
+    server_.addSource("pvxs_sys", source_, 0);
+}
+
 void ServerWrapper::start() {
     try {
         server_.start();
@@ -128,7 +182,7 @@ void ServerWrapper::stop() {
 
 void ServerWrapper::add_pv(const std::string& name, SharedPVWrapper& pv) {
     try {
-        server_.addPV(name, pv.get());
+        source_->add(name, pv);
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error adding PV '") + name + "' to server: " + e.what());
     }
@@ -136,7 +190,7 @@ void ServerWrapper::add_pv(const std::string& name, SharedPVWrapper& pv) {
 
 void ServerWrapper::remove_pv(const std::string& name) {
     try {
-        server_.removePV(name);
+        source_->remove(name);
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error removing PV '") + name + "' from server: " + e.what());
     }
@@ -150,6 +204,25 @@ void ServerWrapper::add_source(const std::string& name, StaticSourceWrapper& sou
     }
 }
 
+void ServerWrapper::enable_send_limits(const SendLimiter::Config& config, void (*alert)()) {
+    if (!config.max_queued_per_client && !config.alert_queued_per_client) {
+        throw PvxsError("Send limits need a queue limit or an alert threshold");
+    }
+    SendLimiter::Config effective = config;
+    if (!effective.alert_queued_per_client) {
+        // Report a client well before it reaches the point where its updates get squashed
+        effective.alert_queued_per_client = std::max<size_t>(1, config.max_queued_per_client * 3 / 4);
+    } else if (config.max_queued_per_client && config.alert_queued_per_client > config.max_queued_per_client) {
+        throw PvxsError("Alert threshold " + std::to_string(config.alert_queued_per_client) +
+                        " exceeds the queue limit " + std::to_string(config.max_queued_per_client));
+    }
+    source_->set_limiter(std::make_shared<SendLimiter>(effective, alert));
+}
+
+void ServerWrapper::disable_send_limits() {
+    source_->set_limiter(nullptr);
+}
+
 uint16_t ServerWrapper::get_tcp_port() const {
     try {
         return server_.config().tcp_port;
@@ -166,6 +239,15 @@ uint16_t ServerWrapper::get_udp_port() const {
     }
 }
 
+std::unique_ptr<ContextWrapper> ServerWrapper::client_context() const {
+    try {
+        auto ctx = server_.clientConfig().build();
+        return std::make_unique<ContextWrapper>(std::move(ctx));
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error creating client context for server: ") + e.what());
+    }
+}
+
 std::unique_ptr<ServerWrapper> ServerWrapper::from_env() {
     try {
         auto server = pvxs::server::Server::fromEnv();
@@ -197,6 +279,10 @@ std::unique_ptr<ServerWrapper> server_create_isolated() {
     return ServerWrapper::isolated();
 }
 
+std::unique_ptr<ContextWrapper> server_create_client_context(const ServerWrapper& server) {
+    return server.client_context();
+}
+
 void server_start(ServerWrapper& server) {
     server.start();
 }
@@ -414,62 +500,84 @@ std::unique_ptr<NTEnumMetadata> create_enum_metadata(const NTScalarAlarm& alarm,
 // SharedPV Operations
 // ============================================================================
 
-void shared_pv_open_double(SharedPVWrapper& pv, double initial_value, const NTScalarMetadata& metadata) {
-    try {
-        // Create NTScalar with flags from metadata
-        auto initial = pvxs::nt::NTScalar{
-            pvxs::TypeCode::Float64,
-            metadata.display.has_value(),
-            metadata.control.has_value(),
-            metadata.value_alarm.has_value(),
-            metadata.has_form
-        }.create();
-        
-        initial["value"] = initial_value;
-        
-        // Always set alarm and timeStamp
-        initial["alarm.severity"] = metadata.alarm.severity;
-        initial["alarm.status"] = metadata.alarm.status;
-        initial["alarm.message"] = std::string(metadata.alarm.message);
-        
-        initial["timeStamp.secondsPastEpoch"] = metadata.time_stamp.seconds_past_epoch;
-        initial["timeStamp.nanoseconds"] = metadata.time_stamp.nanoseconds;
-        initial["timeStamp.userTag"] = metadata.time_stamp.user_tag;
-        
-        // Optional: display fields
-        if (metadata.display.has_value()) {
-            const auto& disp = metadata.display.value();
-            initial["display.limitLow"] = disp.limit_low;
-            initial["display.limitHigh"] = disp.limit_high;
-            initial["display.description"] = std::string(disp.description);
-            initial["display.units"] = std::string(disp.units);
-            if (metadata.has_form) {
-                initial["display.precision"] = disp.precision;
-            }
+pvxs::Value create_nt_scalar(pvxs::TypeCode code, const NTScalarMetadata& metadata) {
+    auto initial = pvxs::nt::NTScalar{
+        code,
+        metadata.display.has_value(),
+        metadata.control.has_value(),
+        metadata.value_alarm.has_value(),
+        metadata.has_form
+    }.create();
+    initial["alarm.severity"] = metadata.alarm.severity;
+    initial["alarm.status"] = metadata.alarm.status;
+    initial["alarm.message"] = std::string(metadata.alarm.message);
+    initial["timeStamp.secondsPastEpoch"] = metadata.time_stamp.seconds_past_epoch;
+    initial["timeStamp.nanoseconds"] = metadata.time_stamp.nanoseconds;
+    initial["timeStamp.userTag"] = metadata.time_stamp.user_tag;
+    if (metadata.display.has_value()) {
+        const auto& disp = metadata.display.value();
+        initial["display.limitLow"] = disp.limit_low;
+        initial["display.limitHigh"] = disp.limit_high;
+        initial["display.description"] = std::string(disp.description);
+        initial["display.units"] = std::string(disp.units);
+        if (metadata.has_form) {
+            initial["display.precision"] = disp.precision;
         }
-        
-        // Optional: control fields
-        if (metadata.control.has_value()) {
-            const auto& ctrl = metadata.control.value();
-            initial["control.limitLow"] = ctrl.limit_low;
-            initial["control.limitHigh"] = ctrl.limit_high;
-            initial["control.minStep"] = ctrl.min_step;
+    }
+    if (metadata.control.has_value()) {
+        const auto& ctrl = metadata.control.value();
+        initial["control.limitLow"] = ctrl.limit_low;
+        initial["control.limitHigh"] = ctrl.limit_high;
+        initial["control.minStep"] = ctrl.min_step;
+    }
+    if (metadata.value_alarm.has_value()) {
+        const auto& valarm = metadata.value_alarm.value();
+        initial["valueAlarm.active"] = valarm.active;
+        initial["valueAlarm.lowAlarmLimit"] = valarm.low_alarm_limit;
+        initial["valueAlarm.lowWarningLimit"] = valarm.low_warning_limit;
+        initial["valueAlarm.highWarningLimit"] = valarm.high_warning_limit;
+        initial["valueAlarm.highAlarmLimit"] = valarm.high_alarm_limit;
+        initial["valueAlarm.lowAlarmSeverity"] = valarm.low_alarm_severity;
+        initial["valueAlarm.lowWarningSeverity"] = valarm.low_warning_severity;
+        initial["valueAlarm.highWarningSeverity"] = valarm.high_warning_severity;
+        initial["valueAlarm.highAlarmSeverity"] = valarm.high_alarm_severity;
+    }
+    return initial;
+}
+
+namespace {
+
+    // Open an NTScalar whose value keeps the native width of T (a scalar or a shared_array)
+    template <typename T>
+    void open_native(SharedPVWrapper& pv, pvxs::TypeCode code, const T& initial_value,
+                     const NTScalarMetadata& metadata, const char* type) {
+        try {
+            auto initial = create_nt_scalar(code, metadata);
+            initial["value"] = initial_value;
+            pv.open(ValueWrapper(std::move(initial)));
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error opening SharedPV with ") + type + " value: " + e.what());
         }
-        
-        // Optional: valueAlarm fields
-        if (metadata.value_alarm.has_value()) {
-            const auto& valarm = metadata.value_alarm.value();
-            initial["valueAlarm.active"] = valarm.active;
-            initial["valueAlarm.lowAlarmLimit"] = valarm.low_alarm_limit;
-            initial["valueAlarm.lowWarningLimit"] = valarm.low_warning_limit;
-            initial["valueAlarm.highWarningLimit"] = valarm.high_warning_limit;
-            initial["valueAlarm.highAlarmLimit"] = valarm.high_alarm_limit;
-            initial["valueAlarm.lowAlarmSeverity"] = valarm.low_alarm_severity;
-            initial["valueAlarm.lowWarningSeverity"] = valarm.low_warning_severity;
-            initial["valueAlarm.highWarningSeverity"] = valarm.high_warning_severity;
-            initial["valueAlarm.highAlarmSeverity"] = valarm.high_alarm_severity;
+    }
+
+    template <typename T>
+    void post_native(SharedPVWrapper& pv, const T& value, const char* type) {
+        try {
+            auto update = pv.get_template().cloneEmpty();
+            update["value"] = value;
+            pv.post_value(ValueWrapper(std::move(update)));
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error posting ") + type + " value to SharedPV: " + e.what());
         }
-        
+    }
+
+} // namespace
+
+void shared_pv_open_double(SharedPVWrapper& pv, double initial_value, const NTScalarMetadata& metadata) {
+    try {
+        auto initial = create_nt_scalar(pvxs::TypeCode::Float64, metadata);
+        initial["value"] = initial_value;
+
         ValueWrapper wrapper(std::move(initial));
         pv.open(wrapper);
     } catch (const std::exception& e) {
@@ -479,64 +587,14 @@ void shared_pv_open_double(SharedPVWrapper& pv, double initial_value, const NTSc
 
 void shared_pv_open_double_array(SharedPVWrapper& pv, rust::Vec<double> initial_value, const NTScalarMetadata& metadata) {
     try {
-        // Create NTScalar with array value using flags from metadata
-        auto initial = pvxs::nt::NTScalar{
-            pvxs::TypeCode::Float64A,  // Float64A for arrays
-            metadata.display.has_value(),
-            metadata.control.has_value(),
-            metadata.value_alarm.has_value(),
-            metadata.has_form
-        }.create();
-        
+        auto initial = create_nt_scalar(pvxs::TypeCode::Float64A, metadata);
+
         // Convert rust::Vec to pvxs::shared_array
         pvxs::shared_array<double> arr(initial_value.size());
         for (size_t i = 0; i < initial_value.size(); ++i) {
             arr[i] = initial_value[i];
         }
         initial["value"] = arr.freeze();
-        
-        // Always set alarm and timeStamp
-        initial["alarm.severity"] = metadata.alarm.severity;
-        initial["alarm.status"] = metadata.alarm.status;
-        initial["alarm.message"] = std::string(metadata.alarm.message);
-        
-        initial["timeStamp.secondsPastEpoch"] = metadata.time_stamp.seconds_past_epoch;
-        initial["timeStamp.nanoseconds"] = metadata.time_stamp.nanoseconds;
-        initial["timeStamp.userTag"] = metadata.time_stamp.user_tag;
-        
-        // Optional: display fields
-        if (metadata.display.has_value()) {
-            const auto& disp = metadata.display.value();
-            initial["display.limitLow"] = disp.limit_low;
-            initial["display.limitHigh"] = disp.limit_high;
-            initial["display.description"] = std::string(disp.description);
-            initial["display.units"] = std::string(disp.units);
-            if (metadata.has_form) {
-                initial["display.precision"] = disp.precision;
-            }
-        }
-        
-        // Optional: control fields
-        if (metadata.control.has_value()) {
-            const auto& ctrl = metadata.control.value();
-            initial["control.limitLow"] = ctrl.limit_low;
-            initial["control.limitHigh"] = ctrl.limit_high;
-            initial["control.minStep"] = ctrl.min_step;
-        }
-        
-        // Optional: valueAlarm fields
-        if (metadata.value_alarm.has_value()) {
-            const auto& valarm = metadata.value_alarm.value();
-            initial["valueAlarm.active"] = valarm.active;
-            initial["valueAlarm.lowAlarmLimit"] = valarm.low_alarm_limit;
-            initial["valueAlarm.lowWarningLimit"] = valarm.low_warning_limit;
-            initial["valueAlarm.highWarningLimit"] = valarm.high_warning_limit;
-            initial["valueAlarm.highAlarmLimit"] = valarm.high_alarm_limit;
-            initial["valueAlarm.lowAlarmSeverity"] = valarm.low_alarm_severity;;
-            initial["valueAlarm.lowWarningSeverity"] = valarm.low_warning_severity;
-            initial["valueAlarm.highWarningSeverity"] = valarm.high_warning_severity;
-            initial["valueAlarm.highAlarmSeverity"] = valarm.high_alarm_severity;
-        }
 
         ValueWrapper wrapper(std::move(initial));
         pv.open(wrapper);
@@ -547,56 +605,9 @@ void shared_pv_open_double_array(SharedPVWrapper& pv, rust::Vec<double> initial_
 
 void shared_pv_open_int32(SharedPVWrapper& pv, int32_t initial_value, const NTScalarMetadata& metadata) {
     try {
-        // Create an NTScalar with int32 value using flags from metadata
-        auto initial = pvxs::nt::NTScalar{
-            pvxs::TypeCode::Int32,
-            metadata.display.has_value(),
-            metadata.control.has_value(),
-            metadata.value_alarm.has_value(),
-            metadata.has_form
-        }.create();
-
+        auto initial = create_nt_scalar(pvxs::TypeCode::Int32, metadata);
         initial["value"] = initial_value;
 
-        // Always set alarm and timeStamp
-        initial["alarm.severity"] = metadata.alarm.severity;
-        initial["alarm.status"] = metadata.alarm.status;
-        initial["alarm.message"] = std::string(metadata.alarm.message);
-        initial["timeStamp.secondsPastEpoch"] = metadata.time_stamp.seconds_past_epoch;
-        initial["timeStamp.nanoseconds"] = metadata.time_stamp.nanoseconds;
-        initial["timeStamp.userTag"] = metadata.time_stamp.user_tag;
-        // Optional: display fields
-        if (metadata.display.has_value()) {
-            const auto& disp = metadata.display.value();
-            initial["display.limitLow"] = disp.limit_low;
-            initial["display.limitHigh"] = disp.limit_high;
-            initial["display.description"] = std::string(disp.description);
-            initial["display.units"] = std::string(disp.units);
-            if (metadata.has_form) {
-                initial["display.precision"] = disp.precision;
-            }
-        }
-        // Optional: control fields
-        if (metadata.control.has_value()) {
-            const auto& ctrl = metadata.control.value();
-            initial["control.limitLow"] = ctrl.limit_low;
-            initial["control.limitHigh"] = ctrl.limit_high;
-            initial["control.minStep"] = ctrl.min_step;
-        }
-        // Optional: valueAlarm fields
-        if (metadata.value_alarm.has_value()) {
-            const auto& valarm = metadata.value_alarm.value();
-            initial["valueAlarm.active"] = valarm.active;
-            initial["valueAlarm.lowAlarmLimit"] = valarm.low_alarm_limit;
-            initial["valueAlarm.lowWarningLimit"] = valarm.low_warning_limit;
-            initial["valueAlarm.highWarningLimit"] = valarm.high_warning_limit;
-            initial["valueAlarm.highAlarmLimit"] = valarm.high_alarm_limit;
-            initial["valueAlarm.lowAlarmSeverity"] = valarm.low_alarm_severity;
-            initial["valueAlarm.lowWarningSeverity"] = valarm.low_warning_severity;
-            initial["valueAlarm.highWarningSeverity"] = valarm.high_warning_severity;
-            initial["valueAlarm.highAlarmSeverity"] = valarm.high_alarm_severity;
-        }
-        
         ValueWrapper wrapper(std::move(initial));
         pv.open(wrapper);
     } catch (const std::exception& e) {
@@ -606,64 +617,14 @@ void shared_pv_open_int32(SharedPVWrapper& pv, int32_t initial_value, const NTSc
 
 void shared_pv_open_int32_array(SharedPVWrapper& pv, rust::Vec<int32_t> initial_value, const NTScalarMetadata& metadata) {
     try {
-        // Create NTScalar with array value using flags from metadata
-        auto initial = pvxs::nt::NTScalar{
-            pvxs::TypeCode::Int32A,  // Int32A for arrays
-            metadata.display.has_value(),
-            metadata.control.has_value(),
-            metadata.value_alarm.has_value(),
-            metadata.has_form
-        }.create();
-        
+        auto initial = create_nt_scalar(pvxs::TypeCode::Int32A, metadata);
+
         // Convert rust::Vec to pvxs::shared_array
         pvxs::shared_array<int32_t> arr(initial_value.size());
         for (size_t i = 0; i < initial_value.size(); ++i) {
             arr[i] = initial_value[i];
         }
         initial["value"] = arr.freeze();
-        
-        // Always set alarm and timeStamp
-        initial["alarm.severity"] = metadata.alarm.severity;
-        initial["alarm.status"] = metadata.alarm.status;
-        initial["alarm.message"] = std::string(metadata.alarm.message);
-        
-        initial["timeStamp.secondsPastEpoch"] = metadata.time_stamp.seconds_past_epoch;
-        initial["timeStamp.nanoseconds"] = metadata.time_stamp.nanoseconds;
-        initial["timeStamp.userTag"] = metadata.time_stamp.user_tag;
-        
-        // Optional: display fields
-        if (metadata.display.has_value()) {
-            const auto& disp = metadata.display.value();
-            initial["display.limitLow"] = disp.limit_low;
-            initial["display.limitHigh"] = disp.limit_high;
-            initial["display.description"] = std::string(disp.description);
-            initial["display.units"] = std::string(disp.units);
-            if (metadata.has_form) {
-                initial["display.precision"] = disp.precision;
-            }
-        }
-        
-        // Optional: control fields
-        if (metadata.control.has_value()) {
-            const auto& ctrl = metadata.control.value();
-            initial["control.limitLow"] = ctrl.limit_low;
-            initial["control.limitHigh"] = ctrl.limit_high;
-            initial["control.minStep"] = ctrl.min_step;
-        }
-        
-        // Optional: valueAlarm fields
-        if (metadata.value_alarm.has_value()) {
-            const auto& valarm = metadata.value_alarm.value();
-            initial["valueAlarm.active"] = valarm.active;
-            initial["valueAlarm.lowAlarmLimit"] = valarm.low_alarm_limit;
-            initial["valueAlarm.lowWarningLimit"] = valarm.low_warning_limit;
-            initial["valueAlarm.highWarningLimit"] = valarm.high_warning_limit;
-            initial["valueAlarm.highAlarmLimit"] = valarm.high_alarm_limit;
-            initial["valueAlarm.lowAlarmSeverity"] = valarm.low_alarm_severity;;
-            initial["valueAlarm.lowWarningSeverity"] = valarm.low_warning_severity;
-            initial["valueAlarm.highWarningSeverity"] = valarm.high_warning_severity;
-            initial["valueAlarm.highAlarmSeverity"] = valarm.high_alarm_severity;
-        }
 
         ValueWrapper wrapper(std::move(initial));
         pv.open(wrapper);
@@ -771,33 +732,9 @@ void shared_pv_open_enum(SharedPVWrapper& pv, rust::Vec<rust::String> enum_choic
         // Try to assign the shared_array
         enums["value.choices"].from(choices_array);
 
-        // Add an onPut handler to validate enum indices
-        auto onPut = [choices_array](pvxs::server::SharedPV& spv, std::unique_ptr<pvxs::server::ExecOp>&& op, pvxs::Value&& value) {
-            try {
-                // Check if value.index is being set
-                auto new_index = value["value.index"].as<int16_t>();
-                
-                // Validate the index
-                if (new_index < 0) {
-                    op->error("Enum index cannot be negative");
-                    return;
-                }
-                if (static_cast<size_t>(new_index) >= choices_array.size()) {
-                    op->error("Enum index " + std::to_string(new_index) + " is out of range (max: " + std::to_string(choices_array.size() - 1) + ")");
-                    return;
-                }
-                
-                // If validation passes, apply the update
-                spv.post(std::move(value));
-                op->reply();
-            } catch (const std::exception& e) {
-                op->error(std::string("Error validating enum PUT: ") + e.what());
-            }
-        };
-
         ValueWrapper wrapper(std::move(enums));
         pv.open(wrapper);
-        pv.get().onPut(onPut);
+        pv.check_enum_puts();
     } catch (const std::exception& e) {
         throw PvxsError(std::string("Error opening SharedPV with enum value: ") + e.what());
     }
@@ -921,6 +858,150 @@ void shared_pv_post_string_array(SharedPVWrapper& pv, rust::Vec<rust::String> va
     }
 }
 
+void shared_pv_open_int8(SharedPVWrapper& pv, int8_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Int8, initial_value, metadata, "int8");
+}
+
+void shared_pv_open_int8_array(SharedPVWrapper& pv, rust::Slice<const int8_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Int8A, pvxs::shared_array<const int8_t>(initial_value.begin(), initial_value.end()), metadata, "int8 array");
+}
+
+void shared_pv_post_int8(SharedPVWrapper& pv, int8_t value) {
+    post_native(pv, value, "int8");
+}
+
+void shared_pv_post_int8_array(SharedPVWrapper& pv, rust::Slice<const int8_t> value) {
+    post_native(pv, pvxs::shared_array<const int8_t>(value.begin(), value.end()), "int8 array");
+}
+
+void shared_pv_open_uint8(SharedPVWrapper& pv, uint8_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt8, initial_value, metadata, "uint8");
+}
+
+void shared_pv_open_uint8_array(SharedPVWrapper& pv, rust::Slice<const uint8_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt8A, pvxs::shared_array<const uint8_t>(initial_value.begin(), initial_value.end()), metadata, "uint8 array");
+}
+
+void shared_pv_post_uint8(SharedPVWrapper& pv, uint8_t value) {
+    post_native(pv, value, "uint8");
+}
+
+void shared_pv_post_uint8_array(SharedPVWrapper& pv, rust::Slice<const uint8_t> value) {
+    post_native(pv, pvxs::shared_array<const uint8_t>(value.begin(), value.end()), "uint8 array");
+}
+
+void shared_pv_open_int16(SharedPVWrapper& pv, int16_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Int16, initial_value, metadata, "int16");
+}
+
+void shared_pv_open_int16_array(SharedPVWrapper& pv, rust::Slice<const int16_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Int16A, pvxs::shared_array<const int16_t>(initial_value.begin(), initial_value.end()), metadata, "int16 array");
+}
+
+void shared_pv_post_int16(SharedPVWrapper& pv, int16_t value) {
+    post_native(pv, value, "int16");
+}
+
+void shared_pv_post_int16_array(SharedPVWrapper& pv, rust::Slice<const int16_t> value) {
+    post_native(pv, pvxs::shared_array<const int16_t>(value.begin(), value.end()), "int16 array");
+}
+
+void shared_pv_open_uint16(SharedPVWrapper& pv, uint16_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt16, initial_value, metadata, "uint16");
+}
+
+void shared_pv_open_uint16_array(SharedPVWrapper& pv, rust::Slice<const uint16_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt16A, pvxs::shared_array<const uint16_t>(initial_value.begin(), initial_value.end()), metadata, "uint16 array");
+}
+
+void shared_pv_post_uint16(SharedPVWrapper& pv, uint16_t value) {
+    post_native(pv, value, "uint16");
+}
+
+void shared_pv_post_uint16_array(SharedPVWrapper& pv, rust::Slice<const uint16_t> value) {
+    post_native(pv, pvxs::shared_array<const uint16_t>(value.begin(), value.end()), "uint16 array");
+}
+
+void shared_pv_open_uint32(SharedPVWrapper& pv, uint32_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt32, initial_value, metadata, "uint32");
+}
+
+void shared_pv_open_uint32_array(SharedPVWrapper& pv, rust::Slice<const uint32_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt32A, pvxs::shared_array<const uint32_t>(initial_value.begin(), initial_value.end()), metadata, "uint32 array");
+}
+
+void shared_pv_post_uint32(SharedPVWrapper& pv, uint32_t value) {
+    post_native(pv, value, "uint32");
+}
+
+void shared_pv_post_uint32_array(SharedPVWrapper& pv, rust::Slice<const uint32_t> value) {
+    post_native(pv, pvxs::shared_array<const uint32_t>(value.begin(), value.end()), "uint32 array");
+}
+
+void shared_pv_open_int64(SharedPVWrapper& pv, int64_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Int64, initial_value, metadata, "int64");
+}
+
+void shared_pv_open_int64_array(SharedPVWrapper& pv, rust::Slice<const int64_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Int64A, pvxs::shared_array<const int64_t>(initial_value.begin(), initial_value.end()), metadata, "int64 array");
+}
+
+void shared_pv_post_int64(SharedPVWrapper& pv, int64_t value) {
+    post_native(pv, value, "int64");
+}
+
+void shared_pv_post_int64_array(SharedPVWrapper& pv, rust::Slice<const int64_t> value) {
+    post_native(pv, pvxs::shared_array<const int64_t>(value.begin(), value.end()), "int64 array");
+}
+
+void shared_pv_open_uint64(SharedPVWrapper& pv, uint64_t initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt64, initial_value, metadata, "uint64");
+}
+
+void shared_pv_open_uint64_array(SharedPVWrapper& pv, rust::Slice<const uint64_t> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::UInt64A, pvxs::shared_array<const uint64_t>(initial_value.begin(), initial_value.end()), metadata, "uint64 array");
+}
+
+void shared_pv_post_uint64(SharedPVWrapper& pv, uint64_t value) {
+    post_native(pv, value, "uint64");
+}
+
+void shared_pv_post_uint64_array(SharedPVWrapper& pv, rust::Slice<const uint64_t> value) {
+    post_native(pv, pvxs::shared_array<const uint64_t>(value.begin(), value.end()), "uint64 array");
+}
+
+void shared_pv_open_float32(SharedPVWrapper& pv, float initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Float32, initial_value, metadata, "float32");
+}
+
+void shared_pv_open_float32_array(SharedPVWrapper& pv, rust::Slice<const float> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Float32A, pvxs::shared_array<const float>(initial_value.begin(), initial_value.end()), metadata, "float32 array");
+}
+
+void shared_pv_post_float32(SharedPVWrapper& pv, float value) {
+    post_native(pv, value, "float32");
+}
+
+void shared_pv_post_float32_array(SharedPVWrapper& pv, rust::Slice<const float> value) {
+    post_native(pv, pvxs::shared_array<const float>(value.begin(), value.end()), "float32 array");
+}
+
+void shared_pv_open_bool(SharedPVWrapper& pv, bool initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::Bool, initial_value, metadata, "bool");
+}
+
+void shared_pv_open_bool_array(SharedPVWrapper& pv, rust::Slice<const bool> initial_value, const NTScalarMetadata& metadata) {
+    open_native(pv, pvxs::TypeCode::BoolA, pvxs::shared_array<const bool>(initial_value.begin(), initial_value.end()), metadata, "bool array");
+}
+
+void shared_pv_post_bool(SharedPVWrapper& pv, bool value) {
+    post_native(pv, value, "bool");
+}
+
+void shared_pv_post_bool_array(SharedPVWrapper& pv, rust::Slice<const bool> value) {
+    post_native(pv, pvxs::shared_array<const bool>(value.begin(), value.end()), "bool array");
+}
+
 std::unique_ptr<ValueWrapper> shared_pv_fetch(const SharedPVWrapper& pv) {
     return pv.fetch_value();
 }
@@ -0,0 +1,508 @@
+// server_wrapper_autosave.cpp - Write-behind snapshots of SharedPV values, double buffered on disk
+
+#include "wrapper.h"
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    // Start of a snapshot file, in host byte order, followed by the records
+    struct SnapshotHeader
+    {
+        uint32_t magic; // "PVAS"
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t checksum;   // CRC-32 of the records
+        uint32_t count;      // records
+        uint64_t generation; // one more than the previous snapshot's
+        uint64_t size;       // bytes of records
+    };
+    const uint32_t snapshot_magic = 0x53415650;
+    const uint16_t snapshot_version = 1;
+
+    // A record is its u32 length, then the u16 length of the PV name, the name, a kind byte
+    // and the value
+    enum RecordKind : uint8_t
+    {
+        Float = 'F',    // f64
+        Signed = 'I',   // i64, also bool
+        Unsigned = 'U', // u64
+        Text = 'S',     // u32 length, bytes
+        EnumIndex = 'E', // i32
+        Array = 'A',     // u8 pvxs::ArrayType, u64 count, elements
+        TextArray = 'T', // u32 count, then u32 length and bytes of each
+    };
+
+    // Snapshots of odd generations go to "<path>.1", even ones to "<path>.0"
+    std::string buffer_path(const std::string &path, uint64_t generation) {
+        return path + (generation % 2 ? ".1" : ".0");
+    }
+
+    template <typename T>
+    void put(std::string &out, T value) {
+        out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    std::string encode(const std::string &name, const pvxs::Value &current) {
+        auto value = current["value"];
+        if (!value) {
+            throw PvxsError("'" + name + "' has no value field");
+        }
+        std::string body;
+        put<uint16_t>(body, static_cast<uint16_t>(name.size()));
+        body += name;
+        switch (value.type().code) {
+        case pvxs::TypeCode::Bool:
+        case pvxs::TypeCode::Int8:
+        case pvxs::TypeCode::Int16:
+        case pvxs::TypeCode::Int32:
+        case pvxs::TypeCode::Int64:
+            put<uint8_t>(body, Signed);
+            put<int64_t>(body, value.as<int64_t>());
+            break;
+        case pvxs::TypeCode::UInt8:
+        case pvxs::TypeCode::UInt16:
+        case pvxs::TypeCode::UInt32:
+        case pvxs::TypeCode::UInt64:
+            put<uint8_t>(body, Unsigned);
+            put<uint64_t>(body, value.as<uint64_t>());
+            break;
+        case pvxs::TypeCode::Float32:
+        case pvxs::TypeCode::Float64:
+            put<uint8_t>(body, Float);
+            put<double>(body, value.as<double>());
+            break;
+        case pvxs::TypeCode::String: {
+            auto text = value.as<std::string>();
+            put<uint8_t>(body, Text);
+            put<uint32_t>(body, static_cast<uint32_t>(text.size()));
+            body += text;
+            break;
+        }
+        case pvxs::TypeCode::Struct: {
+            // NTEnum: only the selected index changes
+            auto index = value["index"];
+            if (!index) {
+                throw PvxsError("'" + name + "' has an unsupported structure value");
+            }
+            put<uint8_t>(body, EnumIndex);
+            put<int32_t>(body, index.as<int32_t>());
+            break;
+        }
+        case pvxs::TypeCode::StringA: {
+            auto texts = value.as<pvxs::shared_array<const std::string>>();
+            put<uint8_t>(body, TextArray);
+            put<uint32_t>(body, static_cast<uint32_t>(texts.size()));
+            for (const auto &text : texts) {
+                put<uint32_t>(body, static_cast<uint32_t>(text.size()));
+                body += text;
+            }
+            break;
+        }
+        default: {
+            if (!value.type().isarray()) {
+                throw PvxsError("'" + name + "' has an unsupported value type");
+            }
+            auto elements = value.as<pvxs::shared_array<const void>>();
+            auto type = elements.original_type();
+            if (type == pvxs::ArrayType::Null || type == pvxs::ArrayType::String || type == pvxs::ArrayType::Value) {
+                throw PvxsError("'" + name + "' has an unsupported array type");
+            }
+            put<uint8_t>(body, Array);
+            put<uint8_t>(body, static_cast<uint8_t>(type));
+            put<uint64_t>(body, elements.size());
+            body.append(static_cast<const char *>(elements.data()), elements.size() * pvxs::elementSize(type));
+            break;
+        }
+        }
+
+        std::string record;
+        put<uint32_t>(record, static_cast<uint32_t>(body.size()));
+        return record + body;
+    }
+
+    // Set the value of an empty update from the rest of a record
+    void decode(ByteReader &in, pvxs::Value &update) {
+        auto value = update["value"];
+        switch (in.get<uint8_t>()) {
+        case Float:
+            value = in.get<double>();
+            break;
+        case Signed:
+            value = in.get<int64_t>();
+            break;
+        case Unsigned:
+            value = in.get<uint64_t>();
+            break;
+        case Text:
+            value = in.string(in.get<uint32_t>());
+            break;
+        case EnumIndex:
+            value["index"] = in.get<int32_t>();
+            break;
+        case Array: {
+            auto type = static_cast<pvxs::ArrayType>(in.get<uint8_t>());
+            if (type == pvxs::ArrayType::Null || type == pvxs::ArrayType::String || type == pvxs::ArrayType::Value) {
+                throw PvxsError("Invalid autosave array type");
+            }
+            auto count = in.get<uint64_t>();
+            auto size = pvxs::elementSize(type);
+            if (count > in.remaining() / size) {
+                throw PvxsError("Truncated autosave record");
+            }
+            auto elements = pvxs::allocArray(type, static_cast<size_t>(count));
+            std::memcpy(elements.data(), in.take(count * size), count * size);
+            value = elements.freeze();
+            break;
+        }
+        case TextArray: {
+            auto count = in.get<uint32_t>();
+            if (count > in.remaining() / sizeof(uint32_t)) {
+                throw PvxsError("Truncated autosave record");
+            }
+            pvxs::shared_array<std::string> texts(count);
+            for (auto &text : texts) {
+                text = in.string(in.get<uint32_t>());
+            }
+            value = texts.freeze();
+            break;
+        }
+        default:
+            throw PvxsError("Unknown autosave record kind");
+        }
+    }
+
+    void stamp(pvxs::Value &update) {
+        auto now = std::chrono::system_clock::now().time_since_epoch();
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+        update["timeStamp.secondsPastEpoch"] = static_cast<int64_t>(seconds.count());
+        update["timeStamp.nanoseconds"] = static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count());
+    }
+
+    // Newest snapshot at path with a valid header and checksum, false if there is none
+    bool load(const std::string &path, uint64_t &generation, std::string &records, uint32_t &count) {
+        bool found = false;
+        for (uint64_t buffer = 0; buffer < 2; buffer++) {
+            std::ifstream in(buffer_path(path, buffer), std::ios::binary);
+            if (!in) {
+                continue;
+            }
+            std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            SnapshotHeader header;
+            if (data.size() < sizeof(header)) {
+                continue;
+            }
+            std::memcpy(&header, data.data(), sizeof(header));
+            // A snapshot torn by a crash fails the size or checksum test
+            if (header.magic != snapshot_magic || header.version != snapshot_version ||
+                header.generation % 2 != buffer || header.size != data.size() - sizeof(header) ||
+                header.checksum != crc32(data.data() + sizeof(header), static_cast<size_t>(header.size))) {
+                continue;
+            }
+            if (!found || header.generation > generation) {
+                found = true;
+                generation = header.generation;
+                count = header.count;
+                records = data.substr(sizeof(header));
+            }
+        }
+        return found;
+    }
+
+} // namespace
+
+// ============================================================================
+// Snapshot file helpers
+// ============================================================================
+
+uint32_t crc32(const char* data, size_t size) {
+    static const auto table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            }
+            t[i] = c;
+        }
+        return t;
+    }();
+    uint32_t crc = 0xffffffffu;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xff] ^ (crc >> 8);
+    }
+    return crc ^ 0xffffffffu;
+}
+
+void write_file_synced(const std::string& path, const std::string& data) {
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        throw PvxsError("Can't create '" + path + "': " + std::strerror(errno));
+    }
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size() && std::fflush(file) == 0;
+#if defined(_WIN32)
+    ok = ok && _commit(_fileno(file)) == 0;
+#else
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+    auto error = errno;
+    ok = std::fclose(file) == 0 && ok;
+    if (!ok) {
+        throw PvxsError("Can't write '" + path + "': " + std::strerror(error));
+    }
+}
+
+// ============================================================================
+// AutosaveWrapper implementation
+// ============================================================================
+
+bool AutosaveWrapper::State::save(bool force) {
+    std::lock_guard<std::mutex> guard(save_lock);
+    auto started = std::chrono::steady_clock::now();
+    bool changed = force || unsaved;
+    for (auto& entry : entries) {
+        // Counted before fetching, so a post racing the fetch leaves the entry dirty for next time
+        auto posts = entry.hub->post_count();
+        if (!entry.record.empty() && posts == entry.saved_posts) {
+            continue;
+        }
+        try {
+            entry.record = encode(entry.name, entry.pv.fetch());
+            entry.saved_posts = posts;
+            changed = true;
+        } catch (const std::exception&) {
+            // Closed since it was added, its last saved value is kept
+        }
+    }
+    if (!changed) {
+        return false;
+    }
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::string snapshot(sizeof(header), '\0');
+    for (const auto& entry : entries) {
+        if (!entry.record.empty()) {
+            snapshot += entry.record;
+            header.count++;
+        }
+    }
+    header.magic = snapshot_magic;
+    header.version = snapshot_version;
+    header.generation = generation + 1;
+    header.size = snapshot.size() - sizeof(header);
+    header.checksum = crc32(snapshot.data() + sizeof(header), snapshot.size() - sizeof(header));
+    std::memcpy(&snapshot[0], &header, sizeof(header));
+
+    // Overwrites the older buffer only, so the newest complete snapshot survives a crash here
+    try {
+        write_file_synced(buffer_path(path, header.generation), snapshot);
+    } catch (const std::exception&) {
+        unsaved = true;
+        failed.fetch_add(1, std::memory_order_relaxed);
+        throw;
+    }
+    unsaved = false;
+    generation = header.generation;
+    saves.fetch_add(1, std::memory_order_relaxed);
+    saved_generation.store(generation, std::memory_order_relaxed);
+    bytes.store(snapshot.size(), std::memory_order_relaxed);
+    last_duration.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count(),
+                        std::memory_order_relaxed);
+    return true;
+}
+
+void AutosaveWrapper::State::run() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (!stopping) {
+        wake.wait_for(guard, interval, [this] { return stopping; });
+        guard.unlock();
+        try {
+            save(false);
+        } catch (const std::exception&) {
+            // Counted, and retried at the next interval
+        }
+        guard.lock();
+    }
+}
+
+AutosaveWrapper::AutosaveWrapper(const std::string& path, double interval) {
+    if (path.empty()) {
+        throw PvxsError("Autosave needs a path");
+    }
+    if (!(interval > 0.0)) {
+        throw PvxsError("Autosave interval must be > 0");
+    }
+    state_->path = path;
+    state_->interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(interval));
+    std::string records;
+    uint32_t count;
+    if (load(path, state_->generation, records, count)) {
+        state_->saved_generation.store(state_->generation);
+    }
+}
+
+AutosaveWrapper::~AutosaveWrapper() {
+    stop();
+}
+
+void AutosaveWrapper::add(const std::string& name, const SharedPVWrapper& pv) {
+    if (is_running()) {
+        throw PvxsError("PVs can't be added to a running autosave");
+    }
+    if (name.empty() || name.size() > 0xffff) {
+        throw PvxsError("Invalid autosave name '" + name + "'");
+    }
+    if (!pv.is_open()) {
+        throw PvxsError("Only open PVs can be autosaved");
+    }
+    for (const auto& entry : state_->entries) {
+        if (entry.name == name) {
+            throw PvxsError("'" + name + "' is already autosaved");
+        }
+    }
+    Entry entry;
+    entry.name = name;
+    entry.pv = pv.get();
+    entry.hub = pv.hub();
+    entry.prototype = pv.get_template();
+    // Rejects values which can't be saved. Left unencoded, so the next snapshot includes it
+    encode(name, entry.pv.fetch());
+    state_->entries.push_back(std::move(entry));
+}
+
+size_t AutosaveWrapper::restore() {
+    if (is_running()) {
+        throw PvxsError("Autosave can't restore while running");
+    }
+    std::lock_guard<std::mutex> guard(state_->save_lock);
+    uint64_t generation = 0;
+    std::string records;
+    uint32_t count = 0;
+    if (!load(state_->path, generation, records, count)) {
+        return 0;
+    }
+
+    std::map<std::string, Entry *> by_name;
+    for (auto& entry : state_->entries) {
+        by_name[entry.name] = &entry;
+    }
+    size_t restored = 0;
+    ByteReader in(records.data(), records.size());
+    for (uint32_t i = 0; i < count; i++) {
+        auto size = in.get<uint32_t>();
+        auto data = in.take(size);
+        ByteReader record(data, size);
+        auto it = by_name.find(record.string(record.get<uint16_t>()));
+        if (it == by_name.end()) {
+            continue;
+        }
+        auto& entry = *it->second;
+        auto update = entry.prototype.cloneEmpty();
+        try {
+            decode(record, update);
+        } catch (const std::exception&) {
+            // The PV changed type since the snapshot
+            continue;
+        }
+        stamp(update);
+        entry.hub->post(entry.pv, update);
+        entry.record.assign(data - sizeof(uint32_t), size + sizeof(uint32_t));
+        entry.saved_posts = entry.hub->post_count();
+        restored++;
+    }
+    // The next snapshot goes to the other buffer, even if it holds a newer but torn one
+    state_->generation = generation;
+    state_->saved_generation.store(generation);
+    return restored;
+}
+
+bool AutosaveWrapper::save() {
+    return state_->save(false);
+}
+
+void AutosaveWrapper::start() {
+    if (is_running()) {
+        return;
+    }
+    state_->stopping = false;
+    auto state = state_;
+    writer_ = std::thread([state] { state->run(); });
+}
+
+void AutosaveWrapper::stop() {
+    if (!is_running()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(state_->lock);
+        state_->stopping = true;
+    }
+    state_->wake.notify_one();
+    writer_.join();
+}
+
+AutosaveWrapper::Stats AutosaveWrapper::stats() const {
+    Stats stats;
+    stats.saves = state_->saves.load(std::memory_order_relaxed);
+    stats.failed = state_->failed.load(std::memory_order_relaxed);
+    stats.generation = state_->saved_generation.load(std::memory_order_relaxed);
+    stats.bytes = state_->bytes.load(std::memory_order_relaxed);
+    stats.last_duration = state_->last_duration.load(std::memory_order_relaxed) * 1e-9;
+    return stats;
+}
+
+// ============================================================================
+// Bridge functions for autosave
+// ============================================================================
+
+std::unique_ptr<AutosaveWrapper> autosave_create(rust::Str path, double interval) {
+    return std::make_unique<AutosaveWrapper>(std::string(path), interval);
+}
+
+void autosave_add(AutosaveWrapper& autosave, rust::Str name, const SharedPVWrapper& pv) {
+    autosave.add(std::string(name), pv);
+}
+
+uint64_t autosave_restore(AutosaveWrapper& autosave) {
+    return autosave.restore();
+}
+
+bool autosave_save(AutosaveWrapper& autosave) {
+    return autosave.save();
+}
+
+void autosave_start(AutosaveWrapper& autosave) {
+    autosave.start();
+}
+
+void autosave_stop(AutosaveWrapper& autosave) {
+    autosave.stop();
+}
+
+bool autosave_is_running(const AutosaveWrapper& autosave) {
+    return autosave.is_running();
+}
+
+void autosave_stats(const AutosaveWrapper& autosave, uint64_t& saves, uint64_t& failed, uint64_t& generation,
+                    uint64_t& bytes, double& last_duration) {
+    auto stats = autosave.stats();
+    saves = stats.saves;
+    failed = stats.failed;
+    generation = stats.generation;
+    bytes = stats.bytes;
+    last_duration = stats.last_duration;
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,208 @@
+// server_wrapper_computed.cpp - PVs whose value is computed when a client reads it
+
+#include "wrapper.h"
+#include <thread>
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    // Evaluations of computed PVs, all run by one thread
+    class ComputeWorker
+    {
+    private:
+        std::mutex lock_;
+        std::condition_variable wake_;
+        std::deque<std::function<void()>> tasks_;
+
+        void run() {
+            std::unique_lock<std::mutex> guard(lock_);
+            while (true) {
+                if (tasks_.empty()) {
+                    wake_.wait(guard);
+                    continue;
+                }
+                auto task = std::move(tasks_.front());
+                tasks_.pop_front();
+                guard.unlock();
+                task();
+                guard.lock();
+            }
+        }
+
+    public:
+        ComputeWorker() {
+            std::thread([this]() { run(); }).detach();
+        }
+
+        void submit(std::function<void()> task) {
+            std::lock_guard<std::mutex> guard(lock_);
+            tasks_.push_back(std::move(task));
+            wake_.notify_one();
+        }
+    };
+
+    // Never destroyed, its thread may be waiting until the process exits
+    ComputeWorker& compute_worker() {
+        static auto* worker = new ComputeWorker();
+        return *worker;
+    }
+
+} // namespace
+
+// ============================================================================
+// ComputedValue implementation
+// ============================================================================
+
+ComputedValue::ComputedValue(Compute compute, double ttl)
+    : compute_(std::move(compute)),
+      ttl_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(ttl))) {}
+
+bool ComputedValue::is_fresh() const {
+    return fresh_ && std::chrono::steady_clock::now() - computed_at_ < ttl_;
+}
+
+void ComputedValue::schedule(const pvxs::server::SharedPV& pv, const std::shared_ptr<SubscriberHub>& hub) {
+    if (evaluating_) {
+        return;
+    }
+    evaluating_ = true;
+    auto self = shared_from_this();
+    compute_worker().submit([self, pv, hub]() { self->evaluate(pv, hub); });
+}
+
+void ComputedValue::evaluate(pvxs::server::SharedPV pv, const std::shared_ptr<SubscriberHub>& hub) {
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        generation = generation_;
+    }
+
+    pvxs::Value result;
+    std::string error;
+    try {
+        auto update = pv.fetch().cloneEmpty();
+        try {
+            compute_(update);
+        } catch (const std::exception& e) {
+            throw PvxsError(std::string("Error computing value: ") + e.what());
+        }
+        auto ts = update["timeStamp"];
+        if (ts && !ts.isMarked(true, true)) {
+            auto now = std::chrono::system_clock::now().time_since_epoch();
+            auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+            ts["secondsPastEpoch"] = static_cast<int64_t>(seconds.count());
+            ts["nanoseconds"] = static_cast<int32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count());
+        }
+        // Posted, so subscribers and fetch() see the result too
+        hub->post(pv, update);
+        result = pv.fetch();
+    } catch (const std::exception& e) {
+        error = e.what();
+    }
+
+    std::vector<std::unique_ptr<pvxs::server::ExecOp>> waiting;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        evaluating_ = false;
+        if (error.empty()) {
+            stats_.evaluations++;
+            computed_at_ = std::chrono::steady_clock::now();
+            fresh_ = ttl_.count() > 0 && generation == generation_;
+        } else {
+            stats_.failed++;
+        }
+        waiting.swap(waiting_);
+    }
+    for (auto& op : waiting) {
+        if (error.empty()) {
+            op->reply(result);
+        } else {
+            op->error(error);
+        }
+    }
+}
+
+void ComputedValue::get(std::unique_ptr<pvxs::server::ExecOp>&& op, const pvxs::server::SharedPV& pv,
+                        const std::shared_ptr<SubscriberHub>& hub) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!is_fresh()) {
+            waiting_.push_back(std::move(op));
+            schedule(pv, hub);
+            return;
+        }
+        stats_.cache_hits++;
+    }
+    op->reply(pv.fetch());
+}
+
+void ComputedValue::refresh(const pvxs::server::SharedPV& pv, const std::shared_ptr<SubscriberHub>& hub) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!is_fresh()) {
+        schedule(pv, hub);
+    }
+}
+
+void ComputedValue::invalidate() {
+    std::lock_guard<std::mutex> guard(lock_);
+    fresh_ = false;
+    generation_++;
+}
+
+ComputedValue::Stats ComputedValue::stats() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return stats_;
+}
+
+void SharedPVWrapper::set_computed(std::shared_ptr<ComputedValue> computed) {
+    if (!pv_.isOpen()) {
+        throw PvxsError("Computed PV must be open before its function is set");
+    }
+    computed_ = std::move(computed);
+}
+
+// ============================================================================
+// Bridge functions for computed PVs
+// ============================================================================
+
+namespace {
+
+    void check_ttl(double ttl) {
+        if (!(ttl >= 0.0)) {
+            throw PvxsError("Computed PV cache TTL must be >= 0");
+        }
+    }
+
+} // namespace
+
+void shared_pv_set_computed_double(SharedPVWrapper& pv, uintptr_t compute, double ttl) {
+    check_ttl(ttl);
+    auto fn = reinterpret_cast<double (*)()>(compute);
+    pv.set_computed(std::make_shared<ComputedValue>([fn](pvxs::Value& update) { update["value"] = fn(); }, ttl));
+}
+
+void shared_pv_set_computed_int32(SharedPVWrapper& pv, uintptr_t compute, double ttl) {
+    check_ttl(ttl);
+    auto fn = reinterpret_cast<int32_t (*)()>(compute);
+    pv.set_computed(std::make_shared<ComputedValue>([fn](pvxs::Value& update) { update["value"] = fn(); }, ttl));
+}
+
+void shared_pv_invalidate_computed(SharedPVWrapper& pv) {
+    if (pv.computed()) {
+        pv.computed()->invalidate();
+    }
+}
+
+bool shared_pv_computed_stats(const SharedPVWrapper& pv, uint64_t& evaluations, uint64_t& cache_hits, uint64_t& failed) {
+    if (!pv.computed()) {
+        return false;
+    }
+    auto stats = pv.computed()->stats();
+    evaluations = stats.evaluations;
+    cache_hits = stats.cache_hits;
+    failed = stats.failed;
+    return true;
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,178 @@
+// server_wrapper_group.cpp - Composite PVs posted atomically from several members
+
+#include "wrapper.h"
+#include <algorithm>
+
+namespace pvxs_wrapper {
+
+// ============================================================================
+// GroupPVWrapper implementation
+// ============================================================================
+
+void GroupPVWrapper::add_member(const std::string& name, pvxs::TypeCode code) {
+    if (prototype_.valid()) {
+        throw PvxsError("Group PV members must be defined before values are set");
+    }
+    if (name.empty() || name.find('.') != std::string::npos) {
+        throw PvxsError("Invalid group PV member name '" + name + "'");
+    }
+    auto same = [&name](const std::pair<std::string, pvxs::TypeCode>& m) { return m.first == name; };
+    if (std::find_if(members_.begin(), members_.end(), same) != members_.end()) {
+        throw PvxsError("Duplicate group PV member '" + name + "'");
+    }
+    members_.emplace_back(name, code);
+}
+
+pvxs::Value GroupPVWrapper::member(const std::string& name) {
+    if (!prototype_.valid()) {
+        if (members_.empty()) {
+            throw PvxsError("Group PV has no members");
+        }
+        pvxs::TypeDef def(pvxs::TypeCode::Struct);
+        std::vector<pvxs::Member> children;
+        children.reserve(members_.size());
+        for (const auto& m : members_) {
+            children.push_back(pvxs::nt::NTScalar{m.second}.build().as(m.first));
+        }
+        def += children;
+        prototype_ = def.create();
+        pending_ = prototype_.cloneEmpty();
+    }
+    if (name.empty()) {
+        return pending_;
+    }
+    auto field = name.find('.') == std::string::npos ? pending_[name] : pvxs::Value();
+    if (!field) {
+        throw PvxsError("Group PV has no member '" + name + "'");
+    }
+    return field;
+}
+
+void GroupPVWrapper::set_alarm(const std::string& name, int32_t severity, int32_t status, const std::string& message) {
+    auto alarm = member(name)["alarm"];
+    alarm["severity"] = severity;
+    alarm["status"] = status;
+    alarm["message"] = message;
+}
+
+void GroupPVWrapper::open() {
+    try {
+        auto initial = member(std::string());
+        pending_ = prototype_.cloneEmpty();
+        pv_->open(ValueWrapper(std::move(initial)));
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error opening group PV: ") + e.what());
+    }
+}
+
+bool GroupPVWrapper::post() {
+    if (!pv_->is_open()) {
+        throw PvxsError("Group PV is not open");
+    }
+    if (!pending_.isMarked(true, true)) {
+        return false;
+    }
+
+    // One time for all changed members, so they read as a single snapshot
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds);
+    for (const auto& m : members_) {
+        auto field = pending_[m.first];
+        if (field.isMarked(true, true)) {
+            field["timeStamp.secondsPastEpoch"] = static_cast<int64_t>(seconds.count());
+            field["timeStamp.nanoseconds"] = static_cast<int32_t>(nanoseconds.count());
+        }
+    }
+
+    auto update = std::move(pending_);
+    pending_ = prototype_.cloneEmpty();
+    try {
+        pv_->post_value(ValueWrapper(std::move(update)));
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error posting group PV: ") + e.what());
+    }
+    return true;
+}
+
+// ============================================================================
+// Bridge functions for group PVs
+// ============================================================================
+
+namespace {
+
+    pvxs::TypeCode member_type(const std::string& type) {
+        static const std::map<std::string, pvxs::TypeCode> types = {
+            {"double", pvxs::TypeCode::Float64},
+            {"int32", pvxs::TypeCode::Int32},
+            {"string", pvxs::TypeCode::String},
+            {"double[]", pvxs::TypeCode::Float64A},
+            {"int32[]", pvxs::TypeCode::Int32A},
+            {"string[]", pvxs::TypeCode::StringA},
+        };
+        auto it = types.find(type);
+        if (it == types.end()) {
+            throw PvxsError("Unsupported group PV member type '" + type + "'");
+        }
+        return it->second;
+    }
+
+} // namespace
+
+std::unique_ptr<GroupPVWrapper> group_pv_create() {
+    return std::make_unique<GroupPVWrapper>();
+}
+
+void group_pv_add_member(GroupPVWrapper& group, rust::Str name, rust::Str type) {
+    group.add_member(std::string(name), member_type(std::string(type)));
+}
+
+void group_pv_set_double(GroupPVWrapper& group, rust::Str member, double value) {
+    group.set_value(std::string(member), value);
+}
+
+void group_pv_set_int32(GroupPVWrapper& group, rust::Str member, int32_t value) {
+    group.set_value(std::string(member), value);
+}
+
+void group_pv_set_string(GroupPVWrapper& group, rust::Str member, rust::String value) {
+    group.set_value(std::string(member), std::string(value));
+}
+
+void group_pv_set_double_array(GroupPVWrapper& group, rust::Str member, rust::Vec<double> value) {
+    group.set_value(std::string(member), pvxs::shared_array<const double>(value.begin(), value.end()));
+}
+
+void group_pv_set_int32_array(GroupPVWrapper& group, rust::Str member, rust::Vec<int32_t> value) {
+    group.set_value(std::string(member), pvxs::shared_array<const int32_t>(value.begin(), value.end()));
+}
+
+void group_pv_set_string_array(GroupPVWrapper& group, rust::Str member, rust::Vec<rust::String> value) {
+    pvxs::shared_array<std::string> arr(value.size());
+    for (size_t i = 0; i < value.size(); i++) {
+        arr[i] = std::string(value[i]);
+    }
+    group.set_value(std::string(member), arr.freeze());
+}
+
+void group_pv_set_alarm(GroupPVWrapper& group, rust::Str member, int32_t severity, int32_t status, rust::String message) {
+    group.set_alarm(std::string(member), severity, status, std::string(message));
+}
+
+void group_pv_open(GroupPVWrapper& group) {
+    group.open();
+}
+
+bool group_pv_post(GroupPVWrapper& group) {
+    return group.post();
+}
+
+std::unique_ptr<ValueWrapper> group_pv_fetch(const GroupPVWrapper& group) {
+    return group.pv().fetch_value();
+}
+
+void server_add_group_pv(ServerWrapper& server, rust::String name, GroupPVWrapper& group) {
+    server.add_pv(std::string(name), group.pv());
+}
+
+} // namespace pvxs_wrapper
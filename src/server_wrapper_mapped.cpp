@@ -0,0 +1,265 @@
+// server_wrapper_mapped.cpp - Array PVs served straight from memory-mapped files
+
+#include "wrapper.h"
+#include <cerrno>
+#include <cstring>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace pvxs_wrapper {
+
+// ============================================================================
+// FileMapping implementation
+// ============================================================================
+
+#if defined(_WIN32)
+
+FileMapping::FileMapping(const std::string& path, uint64_t offset, uint64_t length) {
+    // Producers keep writing into the file while it is mapped
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        file_ = nullptr;
+        throw PvxsError("Can't open '" + path + "' (error " + std::to_string(GetLastError()) + ")");
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file_, &file_size)) {
+        unmap();
+        throw PvxsError("Can't get the size of '" + path + "'");
+    }
+    uint64_t available = static_cast<uint64_t>(file_size.QuadPart);
+    if (length == 0 && offset < available) {
+        length = available - offset;
+    }
+    if (length == 0 || offset + length > available) {
+        unmap();
+        throw PvxsError("'" + path + "' has no " + std::to_string(length) + " bytes at offset " + std::to_string(offset));
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    uint64_t start = offset - offset % info.dwAllocationGranularity;
+    mapped_ = static_cast<size_t>(length + (offset - start));
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_) {
+        base_ = MapViewOfFile(mapping_, FILE_MAP_READ, static_cast<DWORD>(start >> 32),
+                              static_cast<DWORD>(start & 0xffffffff), mapped_);
+    }
+    if (!base_) {
+        auto error = GetLastError();
+        unmap();
+        throw PvxsError("Can't map '" + path + "' (error " + std::to_string(error) + ")");
+    }
+    data_ = static_cast<const uint8_t *>(base_) + (offset - start);
+    end_ = offset + length;
+}
+
+bool FileMapping::intact() const {
+    LARGE_INTEGER file_size;
+    return GetFileSizeEx(file_, &file_size) && static_cast<uint64_t>(file_size.QuadPart) >= end_;
+}
+
+void FileMapping::unmap() {
+    if (base_) {
+        UnmapViewOfFile(base_);
+        base_ = nullptr;
+    }
+    if (mapping_) {
+        CloseHandle(mapping_);
+        mapping_ = nullptr;
+    }
+    if (file_) {
+        CloseHandle(file_);
+        file_ = nullptr;
+    }
+}
+
+#else
+
+FileMapping::FileMapping(const std::string& path, uint64_t offset, uint64_t length) {
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+        throw PvxsError("Can't open '" + path + "': " + std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        auto error = errno;
+        unmap();
+        throw PvxsError("Can't get the size of '" + path + "': " + std::strerror(error));
+    }
+    uint64_t available = static_cast<uint64_t>(st.st_size);
+    if (length == 0 && offset < available) {
+        length = available - offset;
+    }
+    if (length == 0 || offset + length > available) {
+        unmap();
+        throw PvxsError("'" + path + "' has no " + std::to_string(length) + " bytes at offset " + std::to_string(offset));
+    }
+
+    // mmap() offsets must be page aligned
+    uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t start = offset - offset % page;
+    mapped_ = static_cast<size_t>(length + (offset - start));
+    base_ = mmap(nullptr, mapped_, PROT_READ, MAP_SHARED, fd_, static_cast<off_t>(start));
+    if (base_ == MAP_FAILED) {
+        auto error = errno;
+        base_ = nullptr;
+        unmap();
+        throw PvxsError("Can't map '" + path + "': " + std::strerror(error));
+    }
+    data_ = static_cast<const uint8_t *>(base_) + (offset - start);
+    end_ = offset + length;
+}
+
+bool FileMapping::intact() const {
+    struct stat st;
+    return fstat(fd_, &st) == 0 && static_cast<uint64_t>(st.st_size) >= end_;
+}
+
+void FileMapping::unmap() {
+    if (base_) {
+        munmap(base_, mapped_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+#endif
+
+// ============================================================================
+// MappedArrayPVWrapper implementation
+// ============================================================================
+
+namespace {
+
+    // A new array over the start of the mapping. The aliasing shared_ptr is the deleter:
+    // the mapping lives as long as any copy of the array does.
+    template <typename E>
+    pvxs::shared_array<const void> view_of(const std::shared_ptr<FileMapping> &mapping, size_t count) {
+        std::shared_ptr<const E> data(mapping, reinterpret_cast<const E *>(mapping->data()));
+        return pvxs::shared_array<const E>(data, count).template castTo<const void>();
+    }
+
+    struct ElementType
+    {
+        const char *name;
+        pvxs::TypeCode code;
+        size_t size;
+        pvxs::shared_array<const void> (*view)(const std::shared_ptr<FileMapping> &, size_t);
+    };
+
+    // Names as used by NativeType on the Rust side
+    const ElementType element_types[] = {
+        {"bool", pvxs::TypeCode::BoolA, sizeof(bool), &view_of<bool>},
+        {"int8", pvxs::TypeCode::Int8A, sizeof(int8_t), &view_of<int8_t>},
+        {"uint8", pvxs::TypeCode::UInt8A, sizeof(uint8_t), &view_of<uint8_t>},
+        {"int16", pvxs::TypeCode::Int16A, sizeof(int16_t), &view_of<int16_t>},
+        {"uint16", pvxs::TypeCode::UInt16A, sizeof(uint16_t), &view_of<uint16_t>},
+        {"int32", pvxs::TypeCode::Int32A, sizeof(int32_t), &view_of<int32_t>},
+        {"uint32", pvxs::TypeCode::UInt32A, sizeof(uint32_t), &view_of<uint32_t>},
+        {"int64", pvxs::TypeCode::Int64A, sizeof(int64_t), &view_of<int64_t>},
+        {"uint64", pvxs::TypeCode::UInt64A, sizeof(uint64_t), &view_of<uint64_t>},
+        {"float32", pvxs::TypeCode::Float32A, sizeof(float), &view_of<float>},
+        {"double", pvxs::TypeCode::Float64A, sizeof(double), &view_of<double>},
+    };
+
+    const ElementType &element_type(const std::string &name) {
+        for (const auto &type : element_types) {
+            if (name == type.name) {
+                return type;
+            }
+        }
+        throw PvxsError("Unsupported mapped array element type '" + name + "'");
+    }
+
+} // namespace
+
+void MappedArrayPVWrapper::open(const std::string& path, const std::string& type, uint64_t offset, uint64_t count,
+                                const NTScalarMetadata& metadata) {
+    if (pv_->is_open()) {
+        throw PvxsError("Mapped array PV is already open");
+    }
+    const auto& element = element_type(type);
+    // Elements are read in place, so they must be aligned as in memory
+    if (offset % element.size != 0) {
+        throw PvxsError("Offset " + std::to_string(offset) + " is not a multiple of the " + type + " size");
+    }
+    try {
+        auto mapping = std::make_shared<FileMapping>(path, offset, count * element.size);
+        size_t elements = mapping->size() / element.size;
+        if (elements == 0) {
+            throw PvxsError("'" + path + "' holds no complete " + type + " element at offset " + std::to_string(offset));
+        }
+        auto initial = create_nt_scalar(element.code, metadata);
+        initial["value"] = element.view(mapping, elements);
+        pv_->open(ValueWrapper(std::move(initial)));
+        mapping_ = std::move(mapping);
+        view_ = element.view;
+        count_ = elements;
+    } catch (const PvxsError&) {
+        throw;
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error opening mapped array PV: ") + e.what());
+    }
+}
+
+void MappedArrayPVWrapper::post() {
+    if (!mapping_) {
+        throw PvxsError("Mapped array PV is not open");
+    }
+    // Sending a region the file no longer covers would take the process down with SIGBUS
+    if (!mapping_->intact()) {
+        throw PvxsError("Mapped file was truncated below the mapped region");
+    }
+    try {
+        // A fresh view of the same memory, so the update carries a changed value
+        auto update = pv_->get_template().cloneEmpty();
+        update["value"] = view_(mapping_, count_);
+        pv_->post_value(ValueWrapper(std::move(update)));
+    } catch (const std::exception& e) {
+        throw PvxsError(std::string("Error posting mapped array PV: ") + e.what());
+    }
+}
+
+// ============================================================================
+// Bridge functions for mapped array PVs
+// ============================================================================
+
+std::unique_ptr<MappedArrayPVWrapper> mapped_array_pv_create() {
+    return std::make_unique<MappedArrayPVWrapper>();
+}
+
+void mapped_array_pv_open(MappedArrayPVWrapper& pv, rust::Str path, rust::Str element_type, uint64_t offset,
+                          uint64_t count, const NTScalarMetadata& metadata) {
+    pv.open(std::string(path), std::string(element_type), offset, count, metadata);
+}
+
+void mapped_array_pv_post(MappedArrayPVWrapper& pv) {
+    pv.post();
+}
+
+uint64_t mapped_array_pv_len(const MappedArrayPVWrapper& pv) {
+    return pv.count();
+}
+
+std::unique_ptr<ValueWrapper> mapped_array_pv_fetch(const MappedArrayPVWrapper& pv) {
+    return pv.pv().fetch_value();
+}
+
+void server_add_mapped_array_pv(ServerWrapper& server, rust::String name, MappedArrayPVWrapper& pv) {
+    server.add_pv(std::string(name), pv.pv());
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,402 @@
+// server_wrapper_snapshot.cpp - Whole-server PV snapshots and warm start from them
+
+#include "wrapper.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    // Start of a snapshot file, in host byte order, followed by the records
+    struct SnapshotHeader
+    {
+        uint32_t magic; // "PVSS"
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t checksum; // CRC-32 of the records
+        uint32_t count;    // records
+        uint64_t size;     // bytes of records
+    };
+    const uint32_t snapshot_magic = 0x53535650;
+    const uint16_t snapshot_version = 1;
+
+    // A record is its u32 length, the u16 length of the PV name, the name and the u32 index
+    // of its type. Types are numbered in order of first use, and a record using a type for the
+    // first time describes it right after the index. The values of the leaf fields follow,
+    // depth first.
+    //
+    // A type is its u8 code. A structure adds the u16 length of its id, the id, its u16 member
+    // count and, for each member, the u16 length of the name, the name and the member's type.
+
+    bool is_leaf(pvxs::TypeCode code) {
+        switch (code.code) {
+        case pvxs::TypeCode::Bool:
+        case pvxs::TypeCode::Int8:
+        case pvxs::TypeCode::Int16:
+        case pvxs::TypeCode::Int32:
+        case pvxs::TypeCode::Int64:
+        case pvxs::TypeCode::UInt8:
+        case pvxs::TypeCode::UInt16:
+        case pvxs::TypeCode::UInt32:
+        case pvxs::TypeCode::UInt64:
+        case pvxs::TypeCode::Float32:
+        case pvxs::TypeCode::Float64:
+        case pvxs::TypeCode::String:
+        case pvxs::TypeCode::BoolA:
+        case pvxs::TypeCode::Int8A:
+        case pvxs::TypeCode::Int16A:
+        case pvxs::TypeCode::Int32A:
+        case pvxs::TypeCode::Int64A:
+        case pvxs::TypeCode::UInt8A:
+        case pvxs::TypeCode::UInt16A:
+        case pvxs::TypeCode::UInt32A:
+        case pvxs::TypeCode::UInt64A:
+        case pvxs::TypeCode::Float32A:
+        case pvxs::TypeCode::Float64A:
+        case pvxs::TypeCode::StringA:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <typename T>
+    void put(std::string &out, T value) {
+        out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void put_name(std::string &out, const std::string &name) {
+        if (name.size() > 0xffff) {
+            throw PvxsError("Name too long for a snapshot: '" + name.substr(0, 64) + "...'");
+        }
+        put<uint16_t>(out, static_cast<uint16_t>(name.size()));
+        out += name;
+    }
+
+    void describe(std::string &out, const pvxs::Value &value) {
+        auto code = value.type();
+        put<uint8_t>(out, static_cast<uint8_t>(code.code));
+        if (code != pvxs::TypeCode::Struct) {
+            if (!is_leaf(code)) {
+                throw PvxsError(std::string("Snapshots can't hold ") + code.name() + " fields");
+            }
+            return;
+        }
+        put_name(out, value.id());
+        put<uint16_t>(out, static_cast<uint16_t>(value.nmembers()));
+        for (auto member : value.ichildren()) {
+            put_name(out, value.nameOf(member));
+            describe(out, member);
+        }
+    }
+
+    void write_fields(std::string &out, const pvxs::Value &value) {
+        for (auto field : value.ichildren()) {
+            auto code = field.type();
+            switch (code.code) {
+            case pvxs::TypeCode::Struct:
+                write_fields(out, field);
+                break;
+            case pvxs::TypeCode::Bool:
+            case pvxs::TypeCode::Int8:
+            case pvxs::TypeCode::Int16:
+            case pvxs::TypeCode::Int32:
+            case pvxs::TypeCode::Int64:
+                put<int64_t>(out, field.as<int64_t>());
+                break;
+            case pvxs::TypeCode::UInt8:
+            case pvxs::TypeCode::UInt16:
+            case pvxs::TypeCode::UInt32:
+            case pvxs::TypeCode::UInt64:
+                put<uint64_t>(out, field.as<uint64_t>());
+                break;
+            case pvxs::TypeCode::Float32:
+            case pvxs::TypeCode::Float64:
+                put<double>(out, field.as<double>());
+                break;
+            case pvxs::TypeCode::String: {
+                auto text = field.as<std::string>();
+                put<uint32_t>(out, static_cast<uint32_t>(text.size()));
+                out += text;
+                break;
+            }
+            case pvxs::TypeCode::StringA: {
+                auto texts = field.as<pvxs::shared_array<const std::string>>();
+                put<uint32_t>(out, static_cast<uint32_t>(texts.size()));
+                for (const auto &text : texts) {
+                    put<uint32_t>(out, static_cast<uint32_t>(text.size()));
+                    out += text;
+                }
+                break;
+            }
+            default: {
+                // Numeric arrays, with their own element type, which may differ from the field's
+                auto elements = field.as<pvxs::shared_array<const void>>();
+                auto type = elements.empty() ? static_cast<pvxs::ArrayType>(code.code) : elements.original_type();
+                put<uint8_t>(out, static_cast<uint8_t>(type));
+                put<uint64_t>(out, elements.size());
+                out.append(static_cast<const char *>(elements.data()), elements.size() * pvxs::elementSize(type));
+                break;
+            }
+            }
+        }
+    }
+
+    pvxs::Member read_member(ByteReader &in, const std::string &name);
+
+    // Members of a structure, after its code
+    std::vector<pvxs::Member> read_members(ByteReader &in) {
+        auto count = in.get<uint16_t>();
+        std::vector<pvxs::Member> members;
+        members.reserve(count);
+        for (uint16_t i = 0; i < count; i++) {
+            auto name = in.string(in.get<uint16_t>());
+            members.push_back(read_member(in, name));
+        }
+        return members;
+    }
+
+    pvxs::Member read_member(ByteReader &in, const std::string &name) {
+        pvxs::TypeCode code(in.get<uint8_t>());
+        if (code != pvxs::TypeCode::Struct) {
+            if (!is_leaf(code)) {
+                throw PvxsError("Invalid field type in snapshot");
+            }
+            return pvxs::Member(code, name);
+        }
+        auto id = in.string(in.get<uint16_t>());
+        return pvxs::Member(code, name, id, read_members(in));
+    }
+
+    // Empty value of a type described in a record
+    pvxs::Value read_type(ByteReader &in) {
+        if (pvxs::TypeCode(in.get<uint8_t>()) != pvxs::TypeCode::Struct) {
+            throw PvxsError("Snapshot PV type is not a structure");
+        }
+        auto id = in.string(in.get<uint16_t>());
+        return pvxs::TypeDef(pvxs::TypeCode::Struct, id, read_members(in)).create();
+    }
+
+    void read_fields(ByteReader &in, pvxs::Value &value) {
+        for (auto field : value.ichildren()) {
+            auto code = field.type();
+            switch (code.code) {
+            case pvxs::TypeCode::Struct:
+                read_fields(in, field);
+                break;
+            case pvxs::TypeCode::Bool:
+                field = in.get<int64_t>() != 0;
+                break;
+            case pvxs::TypeCode::Int8:
+            case pvxs::TypeCode::Int16:
+            case pvxs::TypeCode::Int32:
+            case pvxs::TypeCode::Int64:
+                field = in.get<int64_t>();
+                break;
+            case pvxs::TypeCode::UInt8:
+            case pvxs::TypeCode::UInt16:
+            case pvxs::TypeCode::UInt32:
+            case pvxs::TypeCode::UInt64:
+                field = in.get<uint64_t>();
+                break;
+            case pvxs::TypeCode::Float32:
+            case pvxs::TypeCode::Float64:
+                field = in.get<double>();
+                break;
+            case pvxs::TypeCode::String:
+                field = in.string(in.get<uint32_t>());
+                break;
+            case pvxs::TypeCode::StringA: {
+                auto count = in.get<uint32_t>();
+                if (count > in.remaining() / sizeof(uint32_t)) {
+                    throw PvxsError("Truncated record");
+                }
+                pvxs::shared_array<std::string> texts(count);
+                for (auto &text : texts) {
+                    text = in.string(in.get<uint32_t>());
+                }
+                field = texts.freeze();
+                break;
+            }
+            default: {
+                auto type = static_cast<pvxs::ArrayType>(in.get<uint8_t>());
+                if (!is_leaf(pvxs::TypeCode(static_cast<uint8_t>(type))) || type == pvxs::ArrayType::String) {
+                    throw PvxsError("Invalid array type in snapshot");
+                }
+                auto count = in.get<uint64_t>();
+                auto size = pvxs::elementSize(type);
+                if (count > in.remaining() / size) {
+                    throw PvxsError("Truncated record");
+                }
+                auto elements = pvxs::allocArray(type, static_cast<size_t>(count));
+                std::memcpy(elements.data(), in.take(count * size), count * size);
+                field = elements.freeze();
+                break;
+            }
+            }
+        }
+    }
+
+    // Atomically replace path with a file already flushed to disk
+    void replace_file(const std::string &from, const std::string &to) {
+#if defined(_WIN32)
+        if (!MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+            throw PvxsError("Can't replace '" + to + "' (error " + std::to_string(GetLastError()) + ")");
+        }
+#else
+        if (std::rename(from.c_str(), to.c_str()) != 0) {
+            throw PvxsError("Can't replace '" + to + "': " + std::strerror(errno));
+        }
+#endif
+    }
+
+} // namespace
+
+// ============================================================================
+// ServerWrapper snapshot implementation
+// ============================================================================
+
+uint64_t ServerWrapper::save_snapshot(const std::string& path) const {
+    try {
+        SnapshotHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::string snapshot(sizeof(header), '\0');
+        // Numbered by description, so PVs built alike share one
+        std::unordered_map<std::string, uint32_t> types;
+        std::string type;
+        std::string body;
+        for (const auto& item : source_->mailbox_pvs()) {
+            auto value = item.second.fetch();
+            type.clear();
+            describe(type, value);
+
+            body.clear();
+            put_name(body, item.first);
+            auto known = types.find(type);
+            if (known != types.end()) {
+                put<uint32_t>(body, known->second);
+            } else {
+                auto index = static_cast<uint32_t>(types.size());
+                types.emplace(type, index);
+                put<uint32_t>(body, index);
+                body += type;
+            }
+            write_fields(body, value);
+
+            put<uint32_t>(snapshot, static_cast<uint32_t>(body.size()));
+            snapshot += body;
+            header.count++;
+        }
+        header.magic = snapshot_magic;
+        header.version = snapshot_version;
+        header.size = snapshot.size() - sizeof(header);
+        header.checksum = crc32(snapshot.data() + sizeof(header), snapshot.size() - sizeof(header));
+        std::memcpy(&snapshot[0], &header, sizeof(header));
+
+        // Written aside and renamed over, so a crash leaves either the old or the new snapshot
+        auto temporary = path + ".tmp";
+        write_file_synced(temporary, snapshot);
+        replace_file(temporary, path);
+        return header.count;
+    } catch (const std::exception& e) {
+        throw PvxsError("Error saving snapshot '" + path + "': " + e.what());
+    }
+}
+
+std::unique_ptr<PVSnapshotWrapper> ServerWrapper::load_snapshot(const std::string& path) {
+    try {
+        FileMapping file(path, 0, 0);
+        auto data = reinterpret_cast<const char *>(file.data());
+        SnapshotHeader header;
+        if (file.size() < sizeof(header)) {
+            throw PvxsError("Not a snapshot file");
+        }
+        std::memcpy(&header, data, sizeof(header));
+        if (header.magic != snapshot_magic || header.version != snapshot_version) {
+            throw PvxsError("Not a snapshot file");
+        }
+        if (header.size != file.size() - sizeof(header) ||
+            header.checksum != crc32(data + sizeof(header), static_cast<size_t>(header.size))) {
+            throw PvxsError("Snapshot is truncated or corrupt");
+        }
+
+        auto loaded = std::make_unique<PVSnapshotWrapper>();
+        loaded->names.reserve(header.count);
+        loaded->pvs.reserve(header.count);
+        // Each type is built once; its PVs start from clones of the empty value
+        std::vector<pvxs::Value> types;
+        ByteReader in(data + sizeof(header), static_cast<size_t>(header.size));
+        for (uint32_t i = 0; i < header.count; i++) {
+            auto size = in.get<uint32_t>();
+            ByteReader record(in.take(size), size);
+            auto name = record.string(record.get<uint16_t>());
+            auto index = record.get<uint32_t>();
+            if (index == types.size()) {
+                types.push_back(read_type(record));
+            } else if (index > types.size()) {
+                throw PvxsError("Invalid type index for '" + name + "'");
+            }
+            auto value = types[index].cloneEmpty();
+            read_fields(record, value);
+            bool is_enum = value.id().rfind("epics:nt/NTEnum:", 0) == 0;
+
+            auto pv = SharedPVWrapper::create_mailbox();
+            pv->open(ValueWrapper(std::move(value)));
+            if (is_enum) {
+                // As shared_pv_open_enum does, so a PUT can't select a missing choice
+                pv->check_enum_puts();
+            }
+            loaded->names.push_back(std::move(name));
+            loaded->pvs.push_back(std::move(pv));
+        }
+
+        std::vector<std::pair<std::string, SharedPVWrapper *>> pvs;
+        pvs.reserve(loaded->pvs.size());
+        for (size_t i = 0; i < loaded->pvs.size(); i++) {
+            pvs.emplace_back(loaded->names[i], loaded->pvs[i].get());
+        }
+        source_->add_all(pvs);
+        return loaded;
+    } catch (const std::exception& e) {
+        throw PvxsError("Error loading snapshot '" + path + "': " + e.what());
+    }
+}
+
+// ============================================================================
+// Bridge functions for snapshots
+// ============================================================================
+
+uint64_t server_save_snapshot(const ServerWrapper& server, rust::Str path) {
+    return server.save_snapshot(std::string(path));
+}
+
+std::unique_ptr<PVSnapshotWrapper> server_load_snapshot(ServerWrapper& server, rust::Str path) {
+    return server.load_snapshot(std::string(path));
+}
+
+uint64_t pv_snapshot_len(const PVSnapshotWrapper& snapshot) {
+    return snapshot.pvs.size();
+}
+
+rust::String pv_snapshot_name(const PVSnapshotWrapper& snapshot, uint64_t index) {
+    return rust::String(snapshot.names.at(static_cast<size_t>(index)));
+}
+
+std::unique_ptr<SharedPVWrapper> pv_snapshot_take(PVSnapshotWrapper& snapshot, uint64_t index) {
+    auto& pv = snapshot.pvs.at(static_cast<size_t>(index));
+    if (!pv) {
+        throw PvxsError("Snapshot PV " + std::to_string(index) + " was already taken");
+    }
+    return std::move(pv);
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,223 @@
+// server_wrapper_staging.cpp - Posts staged lock-free by many producers, applied by one flusher thread
+
+#include "wrapper.h"
+#include <algorithm>
+#include <cstring>
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    int64_t steady_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    int64_t system_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+} // namespace
+
+// ============================================================================
+// PostStagerWrapper implementation
+// ============================================================================
+
+PostStagerWrapper::Slot::Slot(Kind kind, const SharedPVWrapper& pv)
+    : kind(kind), pv(pv.get()), hub(pv.hub()), prototype(pv.get_template()) {}
+
+void PostStagerWrapper::State::flush() {
+    int64_t oldest = 0;
+    uint64_t count = 0;
+    for (auto& slot : slots) {
+        // Cleared before the value is read, so a value staged meanwhile is flushed next time at worst
+        auto at = slot.staged_at.exchange(0);
+        if (!at) {
+            continue;
+        }
+        auto stamp = slot.stamp.load();
+        auto bits = slot.bits.load();
+        oldest = oldest ? std::min(oldest, at) : at;
+
+        auto update = slot.prototype.cloneEmpty();
+        if (slot.kind == Kind::Double) {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            update["value"] = value;
+        } else {
+            update["value"] = static_cast<int32_t>(static_cast<int64_t>(bits));
+        }
+        // When the value was staged, not when it is posted
+        update["timeStamp.secondsPastEpoch"] = static_cast<int64_t>(stamp / 1000000000);
+        update["timeStamp.nanoseconds"] = static_cast<int32_t>(stamp % 1000000000);
+        try {
+            slot.hub->post(slot.pv, update);
+            posted.fetch_add(1, std::memory_order_relaxed);
+        } catch (const std::exception&) {
+            failed.fetch_add(1, std::memory_order_relaxed);
+        }
+        count++;
+    }
+    if (!count) {
+        return;
+    }
+
+    auto latency = steady_ns() - oldest;
+    flushes.fetch_add(1, std::memory_order_relaxed);
+    last_latency.store(latency, std::memory_order_relaxed);
+    total_latency.fetch_add(latency, std::memory_order_relaxed);
+    if (latency > max_latency.load(std::memory_order_relaxed)) {
+        max_latency.store(latency, std::memory_order_relaxed); // the flusher is the only writer
+    }
+}
+
+void PostStagerWrapper::State::run() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (!stopping) {
+        wake.wait_for(guard, interval, [this] { return stopping; });
+        guard.unlock();
+        flush();
+        guard.lock();
+    }
+}
+
+PostStagerWrapper::PostStagerWrapper(double interval) {
+    if (!(interval > 0.0)) {
+        throw PvxsError("Post stager interval must be > 0");
+    }
+    state_->interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(interval));
+}
+
+PostStagerWrapper::~PostStagerWrapper() {
+    stop();
+}
+
+size_t PostStagerWrapper::add(const SharedPVWrapper& pv) {
+    if (is_running()) {
+        throw PvxsError("PVs can't be added to a running post stager");
+    }
+    if (!pv.is_open()) {
+        throw PvxsError("Only open PVs can be staged");
+    }
+    auto value = pv.get_template()["value"];
+    auto code = value ? value.type() : pvxs::TypeCode::Null;
+    if (code != pvxs::TypeCode::Float64 && code != pvxs::TypeCode::Int32) {
+        throw PvxsError("Only double and int32 scalar PVs can be staged");
+    }
+    state_->slots.emplace_back(code == pvxs::TypeCode::Float64 ? Kind::Double : Kind::Int32, pv);
+    return state_->slots.size() - 1;
+}
+
+void PostStagerWrapper::stage(size_t slot, Kind kind, uint64_t bits) const {
+    if (slot >= state_->slots.size()) {
+        throw PvxsError("No post stager slot " + std::to_string(slot));
+    }
+    auto& s = state_->slots[slot];
+    if (s.kind != kind) {
+        throw PvxsError(std::string("Post stager slot ") + std::to_string(slot) + " holds " +
+                        (s.kind == Kind::Double ? "a double" : "an int32"));
+    }
+    // Sequentially consistent, so a value stored here while the slot was still pending is
+    // seen by the flusher once it clears the slot. A flush reading the slot meanwhile may pair
+    // this value with the previous time, which the next flush then corrects
+    s.bits.store(bits);
+    s.stamp.store(system_ns());
+    int64_t flushed = 0;
+    if (!s.staged_at.compare_exchange_strong(flushed, steady_ns())) {
+        state_->coalesced.fetch_add(1, std::memory_order_relaxed);
+    }
+    state_->staged.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PostStagerWrapper::stage_double(size_t slot, double value) const {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    stage(slot, Kind::Double, bits);
+}
+
+void PostStagerWrapper::stage_int32(size_t slot, int32_t value) const {
+    stage(slot, Kind::Int32, static_cast<uint64_t>(static_cast<int64_t>(value)));
+}
+
+void PostStagerWrapper::start() {
+    if (is_running()) {
+        return;
+    }
+    state_->stopping = false;
+    auto state = state_;
+    flusher_ = std::thread([state] { state->run(); });
+}
+
+void PostStagerWrapper::stop() {
+    if (!is_running()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard(state_->lock);
+        state_->stopping = true;
+    }
+    state_->wake.notify_one();
+    flusher_.join();
+}
+
+PostStagerWrapper::Stats PostStagerWrapper::stats() const {
+    Stats stats;
+    stats.staged = state_->staged.load(std::memory_order_relaxed);
+    stats.coalesced = state_->coalesced.load(std::memory_order_relaxed);
+    stats.posted = state_->posted.load(std::memory_order_relaxed);
+    stats.failed = state_->failed.load(std::memory_order_relaxed);
+    stats.flushes = state_->flushes.load(std::memory_order_relaxed);
+    stats.last_latency = state_->last_latency.load(std::memory_order_relaxed) * 1e-9;
+    stats.max_latency = state_->max_latency.load(std::memory_order_relaxed) * 1e-9;
+    if (stats.flushes) {
+        stats.mean_latency = state_->total_latency.load(std::memory_order_relaxed) * 1e-9 / stats.flushes;
+    }
+    return stats;
+}
+
+// ============================================================================
+// Bridge functions for post stagers
+// ============================================================================
+
+std::unique_ptr<PostStagerWrapper> post_stager_create(double interval) {
+    return std::make_unique<PostStagerWrapper>(interval);
+}
+
+uint64_t post_stager_add(PostStagerWrapper& stager, const SharedPVWrapper& pv) {
+    return stager.add(pv);
+}
+
+void post_stager_stage_double(const PostStagerWrapper& stager, uint64_t slot, double value) {
+    stager.stage_double(static_cast<size_t>(slot), value);
+}
+
+void post_stager_stage_int32(const PostStagerWrapper& stager, uint64_t slot, int32_t value) {
+    stager.stage_int32(static_cast<size_t>(slot), value);
+}
+
+void post_stager_start(PostStagerWrapper& stager) {
+    stager.start();
+}
+
+void post_stager_stop(PostStagerWrapper& stager) {
+    stager.stop();
+}
+
+bool post_stager_is_running(const PostStagerWrapper& stager) {
+    return stager.is_running();
+}
+
+void post_stager_stats(const PostStagerWrapper& stager, uint64_t& staged, uint64_t& coalesced, uint64_t& posted,
+                       uint64_t& failed, uint64_t& flushes, double& last_latency, double& max_latency,
+                       double& mean_latency) {
+    auto stats = stager.stats();
+    staged = stats.staged;
+    coalesced = stats.coalesced;
+    posted = stats.posted;
+    failed = stats.failed;
+    flushes = stats.flushes;
+    last_latency = stats.last_latency;
+    max_latency = stats.max_latency;
+    mean_latency = stats.mean_latency;
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,882 @@
+// server_wrapper_subscriptions.cpp - Subscription fan-out and per-client send limits for served PVs
+
+#include "wrapper.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <thread>
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    // Trailing flushes of subscribers with a minimum interval, all served by one thread
+    class FlushTimer
+    {
+    private:
+        std::mutex lock_;
+        std::condition_variable wake_;
+        std::multimap<std::chrono::steady_clock::time_point, std::weak_ptr<HubSubscriber>> due_;
+
+        void run() {
+            std::unique_lock<std::mutex> guard(lock_);
+            while (true) {
+                if (due_.empty()) {
+                    wake_.wait(guard);
+                    continue;
+                }
+                auto first = due_.begin();
+                if (std::chrono::steady_clock::now() < first->first) {
+                    wake_.wait_until(guard, first->first);
+                    continue;
+                }
+                auto sub = first->second.lock();
+                due_.erase(first);
+                guard.unlock();
+                if (sub) {
+                    if (auto hub = sub->hub.lock()) {
+                        hub->flush(sub);
+                    }
+                }
+                guard.lock();
+            }
+        }
+
+    public:
+        FlushTimer() {
+            std::thread([this]() { run(); }).detach();
+        }
+
+        void schedule(std::chrono::steady_clock::time_point when, const std::shared_ptr<HubSubscriber> &sub) {
+            std::lock_guard<std::mutex> guard(lock_);
+            due_.emplace(when, sub);
+            wake_.notify_one();
+        }
+    };
+
+    // Never destroyed, its thread may be waiting until the process exits
+    FlushTimer &flush_timer() {
+        static auto *timer = new FlushTimer();
+        return *timer;
+    }
+
+    // Parse pvRequest record[name=...] as a number, false if the option is absent
+    bool record_option(pvxs::Value request, const char *name, double &out) {
+        auto field = request[std::string("record._options.") + name];
+        if (!field) {
+            return false;
+        }
+        auto text = field.as<std::string>();
+        char *end = nullptr;
+        out = std::strtod(text.c_str(), &end);
+        if (text.empty() || *end || !std::isfinite(out)) {
+            throw PvxsError(std::string("invalid record[") + name + "=" + text + "]");
+        }
+        return true;
+    }
+
+    // Parse pvRequest record[name=N] as an integer of at least min, false if the option is absent
+    bool record_index(pvxs::Value request, const char *name, double min, size_t &out) {
+        double option;
+        if (!record_option(request, name, option)) {
+            return false;
+        }
+        if (option < min || option != std::floor(option)) {
+            throw PvxsError(std::string("record[") + name + "] must be an integer of at least " + std::to_string(int(min)));
+        }
+        out = static_cast<size_t>(option);
+        return true;
+    }
+
+    // The subscriber's slice of one array. A stride of 1 is a view sharing the posted storage,
+    // other strides copy the selected elements.
+    template <typename E>
+    pvxs::shared_array<const void> slice_elements(const HubSubscriber &sub, const pvxs::shared_array<const void> &input) {
+        auto elements = input.castTo<const E>();
+        size_t start = std::min(sub.slice_start, elements.size());
+        size_t available = (elements.size() - start + sub.slice_stride - 1) / sub.slice_stride;
+        size_t count = std::min(sub.slice_count, available);
+        if (sub.slice_stride == 1) {
+            elements.slice(start, count);
+            return elements.template castTo<const void>();
+        }
+        pvxs::shared_array<E> output(count);
+        for (size_t i = 0; i < count; i++) {
+            output[i] = elements[start + i * sub.slice_stride];
+        }
+        return output.freeze().template castTo<const void>();
+    }
+
+    // Replace a marked array value of update with the subscriber's slice of it
+    void slice_value(const HubSubscriber &sub, pvxs::Value &update) {
+        auto value = update["value"];
+        if (!value || !value.isMarked() || value.storageType() != pvxs::StoreType::Array) {
+            return;
+        }
+        auto input = value.as<pvxs::shared_array<const void>>();
+        pvxs::shared_array<const void> output;
+        switch (input.original_type()) {
+        case pvxs::ArrayType::Bool: output = slice_elements<bool>(sub, input); break;
+        case pvxs::ArrayType::Int8: output = slice_elements<int8_t>(sub, input); break;
+        case pvxs::ArrayType::Int16: output = slice_elements<int16_t>(sub, input); break;
+        case pvxs::ArrayType::Int32: output = slice_elements<int32_t>(sub, input); break;
+        case pvxs::ArrayType::Int64: output = slice_elements<int64_t>(sub, input); break;
+        case pvxs::ArrayType::UInt8: output = slice_elements<uint8_t>(sub, input); break;
+        case pvxs::ArrayType::UInt16: output = slice_elements<uint16_t>(sub, input); break;
+        case pvxs::ArrayType::UInt32: output = slice_elements<uint32_t>(sub, input); break;
+        case pvxs::ArrayType::UInt64: output = slice_elements<uint64_t>(sub, input); break;
+        case pvxs::ArrayType::Float32: output = slice_elements<float>(sub, input); break;
+        case pvxs::ArrayType::Float64: output = slice_elements<double>(sub, input); break;
+        case pvxs::ArrayType::String: output = slice_elements<std::string>(sub, input); break;
+        default:
+            return; // empty or structure arrays are sent whole
+        }
+        value = output;
+    }
+
+    // Remember the scalar value a filtered subscriber was last sent
+    void note_sent(HubSubscriber &sub, const pvxs::Value &update) {
+        auto value = update["value"];
+        if (!value || !value.isMarked()) {
+            return;
+        }
+        switch (value.storageType()) {
+        case pvxs::StoreType::Integer:
+        case pvxs::StoreType::UInteger:
+        case pvxs::StoreType::Real:
+            sub.last_value = value.as<double>();
+            sub.last_value_valid = true;
+            break;
+        default:
+            sub.last_value_valid = false;
+        }
+    }
+
+    // True if an update changes nothing but a scalar value, by no more than the subscriber's deadband
+    bool within_deadband(const HubSubscriber &sub, const pvxs::Value &update) {
+        for (auto field : update.ichildren()) {
+            const auto &name = update.nameOf(field);
+            if (name != "value" && name != "timeStamp" && field.isMarked(true, true)) {
+                return false; // alarm and metadata changes always go through
+            }
+        }
+        auto value = update["value"];
+        if (!value.isMarked()) {
+            return true;
+        }
+        if (!sub.last_value_valid) {
+            return false;
+        }
+        double current;
+        switch (value.storageType()) {
+        case pvxs::StoreType::Integer:
+        case pvxs::StoreType::UInteger:
+        case pvxs::StoreType::Real:
+            current = value.as<double>();
+            break;
+        default:
+            return false; // arrays and strings are not filtered
+        }
+        double change = std::fabs(current - sub.last_value);
+        if (std::isnan(change)) {
+            return false;
+        }
+        // With both bands set, leaving either one is enough
+        bool within = true;
+        if (sub.deadband > 0) {
+            within = within && change <= sub.deadband;
+        }
+        if (sub.deadband_percent > 0) {
+            within = within && change <= std::fabs(sub.last_value) * sub.deadband_percent / 100.0;
+        }
+        return within;
+    }
+
+    // True if the pvRequest asks for an option only a SubscriberHub implements
+    bool wants_hub(pvxs::Value request) {
+        for (auto name : {"dec", "interval", "deadband", "deadbandPercent", "start", "count", "stride"}) {
+            if (request[std::string("record._options.") + name]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Given to SharedPV::attach() in place of a channel. Keeps the SharedPV's subscribe handler aside
+    // for subscriptions which need nothing from the hub, and passes everything else on to the channel.
+    class ChannelInterposer : public pvxs::server::ChannelControl
+    {
+    public:
+        using Subscribe = std::function<void(std::unique_ptr<pvxs::server::MonitorSetupOp>&&)>;
+
+    private:
+        std::unique_ptr<pvxs::server::ChannelControl> channel_;
+        std::shared_ptr<Subscribe> subscribe_;
+
+    public:
+        ChannelInterposer(std::unique_ptr<pvxs::server::ChannelControl>&& channel, std::shared_ptr<Subscribe> subscribe)
+            : pvxs::server::ChannelControl(channel->name(), channel->credentials(), None),
+              channel_(std::move(channel)), subscribe_(std::move(subscribe)) {}
+
+        void onOp(std::function<void(std::unique_ptr<pvxs::server::ConnectOp>&&)>&& fn) override {
+            channel_->onOp(std::move(fn));
+        }
+        void onRPC(std::function<void(std::unique_ptr<pvxs::server::ExecOp>&&, pvxs::Value&&)>&& fn) override {
+            channel_->onRPC(std::move(fn));
+        }
+        void onSubscribe(Subscribe&& fn) override {
+            *subscribe_ = std::move(fn);
+        }
+        void onClose(std::function<void(const std::string&)>&& fn) override {
+            channel_->onClose(std::move(fn));
+        }
+        void close() override {
+            channel_->close();
+        }
+
+    protected:
+        void _updateInfo(const std::shared_ptr<const pvxs::server::ReportInfo>& info) override {
+            channel_->updateInfo(info);
+        }
+    };
+
+} // namespace
+
+// ============================================================================
+// SendLimiter implementation
+// ============================================================================
+
+bool SendLimiter::account(Client& client, HubSubscriber& sub, size_t depth) {
+    auto& stats = client.stats;
+    stats.queued = stats.queued + depth - sub.queued;
+    sub.queued = depth;
+    if (stats.queued > stats.max_queued) {
+        stats.max_queued = stats.queued;
+    }
+
+    // Alert on the way up, clear once the client has caught up to half the threshold
+    size_t threshold = config_.alert_queued_per_client;
+    if (!stats.slow && threshold && stats.queued >= threshold) {
+        stats.slow = true;
+        stats.alerts++;
+        alert_count_++;
+        return true;
+    }
+    if (stats.slow && stats.queued <= threshold / 2) {
+        stats.slow = false;
+    }
+    return false;
+}
+
+void SendLimiter::attach(const std::shared_ptr<HubSubscriber>& sub) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto& client = clients_[sub->peer];
+    client.stats.subscriptions++;
+    client.subscribers.push_back(sub);
+}
+
+void SendLimiter::detach(HubSubscriber& sub) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = clients_.find(sub.peer);
+    if (it == clients_.end()) {
+        return;
+    }
+    auto& client = it->second;
+    account(client, sub, 0);
+    if (sub.pending) {
+        client.held--;
+    }
+    client.subscribers.remove_if([&sub](const std::weak_ptr<HubSubscriber>& entry) {
+        auto other = entry.lock();
+        return !other || other.get() == &sub;
+    });
+    if (--client.stats.subscriptions == 0) {
+        clients_.erase(it);
+    }
+}
+
+bool SendLimiter::fits(HubSubscriber& sub, size_t depth) {
+    bool alert;
+    bool fits;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto& client = clients_[sub.peer];
+        alert = account(client, sub, depth);
+        fits = !config_.max_queued_per_client || client.stats.queued < config_.max_queued_per_client;
+    }
+    if (alert && alert_) {
+        alert_();
+    }
+    return fits;
+}
+
+void SendLimiter::settle(HubSubscriber& sub, size_t depth, bool was_held, bool held, bool squashed) {
+    bool alert;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto& client = clients_[sub.peer];
+        alert = account(client, sub, depth);
+        client.held = client.held + held - was_held;
+        if (squashed) {
+            client.stats.squashed++;
+        }
+    }
+    if (alert && alert_) {
+        alert_();
+    }
+}
+
+std::vector<std::shared_ptr<HubSubscriber>> SendLimiter::waiting(const HubSubscriber& sub) {
+    std::vector<std::shared_ptr<HubSubscriber>> result;
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = clients_.find(sub.peer);
+    if (it == clients_.end() || it->second.held == 0) {
+        return result;
+    }
+    for (auto& entry : it->second.subscribers) {
+        auto other = entry.lock();
+        if (other && other.get() != &sub) {
+            result.push_back(std::move(other));
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> SendLimiter::peers() {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::vector<std::string> result;
+    result.reserve(clients_.size());
+    for (auto& entry : clients_) {
+        result.push_back(entry.first);
+    }
+    return result;
+}
+
+bool SendLimiter::client_stats(const std::string& peer, ClientStats& stats) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = clients_.find(peer);
+    if (it == clients_.end()) {
+        return false;
+    }
+    stats = it->second.stats;
+    return true;
+}
+
+uint64_t SendLimiter::alert_count() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return alert_count_;
+}
+
+// ============================================================================
+// SubscriberHub implementation
+// ============================================================================
+
+void SubscriberHub::deliver(HubSubscriber& sub, const pvxs::Value& posted) {
+    // Each subscriber gets its own copy since a squash modifies the queued value in place.
+    // Copies share array storage, so only slices with a stride allocate.
+    auto update = posted ? posted.clone() : pvxs::Value();
+    if (update && sub.has_slice()) {
+        slice_value(sub, update);
+    }
+    if (!sub.limiter) {
+        // Without limits pvxs squashes full queues itself
+        sub.control->post(update);
+        return;
+    }
+
+    // A subscriber which already has an update held back keeps folding new ones into it,
+    // so the client sees the latest value once it catches up.
+    bool was_held = bool(sub.pending);
+    bool squashed = false;
+    if (was_held && update) {
+        sub.pending.assign(update);
+        squashed = true;
+    }
+
+    pvxs::server::MonitorStat stat{};
+    sub.control->stats(stat);
+    size_t depth = stat.nQueue;
+
+    pvxs::Value next = was_held ? sub.pending : update;
+    if (next && sub.limiter->fits(sub, depth) && sub.control->tryPost(next)) {
+        sub.pending = pvxs::Value();
+        depth++;
+    } else if (!was_held && next) {
+        sub.pending = std::move(next);
+        Tracer::instant("server", "hold", name_);
+    } else if (squashed) {
+        Tracer::instant("server", "squash", name_);
+    }
+    sub.limiter->settle(sub, depth, was_held, bool(sub.pending), squashed);
+}
+
+template <typename Fn>
+void SubscriberHub::send(Fn&& fn) {
+    std::vector<std::shared_ptr<HubSubscriber>> waiting;
+    {
+        std::lock_guard<std::mutex> send(send_lock_);
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            sending_ = true;
+        }
+        fn();
+
+        // Callbacks which ran meanwhile, possibly from inside the calls into pvxs above, left their work here
+        while (true) {
+            std::vector<Deferred> deferred;
+            {
+                std::lock_guard<std::mutex> guard(lock_);
+                if (deferred_.empty()) {
+                    sending_ = false;
+                    break;
+                }
+                deferred.swap(deferred_);
+            }
+            for (auto& work : deferred) {
+                auto& sub = work.sub;
+                switch (work.kind) {
+                case Deferred::Retry:
+                    if (sub->control && sub->pending) {
+                        deliver(*sub, pvxs::Value());
+                    }
+                    break;
+                case Deferred::Drained: {
+                    if (!sub->control) {
+                        break;
+                    }
+                    deliver(*sub, pvxs::Value());
+                    auto others = sub->limiter->waiting(*sub);
+                    waiting.insert(waiting.end(), others.begin(), others.end());
+                    break;
+                }
+                case Deferred::Closed: {
+                    auto it = std::find(subscribers_.begin(), subscribers_.end(), sub);
+                    if (it == subscribers_.end()) {
+                        break;
+                    }
+                    subscribers_.erase(it);
+                    Tracer::instant("server", "unsubscribe", name_);
+                    if (sub->limiter) {
+                        sub->limiter->detach(*sub);
+                    }
+                    break;
+                }
+                }
+            }
+        }
+    }
+    // Other subscriptions of the same client may belong to other hubs, so retry them without send_lock_
+    for (auto& other : waiting) {
+        if (auto hub = other->hub.lock()) {
+            hub->retry(other);
+        }
+    }
+}
+
+void SubscriberHub::defer(const std::shared_ptr<HubSubscriber>& sub, Deferred::Kind kind) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        deferred_.push_back(Deferred{sub, kind});
+        if (sending_) {
+            return; // done by the sending thread before it lets go of send_lock_
+        }
+    }
+    send([]() {});
+}
+
+void SubscriberHub::open(const pvxs::Value& initial) {
+    send([&]() {
+        current_ = initial.clone();
+        for (auto& sub : subscribers_) {
+            deliver(*sub, current_);
+        }
+    });
+}
+
+void SubscriberHub::close() {
+    send([&]() {
+        current_ = pvxs::Value();
+        std::list<std::shared_ptr<HubSubscriber>> subscribers;
+        subscribers.swap(subscribers_);
+        for (auto& sub : subscribers) {
+            if (sub->limiter) {
+                sub->limiter->detach(*sub);
+            }
+            sub->control->finish();
+        }
+    });
+}
+
+void SubscriberHub::post(pvxs::server::SharedPV& pv, const pvxs::Value& update) {
+    // Held across both so every subscriber sees updates in the order the SharedPV applied them.
+    // The SharedPV itself holds its own lock across posting to its subscriptions the same way.
+    TraceSpan span("server", "post", name_);
+    send([&]() {
+        pv.post(update);
+        posts_.fetch_add(1, std::memory_order_release);
+        if (current_) {
+            current_.assign(update);
+        }
+        for (auto& sub : subscribers_) {
+            offer(sub, update);
+        }
+    });
+}
+
+void SubscriberHub::offer(const std::shared_ptr<HubSubscriber>& sub, const pvxs::Value& update) {
+    if (!sub->rate_limited() && !sub->has_deadband()) {
+        deliver(*sub, update);
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    auto gap = now - sub->last_offered;
+    sub->last_offered = now;
+
+    // Posts are deltas, so skipped ones are folded together rather than dropped
+    if (sub->skipped) {
+        sub->skipped.assign(update);
+    } else {
+        sub->skipped = update.clone();
+    }
+    if (sub->has_deadband() && within_deadband(*sub, sub->skipped)) {
+        return;
+    }
+    if (sub->posts++ % sub->decimation != 0) {
+        // Should the PV go quiet, the folded posts still go out once the skipped ones would
+        // have taken their time at the rate seen so far
+        sub->tail_due = now + gap * static_cast<int64_t>(sub->decimation);
+        if (!sub->flush_scheduled) {
+            sub->flush_scheduled = true;
+            flush_timer().schedule(sub->tail_due, sub);
+        }
+        return;
+    }
+    if (now - sub->last_sent < sub->min_interval) {
+        if (!sub->flush_scheduled) {
+            sub->flush_scheduled = true;
+            flush_timer().schedule(sub->last_sent + sub->min_interval, sub);
+        }
+        return;
+    }
+    send_skipped(*sub, now);
+}
+
+void SubscriberHub::send_skipped(HubSubscriber& sub, std::chrono::steady_clock::time_point now) {
+    auto next = std::move(sub.skipped);
+    sub.skipped = pvxs::Value();
+    sub.last_sent = now;
+    note_sent(sub, next);
+    deliver(sub, next);
+}
+
+void SubscriberHub::flush(const std::shared_ptr<HubSubscriber>& sub) {
+    send([&]() {
+        sub->flush_scheduled = false;
+        if (!sub->skipped || std::find(subscribers_.begin(), subscribers_.end(), sub) == subscribers_.end()) {
+            return;
+        }
+        auto now = std::chrono::steady_clock::now();
+        auto due = std::max(sub->last_sent + sub->min_interval, sub->tail_due);
+        if (now < due) {
+            // Something was sent or skipped since this flush was scheduled
+            sub->flush_scheduled = true;
+            flush_timer().schedule(due, sub);
+            return;
+        }
+        Tracer::instant("server", "flush", name_);
+        send_skipped(*sub, now);
+    });
+}
+
+void SubscriberHub::subscribe(std::unique_ptr<pvxs::server::MonitorSetupOp>&& setup,
+                              const std::shared_ptr<SendLimiter>& limiter) {
+    send([&]() {
+        if (!current_) {
+            setup->error("PV is not open");
+            return;
+        }
+
+        auto sub = std::make_shared<HubSubscriber>();
+        sub->peer = setup->peerName();
+        sub->hub = shared_from_this();
+        sub->limiter = limiter;
+
+        try {
+            double option;
+            if (record_option(setup->pvRequest(), "dec", option)) {
+                if (option < 1 || option != std::floor(option)) {
+                    throw PvxsError("record[dec] must be a positive integer");
+                }
+                sub->decimation = static_cast<uint64_t>(option);
+            }
+            if (record_option(setup->pvRequest(), "interval", option)) {
+                if (option < 0) {
+                    throw PvxsError("record[interval] must not be negative");
+                }
+                sub->min_interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(option));
+            }
+            if (record_option(setup->pvRequest(), "deadband", option)) {
+                if (option < 0) {
+                    throw PvxsError("record[deadband] must not be negative");
+                }
+                sub->deadband = option;
+            }
+            if (record_option(setup->pvRequest(), "deadbandPercent", option)) {
+                if (option < 0) {
+                    throw PvxsError("record[deadbandPercent] must not be negative");
+                }
+                sub->deadband_percent = option;
+            }
+            bool start = record_index(setup->pvRequest(), "start", 0, sub->slice_start);
+            bool count = record_index(setup->pvRequest(), "count", 0, sub->slice_count);
+            bool stride = record_index(setup->pvRequest(), "stride", 1, sub->slice_stride);
+            if ((start || count || stride) && current_["value"].storageType() != pvxs::StoreType::Array) {
+                throw PvxsError("record[start/count/stride] needs an array value");
+            }
+        } catch (const std::exception& e) {
+            setup->error(e.what());
+            return;
+        }
+
+        std::weak_ptr<SubscriberHub> weak_hub = shared_from_this();
+        std::weak_ptr<HubSubscriber> weak_sub = sub;
+        setup->onClose([weak_hub, weak_sub](const std::string&) {
+            if (auto hub = weak_hub.lock()) {
+                hub->unsubscribe(weak_sub);
+            }
+        });
+
+        sub->control = setup->connect(current_);
+        if (limiter) {
+            // Every time a queue empties, give held back updates of the same client another go
+            sub->control->setWatermarks(0, 1);
+            sub->control->onLowMark([weak_hub, weak_sub]() {
+                auto hub = weak_hub.lock();
+                auto sub = weak_sub.lock();
+                if (hub && sub) {
+                    hub->drained(sub);
+                }
+            });
+            limiter->attach(sub);
+        }
+        subscribers_.push_back(sub);
+        Tracer::instant("server", "subscribe", name_);
+        sub->last_sent = std::chrono::steady_clock::now();
+        sub->last_offered = sub->last_sent;
+        note_sent(*sub, current_);
+        deliver(*sub, current_);
+    });
+}
+
+void SubscriberHub::unsubscribe(const std::weak_ptr<HubSubscriber>& weak_sub) {
+    if (auto sub = weak_sub.lock()) {
+        defer(sub, Deferred::Closed);
+    }
+}
+
+void SubscriberHub::drained(const std::shared_ptr<HubSubscriber>& sub) {
+    defer(sub, Deferred::Drained);
+}
+
+void SubscriberHub::retry(const std::shared_ptr<HubSubscriber>& sub) {
+    defer(sub, Deferred::Retry);
+}
+
+size_t SubscriberHub::subscriber_count() {
+    std::lock_guard<std::mutex> send(send_lock_);
+    return subscribers_.size();
+}
+
+// ============================================================================
+// SharedPVSource implementation
+// ============================================================================
+
+void SharedPVSource::add(const std::string& name, SharedPVWrapper& pv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!pvs_.emplace(name, Entry{pv.get(), pv.hub(), pv.computed(), pv.is_mailbox()}).second) {
+        throw PvxsError("PV already exists");
+    }
+    if (pv.hub()->name().empty()) {
+        pv.hub()->set_name(name);
+    }
+}
+
+void SharedPVSource::add_all(const std::vector<std::pair<std::string, SharedPVWrapper *>>& pvs) {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::vector<std::map<std::string, Entry>::iterator> added;
+    added.reserve(pvs.size());
+    for (const auto& item : pvs) {
+        auto& pv = *item.second;
+        auto result = pvs_.emplace(item.first, Entry{pv.get(), pv.hub(), pv.computed(), pv.is_mailbox()});
+        if (!result.second) {
+            for (auto it : added) {
+                pvs_.erase(it);
+            }
+            throw PvxsError("PV '" + item.first + "' already exists");
+        }
+        added.push_back(result.first);
+    }
+    for (const auto& item : pvs) {
+        if (item.second->hub()->name().empty()) {
+            item.second->hub()->set_name(item.first);
+        }
+    }
+}
+
+std::vector<std::pair<std::string, pvxs::server::SharedPV>> SharedPVSource::mailbox_pvs() {
+    std::lock_guard<std::mutex> guard(lock_);
+    std::vector<std::pair<std::string, pvxs::server::SharedPV>> pvs;
+    pvs.reserve(pvs_.size());
+    for (const auto& entry : pvs_) {
+        if (entry.second.mailbox && !entry.second.computed) {
+            pvs.emplace_back(entry.first, entry.second.pv);
+        }
+    }
+    return pvs;
+}
+
+void SharedPVSource::remove(const std::string& name) {
+    std::lock_guard<std::mutex> guard(lock_);
+    pvs_.erase(name);
+}
+
+void SharedPVSource::set_limiter(std::shared_ptr<SendLimiter> limiter) {
+    std::lock_guard<std::mutex> guard(lock_);
+    limiter_ = std::move(limiter);
+}
+
+std::shared_ptr<SendLimiter> SharedPVSource::limiter() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return limiter_;
+}
+
+void SharedPVSource::onSearch(Search& op) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto& name : op) {
+        if (pvs_.find(name.name()) != pvs_.end()) {
+            name.claim();
+        }
+    }
+}
+
+void SharedPVSource::onCreate(std::unique_ptr<pvxs::server::ChannelControl>&& chan) {
+    Entry entry;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = pvs_.find(chan->name());
+        if (it == pvs_.end()) {
+            return;
+        }
+        entry = it->second;
+    }
+
+    // attach() installs all of the SharedPV's handlers, keeping its subscribe handler aside. The
+    // channel stays alive while attached, so ours can be installed afterwards, before any request can arrive.
+    auto* control = chan.get();
+    auto stock = std::make_shared<ChannelInterposer::Subscribe>();
+    entry.pv.attach(std::unique_ptr<pvxs::server::ChannelControl>(new ChannelInterposer(std::move(chan), stock)));
+
+    std::weak_ptr<SharedPVSource> weak_self = shared_from_this();
+    auto hub = entry.hub;
+    auto computed = entry.computed;
+    auto pv = entry.pv;
+    control->onSubscribe([weak_self, hub, computed, pv, stock](std::unique_ptr<pvxs::server::MonitorSetupOp>&& setup) mutable {
+        std::shared_ptr<SendLimiter> limiter;
+        if (auto self = weak_self.lock()) {
+            limiter = self->limiter();
+        }
+        if (computed) {
+            // New subscribers start from the last value, and see a stale one replaced once the worker has computed it
+            computed->refresh(pv, hub);
+        }
+        // Without send limits or per-subscription options the SharedPV serves the subscription as usual
+        if (!limiter && !wants_hub(setup->pvRequest()) && *stock) {
+            (*stock)(std::move(setup));
+            return;
+        }
+        hub->subscribe(std::move(setup), limiter);
+    });
+
+    if (computed) {
+        // Replaces the SharedPV's GET and PUT handling: GETs evaluate, PUTs are refused
+        control->onOp([hub, computed, pv](std::unique_ptr<pvxs::server::ConnectOp>&& op) {
+            op->onGet([hub, computed, pv](std::unique_ptr<pvxs::server::ExecOp>&& get) {
+                TraceSpan span("server", "onGet", hub->name());
+                computed->get(std::move(get), pv, hub);
+            });
+            op->onPut([](std::unique_ptr<pvxs::server::ExecOp>&& put, pvxs::Value&&) {
+                put->error("Computed PV is read-only");
+            });
+            try {
+                op->connect(pv.fetch());
+            } catch (const std::exception& e) {
+                op->error(e.what());
+            }
+        });
+    }
+}
+
+SharedPVSource::List SharedPVSource::onList() {
+    auto names = std::make_shared<std::set<std::string>>();
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (auto& entry : pvs_) {
+            names->insert(entry.first);
+        }
+    }
+    List list;
+    list.names = names;
+    list.dynamic = true;
+    return list;
+}
+
+// ============================================================================
+// Send limit functions for Rust FFI
+// ============================================================================
+
+void server_enable_send_limits(ServerWrapper& server, uint64_t max_queued_per_client, uint64_t alert_queued_per_client,
+                               uintptr_t alert_callback) {
+    SendLimiter::Config config;
+    config.max_queued_per_client = static_cast<size_t>(max_queued_per_client);
+    config.alert_queued_per_client = static_cast<size_t>(alert_queued_per_client);
+    server.enable_send_limits(config, reinterpret_cast<void (*)()>(alert_callback));
+}
+
+void server_disable_send_limits(ServerWrapper& server) {
+    server.disable_send_limits();
+}
+
+rust::Vec<rust::String> server_send_clients(const ServerWrapper& server) {
+    rust::Vec<rust::String> result;
+    if (auto limiter = server.send_limiter()) {
+        for (auto& peer : limiter->peers()) {
+            result.push_back(rust::String(peer));
+        }
+    }
+    return result;
+}
+
+bool server_client_send_stats(const ServerWrapper& server, rust::Str peer, uint64_t& subscriptions, uint64_t& queued,
+                              uint64_t& max_queued, uint64_t& squashed, uint64_t& alerts, bool& slow) {
+    auto limiter = server.send_limiter();
+    SendLimiter::ClientStats stats;
+    if (!limiter || !limiter->client_stats(std::string(peer), stats)) {
+        return false;
+    }
+    subscriptions = stats.subscriptions;
+    queued = stats.queued;
+    max_queued = stats.max_queued;
+    squashed = stats.squashed;
+    alerts = stats.alerts;
+    slow = stats.slow;
+    return true;
+}
+
+uint64_t server_send_alert_count(const ServerWrapper& server) {
+    auto limiter = server.send_limiter();
+    return limiter ? limiter->alert_count() : 0;
+}
+
+} // namespace pvxs_wrapper
@@ -0,0 +1,303 @@
+// trace_wrapper.cpp - Timeline tracer with Chrome Trace Event JSON export
+
+#include "wrapper.h"
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace pvxs_wrapper {
+
+namespace {
+
+    struct TraceEvent {
+        uint64_t ts_ns;
+        uint64_t id;
+        const char* category;
+        char phase;
+        char name[40];
+        char pv[64];
+    };
+
+    // Written by its own thread only. Events below size are never modified again, so readers
+    // need nothing more than an acquire load of size.
+    struct ThreadBuffer {
+        ThreadBuffer(size_t capacity, uint32_t tid) : events(capacity), tid(tid) {}
+
+        std::vector<TraceEvent> events;
+        std::atomic<size_t> size{0};
+        std::atomic<uint64_t> dropped{0};
+        uint32_t tid;
+        char thread_name[32] = {};
+    };
+
+    // Buffers of the current recording. enable() and clear() start a new epoch, after which
+    // each thread registers a fresh buffer on its next event.
+    struct TraceRegistry {
+        std::mutex lock;
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        size_t capacity = 0;
+        uint64_t epoch = 0;
+        uint32_t next_tid = 1;
+    };
+
+    TraceRegistry& registry() {
+        static TraceRegistry instance;
+        return instance;
+    }
+
+    std::atomic<uint64_t> trace_epoch{0};
+    std::atomic<uint64_t> next_async_id{1};
+    const auto trace_origin = std::chrono::steady_clock::now();
+
+    struct ThreadLocalTrace {
+        std::shared_ptr<ThreadBuffer> buffer;
+        uint64_t epoch = 0;
+        uint32_t tid = 0;
+    };
+    thread_local ThreadLocalTrace local_trace;
+
+    void copy_truncated(char* dest, size_t size, const char* src, size_t length) {
+        size_t n = length < size - 1 ? length : size - 1;
+        std::memcpy(dest, src, n);
+        dest[n] = '\0';
+    }
+
+    ThreadBuffer* thread_buffer() {
+        if (local_trace.buffer && local_trace.epoch == trace_epoch.load(std::memory_order_acquire)) {
+            return local_trace.buffer.get();
+        }
+        auto& reg = registry();
+        std::lock_guard<std::mutex> guard(reg.lock);
+        if (!reg.capacity) {
+            return nullptr;
+        }
+        if (!local_trace.tid) {
+            local_trace.tid = reg.next_tid++;
+        }
+        auto buffer = std::make_shared<ThreadBuffer>(reg.capacity, local_trace.tid);
+#if defined(__linux__) || defined(__APPLE__)
+        pthread_getname_np(pthread_self(), buffer->thread_name, sizeof(buffer->thread_name));
+#endif
+        if (!buffer->thread_name[0]) {
+            std::snprintf(buffer->thread_name, sizeof(buffer->thread_name), "thread %u", local_trace.tid);
+        }
+        reg.buffers.push_back(buffer);
+        local_trace.buffer = std::move(buffer);
+        local_trace.epoch = reg.epoch;
+        return local_trace.buffer.get();
+    }
+
+    void append_escaped(std::ostringstream& out, const char* text) {
+        for (const char* c = text; *c; c++) {
+            switch (*c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(*c));
+                    out << code;
+                } else {
+                    out << *c;
+                }
+            }
+        }
+    }
+
+} // namespace
+
+// ============================================================================
+// Tracer implementation
+// ============================================================================
+
+std::atomic<bool> Tracer::enabled_{false};
+
+void Tracer::enable(size_t events_per_thread) {
+    if (events_per_thread == 0) {
+        throw PvxsError("Trace buffers need room for at least one event");
+    }
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    reg.buffers.clear();
+    reg.capacity = events_per_thread;
+    trace_epoch.store(++reg.epoch, std::memory_order_release);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::disable() {
+    // Buffers are kept so the recording can still be exported
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+void Tracer::clear() {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    reg.buffers.clear();
+    trace_epoch.store(++reg.epoch, std::memory_order_release);
+}
+
+void Tracer::record(char phase, const char* category, const char* name, const std::string& pv, uint64_t id) {
+    ThreadBuffer* buffer = thread_buffer();
+    if (!buffer) {
+        return;
+    }
+    size_t index = buffer->size.load(std::memory_order_relaxed);
+    if (index >= buffer->events.size()) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    auto& event = buffer->events[index];
+    event.ts_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - trace_origin).count());
+    event.id = id;
+    event.category = category;
+    event.phase = phase;
+    copy_truncated(event.name, sizeof(event.name), name, std::strlen(name));
+    copy_truncated(event.pv, sizeof(event.pv), pv.data(), pv.size());
+    buffer->size.store(index + 1, std::memory_order_release);
+}
+
+void Tracer::begin(const char* category, const char* name, const std::string& pv) {
+    if (enabled()) {
+        record('B', category, name, pv, 0);
+    }
+}
+
+void Tracer::end(const char* category, const char* name) {
+    // Not gated on enabled() so spans open when tracing stops are still closed
+    record('E', category, name, std::string(), 0);
+}
+
+void Tracer::instant(const char* category, const char* name, const std::string& pv) {
+    if (enabled()) {
+        record('i', category, name, pv, 0);
+    }
+}
+
+uint64_t Tracer::async_begin(const char* category, const char* name, const std::string& pv) {
+    if (!enabled()) {
+        return 0;
+    }
+    uint64_t id = next_async_id.fetch_add(1, std::memory_order_relaxed);
+    record('b', category, name, pv, id);
+    return id;
+}
+
+void Tracer::async_end(const char* category, const char* name, uint64_t id) {
+    record('e', category, name, std::string(), id);
+}
+
+std::string Tracer::to_json() {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> guard(reg.lock);
+        buffers = reg.buffers;
+    }
+
+    std::ostringstream out;
+    uint64_t dropped = 0;
+    bool first = true;
+    auto separator = [&out, &first]() {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    out << "{\"traceEvents\":[";
+    for (auto& buffer : buffers) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"";
+        append_escaped(out, buffer->thread_name);
+        out << "\"}}";
+
+        size_t size = buffer->size.load(std::memory_order_acquire);
+        for (size_t i = 0; i < size; i++) {
+            const auto& event = buffer->events[i];
+            char ts[32];
+            std::snprintf(ts, sizeof(ts), "%llu.%03u", static_cast<unsigned long long>(event.ts_ns / 1000),
+                          static_cast<unsigned>(event.ts_ns % 1000));
+
+            separator();
+            out << "{\"name\":\"";
+            append_escaped(out, event.name);
+            out << "\",\"cat\":\"" << event.category << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << ts
+                << ",\"pid\":1,\"tid\":" << buffer->tid;
+            if (event.phase == 'b' || event.phase == 'e') {
+                out << ",\"id\":\"0x" << std::hex << event.id << std::dec << "\"";
+            }
+            if (event.phase == 'i') {
+                out << ",\"s\":\"t\"";
+            }
+            if (event.pv[0]) {
+                out << ",\"args\":{\"pv\":\"";
+                append_escaped(out, event.pv);
+                out << "\"}";
+            }
+            out << "}";
+        }
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":" << dropped << "}}\n";
+    return out.str();
+}
+
+uint64_t Tracer::dropped() {
+    auto& reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    uint64_t total = 0;
+    for (auto& buffer : reg.buffers) {
+        total += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+// ============================================================================
+// Tracer functions for Rust FFI
+// ============================================================================
+
+void trace_enable(uint64_t events_per_thread) {
+    Tracer::enable(static_cast<size_t>(events_per_thread));
+}
+
+void trace_disable() {
+    Tracer::disable();
+}
+
+bool trace_is_enabled() {
+    return Tracer::enabled();
+}
+
+void trace_clear() {
+    Tracer::clear();
+}
+
+uint64_t trace_dropped() {
+    return Tracer::dropped();
+}
+
+rust::String trace_to_json() {
+    return rust::String(Tracer::to_json());
+}
+
+void trace_begin(rust::Str name) {
+    if (Tracer::enabled()) {
+        Tracer::begin("user", std::string(name).c_str(), std::string());
+    }
+}
+
+void trace_end(rust::Str name) {
+    Tracer::end("user", std::string(name).c_str());
+}
+
+void trace_instant(rust::Str name) {
+    if (Tracer::enabled()) {
+        Tracer::instant("user", std::string(name).c_str(), std::string());
+    }
+}
+
+} // namespace pvxs_wrapper
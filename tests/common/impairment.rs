@@ -0,0 +1,512 @@
+//! Loopback network impairment proxy for tests and benchmarks
+//!
+//! Sits between a client context and an isolated server, forwarding the
+//! PVAccess UDP search traffic and the TCP connections while adding delay,
+//! jitter, a bandwidth cap, UDP loss and on-demand connection drops.
+//!
+//! Search requests are rewritten so the server answers the proxy, and
+//! search responses are rewritten to point at the proxy's TCP port, so the
+//! client never learns the server's real address.
+#![allow(dead_code)]
+
+use std::collections::{HashMap, VecDeque};
+use std::io::{self, Read, Write};
+use std::net::{Ipv4Addr, Shutdown, SocketAddr, SocketAddrV4, TcpListener, TcpStream, UdpSocket};
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::{Arc, Condvar, Mutex};
+use std::thread;
+use std::time::{Duration, Instant};
+
+const CMD_SEARCH: u8 = 3;
+const CMD_SEARCH_RESPONSE: u8 = 4;
+const FLAG_BIG_ENDIAN: u8 = 0x80;
+const HEADER_SIZE: usize = 8;
+const POLL_INTERVAL: Duration = Duration::from_millis(20);
+
+/// Impairments applied to each direction of traffic
+#[derive(Clone, Debug, Default)]
+pub struct Impairment {
+    delay: Duration,
+    jitter: Duration,
+    bytes_per_second: u64,
+    udp_loss: f64,
+    seed: u64,
+}
+
+impl Impairment {
+    /// No impairment at all
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Impairment matching a round trip time, split evenly between directions
+    pub fn rtt(rtt: Duration) -> Self {
+        Self::new().delay(rtt / 2)
+    }
+
+    /// Set the one-way delay added to every packet
+    pub fn delay(mut self, delay: Duration) -> Self {
+        self.delay = delay;
+        self
+    }
+
+    /// Set the maximum random variation added on top of the delay
+    ///
+    /// Data on one TCP connection is never reordered by jitter.
+    pub fn jitter(mut self, jitter: Duration) -> Self {
+        self.jitter = jitter;
+        self
+    }
+
+    /// Cap the throughput of each direction of each connection (0 = unlimited)
+    pub fn bandwidth(mut self, bytes_per_second: u64) -> Self {
+        self.bytes_per_second = bytes_per_second;
+        self
+    }
+
+    /// Set the probability (0.0 to 1.0) that a UDP datagram is dropped
+    pub fn udp_loss(mut self, probability: f64) -> Self {
+        self.udp_loss = probability.clamp(0.0, 1.0);
+        self
+    }
+
+    /// Seed the random source used for jitter and loss
+    pub fn seed(mut self, seed: u64) -> Self {
+        self.seed = seed;
+        self
+    }
+}
+
+/// Counters of the traffic seen by a proxy
+#[derive(Clone, Debug, Default, PartialEq)]
+pub struct ProxyStats {
+    pub connections: u64,
+    pub dropped_connections: u64,
+    pub tcp_bytes: u64,
+    pub udp_datagrams: u64,
+    pub udp_lost: u64,
+}
+
+#[derive(Default)]
+struct Counters {
+    connections: AtomicU64,
+    dropped_connections: AtomicU64,
+    tcp_bytes: AtomicU64,
+    udp_datagrams: AtomicU64,
+    udp_lost: AtomicU64,
+}
+
+/// xorshift64*, plenty for jitter and loss decisions
+struct Random(u64);
+
+impl Random {
+    fn new(seed: u64) -> Self {
+        Self(seed.max(1))
+    }
+
+    fn next_f64(&mut self) -> f64 {
+        self.0 ^= self.0 >> 12;
+        self.0 ^= self.0 << 25;
+        self.0 ^= self.0 >> 27;
+        (self.0.wrapping_mul(0x2545_f491_4f6c_dd1d) >> 11) as f64 / (1u64 << 53) as f64
+    }
+}
+
+/// Schedules items for delivery once their due time has passed
+///
+/// Due times never go backwards, so delivery order matches submit order.
+struct DelayLine<T> {
+    queue: Mutex<(VecDeque<(Instant, T)>, bool)>,
+    wake: Condvar,
+    impairment: Impairment,
+    state: Mutex<(Instant, Random)>,
+}
+
+impl<T: Send + 'static> DelayLine<T> {
+    fn start(impairment: Impairment, seed: u64, mut sink: impl FnMut(T) -> bool + Send + 'static) -> Arc<Self> {
+        let line = Arc::new(Self {
+            queue: Mutex::new((VecDeque::new(), false)),
+            wake: Condvar::new(),
+            state: Mutex::new((Instant::now(), Random::new(impairment.seed ^ seed))),
+            impairment,
+        });
+        let worker = line.clone();
+        thread::spawn(move || {
+            while let Some(item) = worker.next() {
+                if !sink(item) {
+                    worker.close();
+                }
+            }
+        });
+        line
+    }
+
+    fn submit(&self, item: T, size: usize) {
+        let now = Instant::now();
+        let due = {
+            let mut state = self.state.lock().unwrap();
+            let (last_due, random) = &mut *state;
+            let mut due = now + self.impairment.delay;
+            if !self.impairment.jitter.is_zero() {
+                due += self.impairment.jitter.mul_f64(random.next_f64());
+            }
+            if self.impairment.bytes_per_second > 0 {
+                // The link is busy until the previous item has gone out
+                let start = (*last_due).max(now);
+                let transmit = Duration::from_secs_f64(size as f64 / self.impairment.bytes_per_second as f64);
+                due = due.max(start + transmit);
+            }
+            due = due.max(*last_due);
+            *last_due = due;
+            due
+        };
+        let mut queue = self.queue.lock().unwrap();
+        if !queue.1 {
+            queue.0.push_back((due, item));
+            self.wake.notify_one();
+        }
+    }
+
+    fn next(&self) -> Option<T> {
+        let mut queue = self.queue.lock().unwrap();
+        loop {
+            if queue.1 {
+                return None;
+            }
+            match queue.0.front() {
+                Some((due, _)) => {
+                    let now = Instant::now();
+                    if *due <= now {
+                        return queue.0.pop_front().map(|(_, item)| item);
+                    }
+                    let wait = *due - now;
+                    queue = self.wake.wait_timeout(queue, wait).unwrap().0;
+                }
+                None => queue = self.wake.wait(queue).unwrap(),
+            }
+        }
+    }
+
+    fn close(&self) {
+        let mut queue = self.queue.lock().unwrap();
+        queue.1 = true;
+        queue.0.clear();
+        self.wake.notify_all();
+    }
+}
+
+struct Shared {
+    impairment: Impairment,
+    upstream_tcp: SocketAddr,
+    upstream_udp: SocketAddr,
+    stop: AtomicBool,
+    counters: Counters,
+    connections: Mutex<HashMap<u64, (TcpStream, TcpStream)>>,
+}
+
+/// Loopback TCP/UDP proxy in front of a PVAccess server
+///
+/// Point a client at [`ImpairmentProxy::udp_port`] with
+/// [`ImpairmentProxy::client_env`] and all of its traffic to the server
+/// flows through the proxy. Everything stops when the proxy is dropped.
+pub struct ImpairmentProxy {
+    shared: Arc<Shared>,
+    tcp_port: u16,
+    udp_port: u16,
+}
+
+impl ImpairmentProxy {
+    /// Start a proxy in front of a server listening on the given loopback ports
+    pub fn start(server_tcp_port: u16, server_udp_port: u16, impairment: Impairment) -> io::Result<Self> {
+        let loopback = |port| SocketAddr::V4(SocketAddrV4::new(Ipv4Addr::LOCALHOST, port));
+        let shared = Arc::new(Shared {
+            impairment,
+            upstream_tcp: loopback(server_tcp_port),
+            upstream_udp: loopback(server_udp_port),
+            stop: AtomicBool::new(false),
+            counters: Counters::default(),
+            connections: Mutex::new(HashMap::new()),
+        });
+
+        let listener = TcpListener::bind(loopback(0))?;
+        listener.set_nonblocking(true)?;
+        let tcp_port = listener.local_addr()?.port();
+
+        let client_side = UdpSocket::bind(loopback(0))?;
+        let server_side = UdpSocket::bind(loopback(0))?;
+        client_side.set_read_timeout(Some(POLL_INTERVAL))?;
+        server_side.set_read_timeout(Some(POLL_INTERVAL))?;
+        let udp_port = client_side.local_addr()?.port();
+
+        let accept_shared = shared.clone();
+        thread::spawn(move || accept_loop(accept_shared, listener));
+        spawn_udp(shared.clone(), client_side, server_side, tcp_port)?;
+
+        Ok(Self { shared, tcp_port, udp_port })
+    }
+
+    /// TCP port clients connect to (advertised in rewritten search responses)
+    pub fn tcp_port(&self) -> u16 {
+        self.tcp_port
+    }
+
+    /// UDP port clients send searches to
+    pub fn udp_port(&self) -> u16 {
+        self.udp_port
+    }
+
+    /// Environment for a client context which only searches through this proxy
+    pub fn client_env(&self) -> Vec<(&'static str, String)> {
+        vec![
+            ("EPICS_PVA_ADDR_LIST", format!("127.0.0.1:{}", self.udp_port)),
+            ("EPICS_PVA_AUTO_ADDR_LIST", "NO".to_string()),
+            ("EPICS_PVA_NAME_SERVERS", String::new()),
+        ]
+    }
+
+    /// Set [`ImpairmentProxy::client_env`] in the process environment
+    ///
+    /// Call before creating the client context.
+    pub fn apply_client_env(&self) {
+        for (key, value) in self.client_env() {
+            std::env::set_var(key, value);
+        }
+    }
+
+    /// Abruptly close every open connection, as a network outage would
+    pub fn drop_connections(&self) {
+        let mut connections = self.shared.connections.lock().unwrap();
+        for (_, (client, server)) in connections.drain() {
+            let _ = client.shutdown(Shutdown::Both);
+            let _ = server.shutdown(Shutdown::Both);
+            self.shared.counters.dropped_connections.fetch_add(1, Ordering::Relaxed);
+        }
+    }
+
+    /// Number of connections currently open through the proxy
+    pub fn open_connections(&self) -> usize {
+        self.shared.connections.lock().unwrap().len()
+    }
+
+    /// Snapshot of the traffic counters
+    pub fn stats(&self) -> ProxyStats {
+        let c = &self.shared.counters;
+        ProxyStats {
+            connections: c.connections.load(Ordering::Relaxed),
+            dropped_connections: c.dropped_connections.load(Ordering::Relaxed),
+            tcp_bytes: c.tcp_bytes.load(Ordering::Relaxed),
+            udp_datagrams: c.udp_datagrams.load(Ordering::Relaxed),
+            udp_lost: c.udp_lost.load(Ordering::Relaxed),
+        }
+    }
+}
+
+impl Drop for ImpairmentProxy {
+    fn drop(&mut self) {
+        self.shared.stop.store(true, Ordering::Relaxed);
+        let mut connections = self.shared.connections.lock().unwrap();
+        for (_, (client, server)) in connections.drain() {
+            let _ = client.shutdown(Shutdown::Both);
+            let _ = server.shutdown(Shutdown::Both);
+        }
+    }
+}
+
+fn accept_loop(shared: Arc<Shared>, listener: TcpListener) {
+    let mut next_id = 0u64;
+    while !shared.stop.load(Ordering::Relaxed) {
+        match listener.accept() {
+            Ok((client, _)) => {
+                next_id += 1;
+                if let Err(e) = open_connection(&shared, client, next_id) {
+                    eprintln!("impairment proxy: upstream connect failed: {}", e);
+                }
+            }
+            Err(e) if e.kind() == io::ErrorKind::WouldBlock => thread::sleep(POLL_INTERVAL),
+            Err(_) => thread::sleep(POLL_INTERVAL),
+        }
+    }
+}
+
+fn open_connection(shared: &Arc<Shared>, client: TcpStream, id: u64) -> io::Result<()> {
+    client.set_nonblocking(false)?;
+    let server = TcpStream::connect(shared.upstream_tcp)?;
+    client.set_nodelay(true)?;
+    server.set_nodelay(true)?;
+    shared.counters.connections.fetch_add(1, Ordering::Relaxed);
+    shared.connections.lock().unwrap().insert(id, (client.try_clone()?, server.try_clone()?));
+
+    pump(shared.clone(), client.try_clone()?, server.try_clone()?, id, id * 2);
+    pump(shared.clone(), server, client, id, id * 2 + 1);
+    Ok(())
+}
+
+/// Copy one direction of a connection through a delay line
+fn pump(shared: Arc<Shared>, mut from: TcpStream, to: TcpStream, id: u64, seed: u64) {
+    let mut writer = to.try_clone().expect("clone proxied stream");
+    let line = DelayLine::start(shared.impairment.clone(), seed, move |chunk: Vec<u8>| {
+        if writer.write_all(&chunk).is_err() {
+            let _ = writer.shutdown(Shutdown::Both);
+            return false;
+        }
+        true
+    });
+    thread::spawn(move || {
+        let mut buf = vec![0u8; 64 * 1024];
+        loop {
+            match from.read(&mut buf) {
+                Ok(0) | Err(_) => break,
+                Ok(n) => {
+                    shared.counters.tcp_bytes.fetch_add(n as u64, Ordering::Relaxed);
+                    line.submit(buf[..n].to_vec(), n);
+                }
+            }
+        }
+        // Let data already in flight arrive before closing the other side
+        let flush = shared.impairment.delay + shared.impairment.jitter;
+        thread::sleep(flush + POLL_INTERVAL);
+        line.close();
+        let _ = to.shutdown(Shutdown::Write);
+        let _ = from.shutdown(Shutdown::Both);
+        shared.connections.lock().unwrap().remove(&id);
+    });
+}
+
+fn spawn_udp(shared: Arc<Shared>, client_side: UdpSocket, server_side: UdpSocket, tcp_port: u16) -> io::Result<()> {
+    let server_side_port = server_side.local_addr()?.port();
+    // Where to deliver responses, by search sequence ID
+    let reply_to: Arc<Mutex<HashMap<u32, SocketAddr>>> = Arc::new(Mutex::new(HashMap::new()));
+
+    let upstream = server_side.try_clone()?;
+    let to_server = DelayLine::start(shared.impairment.clone(), 0x5eed, move |(data, dest): (Vec<u8>, SocketAddr)| {
+        let _ = upstream.send_to(&data, dest);
+        true
+    });
+    let downstream = client_side.try_clone()?;
+    let to_client = DelayLine::start(shared.impairment.clone(), 0xfeed, move |(data, dest): (Vec<u8>, SocketAddr)| {
+        let _ = downstream.send_to(&data, dest);
+        true
+    });
+
+    // Client -> server
+    let requests_shared = shared.clone();
+    let requests_reply_to = reply_to.clone();
+    thread::spawn(move || {
+        let mut random = Random::new(requests_shared.impairment.seed ^ 0x1234);
+        let mut buf = vec![0u8; 65536];
+        while !requests_shared.stop.load(Ordering::Relaxed) {
+            let (n, src) = match client_side.recv_from(&mut buf) {
+                Ok(received) => received,
+                Err(_) => continue,
+            };
+            requests_shared.counters.udp_datagrams.fetch_add(1, Ordering::Relaxed);
+            if random.next_f64() < requests_shared.impairment.udp_loss {
+                requests_shared.counters.udp_lost.fetch_add(1, Ordering::Relaxed);
+                continue;
+            }
+            let mut data = buf[..n].to_vec();
+            for_each_message(&mut data, |command, big_endian, payload| {
+                if command == CMD_SEARCH && payload.len() >= 26 {
+                    let sequence = read_u32(&payload[0..4], big_endian);
+                    let port = read_u16(&payload[24..26], big_endian);
+                    let client = match ipv4_mapped(&payload[8..24]) {
+                        Some(ip) if !ip.is_unspecified() => SocketAddr::V4(SocketAddrV4::new(ip, port)),
+                        _ => SocketAddr::new(src.ip(), if port != 0 { port } else { src.port() }),
+                    };
+                    let mut map = requests_reply_to.lock().unwrap();
+                    if map.len() > 4096 {
+                        map.clear();
+                    }
+                    map.insert(sequence, client);
+                    // Have the server answer the proxy instead of the client
+                    payload[8..24].copy_from_slice(&ipv4_mapped_bytes(Ipv4Addr::LOCALHOST));
+                    write_u16(&mut payload[24..26], server_side_port, big_endian);
+                }
+            });
+            to_server.submit((data, requests_shared.upstream_udp), n);
+        }
+        to_server.close();
+    });
+
+    // Server -> client
+    thread::spawn(move || {
+        let mut random = Random::new(shared.impairment.seed ^ 0x4321);
+        let mut buf = vec![0u8; 65536];
+        while !shared.stop.load(Ordering::Relaxed) {
+            let n = match server_side.recv_from(&mut buf) {
+                Ok((n, _)) => n,
+                Err(_) => continue,
+            };
+            shared.counters.udp_datagrams.fetch_add(1, Ordering::Relaxed);
+            if random.next_f64() < shared.impairment.udp_loss {
+                shared.counters.udp_lost.fetch_add(1, Ordering::Relaxed);
+                continue;
+            }
+            let mut data = buf[..n].to_vec();
+            let mut dest = None;
+            for_each_message(&mut data, |command, big_endian, payload| {
+                if command == CMD_SEARCH_RESPONSE && payload.len() >= 34 {
+                    let sequence = read_u32(&payload[12..16], big_endian);
+                    dest = reply_to.lock().unwrap().get(&sequence).copied();
+                    // Advertise the proxy instead of the server
+                    payload[16..32].copy_from_slice(&ipv4_mapped_bytes(Ipv4Addr::LOCALHOST));
+                    write_u16(&mut payload[32..34], tcp_port, big_endian);
+                }
+            });
+            if let Some(dest) = dest {
+                to_client.submit((data, dest), n);
+            }
+        }
+        to_client.close();
+    });
+    Ok(())
+}
+
+/// Visit each PVAccess message in a datagram with its command, byte order and payload
+fn for_each_message(data: &mut [u8], mut visit: impl FnMut(u8, bool, &mut [u8])) {
+    let mut offset = 0;
+    while offset + HEADER_SIZE <= data.len() {
+        if data[offset] != 0xca {
+            return;
+        }
+        let flags = data[offset + 2];
+        let command = data[offset + 3];
+        let big_endian = flags & FLAG_BIG_ENDIAN != 0;
+        let size = read_u32(&data[offset + 4..offset + 8], big_endian) as usize;
+        let start = offset + HEADER_SIZE;
+        let end = (start + size).min(data.len());
+        visit(command, big_endian, &mut data[start..end]);
+        offset = start + size;
+    }
+}
+
+fn read_u16(bytes: &[u8], big_endian: bool) -> u16 {
+    let raw = [bytes[0], bytes[1]];
+    if big_endian { u16::from_be_bytes(raw) } else { u16::from_le_bytes(raw) }
+}
+
+fn write_u16(bytes: &mut [u8], value: u16, big_endian: bool) {
+    let raw = if big_endian { value.to_be_bytes() } else { value.to_le_bytes() };
+    bytes.copy_from_slice(&raw);
+}
+
+fn read_u32(bytes: &[u8], big_endian: bool) -> u32 {
+    let raw = [bytes[0], bytes[1], bytes[2], bytes[3]];
+    if big_endian { u32::from_be_bytes(raw) } else { u32::from_le_bytes(raw) }
+}
+
+fn ipv4_mapped(bytes: &[u8]) -> Option<Ipv4Addr> {
+    if bytes[..10].iter().all(|b| *b == 0) && (bytes[10..12] == [0xff, 0xff] || bytes[10..12] == [0, 0]) {
+        Some(Ipv4Addr::new(bytes[12], bytes[13], bytes[14], bytes[15]))
+    } else {
+        None
+    }
+}
+
+fn ipv4_mapped_bytes(ip: Ipv4Addr) -> [u8; 16] {
+    let mut bytes = [0u8; 16];
+    bytes[10] = 0xff;
+    bytes[11] = 0xff;
+    bytes[12..].copy_from_slice(&ip.octets());
+    bytes
+}
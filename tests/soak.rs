@@ -0,0 +1,353 @@
+//! Long-running soak test for leaks and latency drift
+//!
+//! Cycles subscriptions, forced reconnects, PUT/GET round trips and server
+//! posts against an isolated server, sampling process memory, allocator
+//! statistics, PVXS instance counts and latency percentiles as it goes.
+//! Fails when steady-state memory, live PVXS objects or p99 latency keep
+//! growing.
+//!
+//! Opt-in: a plain `cargo test` skips it unless `PVXS_SOAK_SECS` is set.
+//! For a short smoke run or a real soak:
+//!
+//! ```bash
+//! PVXS_SOAK_SECS=20 cargo test --test soak
+//! PVXS_SOAK_SECS=14400 PVXS_SOAK_PVS=200 PVXS_SOAK_POST_RATE=100 cargo test --release --test soak
+//! ```
+//!
+//! | Variable | Default | Meaning |
+//! |----------|---------|---------|
+//! | `PVXS_SOAK_SECS` | unset (skip) | Total run time |
+//! | `PVXS_SOAK_PVS` | 16 | Number of served PVs |
+//! | `PVXS_SOAK_POST_RATE` | 20 | Posts per second to each PV |
+//! | `PVXS_SOAK_SAMPLE_SECS` | run time / 20 | Time between samples |
+//! | `PVXS_SOAK_CYCLE_SECS` | 2 | Lifetime of each set of subscriptions |
+//! | `PVXS_SOAK_RECONNECT_SECS` | 5 | Time between forced connection drops |
+//! | `PVXS_SOAK_WARMUP` | 0.25 | Fraction of samples ignored as warm-up |
+//! | `PVXS_SOAK_MAX_MEMORY_GROWTH` | 0.10 | Allowed steady-state memory growth (fraction) |
+//! | `PVXS_SOAK_MAX_P99_GROWTH` | 3.0 | Allowed p99 latency growth (ratio) |
+
+#[path = "common/impairment.rs"]
+mod impairment;
+
+use impairment::{Impairment, ImpairmentProxy};
+use pvxs_sys::{Context, Diagnostics, NTScalarMetadataBuilder, PvxsError, Server};
+use std::collections::BTreeMap;
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+use std::thread;
+use std::time::{Duration, Instant};
+
+const TIMEOUT: f64 = 5.0;
+// Growth below these is noise, whatever the ratio
+const MEMORY_FLOOR: f64 = 8.0 * 1024.0 * 1024.0;
+const P99_FLOOR_MS: f64 = 5.0;
+const INSTANCE_FLOOR: f64 = 100.0;
+
+struct Settings {
+    duration: Duration,
+    pvs: usize,
+    post_rate: f64,
+    sample_interval: Duration,
+    cycle: Duration,
+    reconnect: Duration,
+    warmup: f64,
+    max_memory_growth: f64,
+    max_p99_growth: f64,
+}
+
+fn env_f64(name: &str, default: f64) -> f64 {
+    match std::env::var(name) {
+        Ok(value) => value.parse().unwrap_or_else(|_| panic!("{} must be a number, got '{}'", name, value)),
+        Err(_) => default,
+    }
+}
+
+impl Settings {
+    // None unless PVXS_SOAK_SECS asks for a run
+    fn from_env() -> Option<Self> {
+        std::env::var_os("PVXS_SOAK_SECS")?;
+        let duration = Duration::from_secs_f64(env_f64("PVXS_SOAK_SECS", 0.0));
+        Some(Self {
+            duration,
+            pvs: env_f64("PVXS_SOAK_PVS", 16.0).max(1.0) as usize,
+            post_rate: env_f64("PVXS_SOAK_POST_RATE", 20.0).max(0.1),
+            sample_interval: Duration::from_secs_f64(env_f64("PVXS_SOAK_SAMPLE_SECS", (duration.as_secs_f64() / 20.0).max(1.0))),
+            cycle: Duration::from_secs_f64(env_f64("PVXS_SOAK_CYCLE_SECS", 2.0)),
+            reconnect: Duration::from_secs_f64(env_f64("PVXS_SOAK_RECONNECT_SECS", 5.0)),
+            warmup: env_f64("PVXS_SOAK_WARMUP", 0.25).clamp(0.0, 0.9),
+            max_memory_growth: env_f64("PVXS_SOAK_MAX_MEMORY_GROWTH", 0.10),
+            max_p99_growth: env_f64("PVXS_SOAK_MAX_P99_GROWTH", 3.0),
+        })
+    }
+}
+
+#[derive(Default)]
+struct Activity {
+    latencies_ms: Mutex<Vec<f64>>,
+    operations: AtomicU64,
+    errors: AtomicU64,
+    updates: AtomicU64,
+    subscription_cycles: AtomicU64,
+}
+
+struct Sample {
+    at: f64,
+    rss: f64,
+    heap: f64,
+    p50: f64,
+    p99: f64,
+    instances: BTreeMap<String, u64>,
+}
+
+fn percentile(sorted: &[f64], fraction: f64) -> f64 {
+    if sorted.is_empty() {
+        return 0.0;
+    }
+    let index = ((sorted.len() - 1) as f64 * fraction).round() as usize;
+    sorted[index]
+}
+
+/// Growth across the steady-state window from a least-squares fit
+fn fitted_growth(points: &[(f64, f64)]) -> f64 {
+    let n = points.len() as f64;
+    if points.len() < 2 {
+        return 0.0;
+    }
+    let mean_x = points.iter().map(|p| p.0).sum::<f64>() / n;
+    let mean_y = points.iter().map(|p| p.1).sum::<f64>() / n;
+    let covariance: f64 = points.iter().map(|p| (p.0 - mean_x) * (p.1 - mean_y)).sum();
+    let variance: f64 = points.iter().map(|p| (p.0 - mean_x).powi(2)).sum();
+    if variance == 0.0 {
+        return 0.0;
+    }
+    covariance / variance * (points[points.len() - 1].0 - points[0].0)
+}
+
+fn median(mut values: Vec<f64>) -> f64 {
+    values.sort_by(|a, b| a.partial_cmp(b).unwrap());
+    percentile(&values, 0.5)
+}
+
+/// PUT/GET round trips on one channel, recording each latency
+fn run_operations(stop: Arc<AtomicBool>, activity: Arc<Activity>, pvs: usize) -> Result<(), PvxsError> {
+    let mut ctx = Context::from_env()?;
+    let mut i = 0usize;
+    while !stop.load(Ordering::Relaxed) {
+        let name = format!("soak:pv:{}", i % pvs);
+        let start = Instant::now();
+        let result = ctx.put_double(&name, i as f64, TIMEOUT).and_then(|_| ctx.get(&name, TIMEOUT));
+        let elapsed = start.elapsed().as_secs_f64() * 1000.0;
+        match result {
+            Ok(_) => {
+                activity.latencies_ms.lock().unwrap().push(elapsed);
+                activity.operations.fetch_add(1, Ordering::Relaxed);
+            }
+            // Operations caught by a forced disconnect fail; that is expected
+            Err(_) => {
+                activity.errors.fetch_add(1, Ordering::Relaxed);
+            }
+        }
+        i += 1;
+    }
+    Ok(())
+}
+
+/// Subscribe to every PV, drain updates for a while, tear everything down and repeat
+fn run_subscriptions(stop: Arc<AtomicBool>, activity: Arc<Activity>, pvs: usize, cycle: Duration) -> Result<(), PvxsError> {
+    let mut ctx = Context::from_env()?;
+    while !stop.load(Ordering::Relaxed) {
+        // Every few cycles use a fresh context as well
+        if activity.subscription_cycles.load(Ordering::Relaxed) % 5 == 4 {
+            ctx = Context::from_env()?;
+        }
+        let mut monitors = Vec::with_capacity(pvs);
+        for i in 0..pvs {
+            let mut monitor = ctx.monitor_builder(&format!("soak:pv:{}", i))?.exec()?;
+            monitor.start()?;
+            monitors.push(monitor);
+        }
+        let until = Instant::now() + cycle;
+        while Instant::now() < until && !stop.load(Ordering::Relaxed) {
+            for monitor in monitors.iter_mut() {
+                while let Ok(Some(_)) = monitor.pop() {
+                    activity.updates.fetch_add(1, Ordering::Relaxed);
+                }
+            }
+            thread::sleep(Duration::from_millis(10));
+        }
+        for monitor in monitors.iter_mut() {
+            monitor.stop()?;
+        }
+        drop(monitors);
+        activity.subscription_cycles.fetch_add(1, Ordering::Relaxed);
+    }
+    Ok(())
+}
+
+fn take_sample(at: f64, activity: &Activity) -> Result<Sample, PvxsError> {
+    let mut latencies = std::mem::take(&mut *activity.latencies_ms.lock().unwrap());
+    latencies.sort_by(|a, b| a.partial_cmp(b).unwrap());
+    Ok(Sample {
+        at,
+        rss: Diagnostics::resident_memory().unwrap_or(0) as f64,
+        heap: Diagnostics::allocator_stats().map(|s| s.in_use).unwrap_or(0) as f64,
+        p50: percentile(&latencies, 0.50),
+        p99: percentile(&latencies, 0.99),
+        instances: Diagnostics::instance_counts()?,
+    })
+}
+
+fn check_drift(settings: &Settings, samples: &[Sample]) -> Vec<String> {
+    let mut failures = Vec::new();
+    let steady = &samples[(samples.len() as f64 * settings.warmup) as usize..];
+    if steady.len() < 3 {
+        failures.push(format!("Only {} steady-state samples, run longer or sample more often", steady.len()));
+        return failures;
+    }
+
+    for (label, value) in [("RSS", (|s: &Sample| s.rss) as fn(&Sample) -> f64), ("heap", |s: &Sample| s.heap)] {
+        let points: Vec<(f64, f64)> = steady.iter().map(|s| (s.at, value(s))).collect();
+        if points.iter().all(|p| p.1 == 0.0) {
+            println!("{} not available on this platform", label);
+            continue;
+        }
+        let growth = fitted_growth(&points);
+        let mean = points.iter().map(|p| p.1).sum::<f64>() / points.len() as f64;
+        if growth > MEMORY_FLOOR && growth > mean * settings.max_memory_growth {
+            failures.push(format!(
+                "{} grew by {:.1} MiB over the steady state (mean {:.1} MiB)",
+                label,
+                growth / 1048576.0,
+                mean / 1048576.0
+            ));
+        }
+    }
+
+    // Compare thirds of the steady state; the minimum ignores short-lived objects
+    let third = (steady.len() / 3).max(1);
+    let (first, last) = (&steady[..third], &steady[steady.len() - third..]);
+    let first_p99 = median(first.iter().map(|s| s.p99).collect());
+    let last_p99 = median(last.iter().map(|s| s.p99).collect());
+    if last_p99 > P99_FLOOR_MS && last_p99 > first_p99 * settings.max_p99_growth {
+        failures.push(format!("p99 latency grew from {:.2} ms to {:.2} ms", first_p99, last_p99));
+    }
+
+    for name in steady[0].instances.keys() {
+        let low = |window: &[Sample]| window.iter().map(|s| *s.instances.get(name).unwrap_or(&0) as f64).fold(f64::MAX, f64::min);
+        let (before, after) = (low(first), low(last));
+        if after - before > INSTANCE_FLOOR && after > before * 1.5 {
+            failures.push(format!("Live {} instances grew from {} to {}", name, before, after));
+        }
+    }
+    failures
+}
+
+fn main() -> Result<(), PvxsError> {
+    let Some(settings) = Settings::from_env() else {
+        println!("Soak: skipped, set PVXS_SOAK_SECS to run it");
+        return Ok(());
+    };
+    println!(
+        "Soak: {:?}, {} PVs, {} posts/s each, sampling every {:?}",
+        settings.duration, settings.pvs, settings.post_rate, settings.sample_interval
+    );
+
+    let mut server = Server::create_isolated()?;
+    let mut pvs = Vec::with_capacity(settings.pvs);
+    for i in 0..settings.pvs {
+        pvs.push(server.create_pv_double(&format!("soak:pv:{}", i), 0.0, NTScalarMetadataBuilder::new())?);
+    }
+    server.start()?;
+
+    // Clients go through the proxy so reconnects can be forced
+    let proxy = ImpairmentProxy::start(server.tcp_port(), server.udp_port(), Impairment::new())
+        .map_err(|e| PvxsError::new(format!("Failed to start proxy: {}", e)))?;
+    proxy.apply_client_env();
+
+    let stop = Arc::new(AtomicBool::new(false));
+    let activity = Arc::new(Activity::default());
+    let workers = vec![
+        {
+            let (stop, activity, count) = (stop.clone(), activity.clone(), settings.pvs);
+            thread::spawn(move || run_operations(stop, activity, count))
+        },
+        {
+            let (stop, activity, count, cycle) = (stop.clone(), activity.clone(), settings.pvs, settings.cycle);
+            thread::spawn(move || run_subscriptions(stop, activity, count, cycle))
+        },
+    ];
+
+    println!(
+        "{:>8} {:>10} {:>10} {:>9} {:>9} {:>8} {:>7} {:>9}",
+        "time s", "RSS MiB", "heap MiB", "p50 ms", "p99 ms", "ops", "errors", "updates"
+    );
+    let start = Instant::now();
+    let post_interval = Duration::from_secs_f64(1.0 / settings.post_rate);
+    let mut next_post = start;
+    let mut next_sample = start + settings.sample_interval;
+    let mut next_reconnect = start + settings.reconnect;
+    let mut counter = 0.0;
+    let mut samples = Vec::new();
+    while start.elapsed() < settings.duration {
+        let now = Instant::now();
+        if now >= next_post {
+            counter += 1.0;
+            for pv in pvs.iter_mut() {
+                pv.post_double(counter)?;
+            }
+            next_post += post_interval;
+        }
+        if now >= next_reconnect {
+            proxy.drop_connections();
+            next_reconnect += settings.reconnect;
+        }
+        if now >= next_sample {
+            let sample = take_sample(start.elapsed().as_secs_f64(), &activity)?;
+            let live: u64 = sample.instances.values().sum();
+            println!(
+                "{:>8.0} {:>10.1} {:>10.1} {:>9.2} {:>9.2} {:>8} {:>7} {:>9}  ({} live pvxs objects)",
+                sample.at,
+                sample.rss / 1048576.0,
+                sample.heap / 1048576.0,
+                sample.p50,
+                sample.p99,
+                activity.operations.load(Ordering::Relaxed),
+                activity.errors.load(Ordering::Relaxed),
+                activity.updates.load(Ordering::Relaxed),
+                live
+            );
+            samples.push(sample);
+            next_sample += settings.sample_interval;
+        }
+        let wake = next_post.min(next_sample).min(next_reconnect);
+        thread::sleep(wake.saturating_duration_since(Instant::now()).min(Duration::from_millis(50)));
+    }
+
+    stop.store(true, Ordering::Relaxed);
+    for worker in workers {
+        worker.join().expect("soak worker panicked")?;
+    }
+    server.stop()?;
+
+    let mut failures = check_drift(&settings, &samples);
+    if activity.operations.load(Ordering::Relaxed) == 0 {
+        failures.push("No PUT/GET round trip succeeded".to_string());
+    }
+    if activity.updates.load(Ordering::Relaxed) == 0 {
+        failures.push("No monitor update was received".to_string());
+    }
+    if let Some(last) = samples.last() {
+        for (name, count) in last.instances.iter().filter(|(_, count)| **count > 0) {
+            println!("  {:<24} {}", name, count);
+        }
+    }
+    if failures.is_empty() {
+        println!("Soak passed");
+        Ok(())
+    } else {
+        for failure in &failures {
+            eprintln!("FAIL: {}", failure);
+        }
+        std::process::exit(1);
+    }
+}
@@ -0,0 +1,135 @@
+mod test_pvxs_admission_control {
+    use pvxs_sys::{Server, Context, AdmissionConfig, NTScalarMetadataBuilder};
+
+    #[test]
+    fn test_admission_control_requires_a_limit() {
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        assert!(ctx.enable_admission_control(AdmissionConfig::new()).is_err());
+        assert_eq!(ctx.admission_stats().admitted, 0);
+    }
+
+    #[test]
+    fn test_admission_control_counts_sync_operations() {
+        let timeout = 5.0;
+        let name = "admission:double";
+        let mut srv = Server::from_env().expect("Failed to create server from env");
+        srv.create_pv_double(name, 2.5, NTScalarMetadataBuilder::new())
+            .expect("Failed to create pv on server");
+        srv.start().expect("Failed to start server");
+
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_admission_control(AdmissionConfig::new().max_in_flight(1).max_per_server(1))
+            .expect("Failed to enable admission control");
+
+        for _ in 0..3 {
+            let value = ctx.get(name, timeout).expect("Get failed");
+            assert!((value.get_field_double("value").unwrap() - 2.5).abs() < 1e-6);
+        }
+        ctx.put_double(name, 3.5, timeout).expect("Put failed");
+
+        // Sync calls give their slot back before returning
+        let stats = ctx.admission_stats();
+        assert_eq!(stats.admitted, 4);
+        assert_eq!(stats.in_flight, 0);
+        assert_eq!(stats.queued, 0);
+        assert_eq!(stats.timed_out, 0);
+
+        ctx.disable_admission_control();
+        assert_eq!(ctx.admission_stats().admitted, 0);
+
+        srv.stop().expect("Failed to stop server");
+    }
+
+    #[cfg(feature = "async")]
+    #[test]
+    fn test_admission_control_queues_excess_operations() {
+        // With two slots, starting ten operations back to back makes the
+        // later ones wait for earlier ones to finish.
+        use pvxs_sys::OperationSet;
+
+        let timeout = 5.0;
+        let mut srv = Server::from_env().expect("Failed to create server from env");
+        let names: Vec<String> = (0..10).map(|i| format!("admission:queued:{}", i)).collect();
+        for name in &names {
+            srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())
+                .expect("Failed to create pv on server");
+        }
+        srv.start().expect("Failed to start server");
+
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_admission_control(AdmissionConfig::new().max_in_flight(2))
+            .expect("Failed to enable admission control");
+
+        let mut set = OperationSet::new().expect("Failed to create operation set");
+        let mut ops = Vec::new();
+        for name in &names {
+            let op = ctx.start_get(name, timeout).expect("Failed to start get");
+            assert!(ctx.admission_stats().in_flight <= 2);
+            set.add(&op).unwrap();
+            ops.push(op);
+        }
+        assert_eq!(set.wait_all(timeout).expect("wait_all failed").len(), names.len());
+
+        let stats = ctx.admission_stats();
+        assert_eq!(stats.admitted, names.len() as u64);
+        assert!(stats.waited >= 1, "Later operations should have been queued");
+        assert!(stats.max_wait > 0.0);
+        assert!(stats.mean_wait() <= stats.max_wait);
+
+        srv.stop().expect("Failed to stop server");
+    }
+
+    #[cfg(feature = "async")]
+    #[test]
+    fn test_admission_timeout_while_queued() {
+        // An operation which never completes holds the only slot, so the
+        // next caller gives up once its own timeout passes.
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_admission_control(AdmissionConfig::new().max_in_flight(1))
+            .expect("Failed to enable admission control");
+
+        let mut blocker = ctx.start_get("admission:missing:a", 10.0).expect("Failed to start get");
+        let result = ctx.get("admission:missing:b", 0.2);
+        assert!(result.is_err());
+        assert!(result.unwrap_err().to_string().contains("admission"));
+
+        let stats = ctx.admission_stats();
+        assert_eq!(stats.timed_out, 1);
+        assert_eq!(stats.in_flight, 1);
+        blocker.cancel();
+    }
+
+    #[cfg(feature = "async")]
+    #[test]
+    fn test_async_start_does_not_wait_for_admission() {
+        // While the only slot is held, async starts return at once and
+        // their operations fail with their own timeout while still queued.
+        use std::time::{Duration, Instant};
+
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_admission_control(AdmissionConfig::new().max_in_flight(1))
+            .expect("Failed to enable admission control");
+
+        let mut blocker = ctx.start_get("admission:missing:c", 10.0).expect("Failed to start get");
+        let start = Instant::now();
+        let mut queued = ctx.start_get("admission:missing:d", 0.3).expect("Failed to start get");
+        let mut cancelled = ctx.start_get("admission:missing:e", 10.0).expect("Failed to start get");
+        assert!(start.elapsed() < Duration::from_millis(100), "Async start should not block");
+        assert_eq!(ctx.admission_stats().queued, 2);
+
+        // Cancelling a queued operation takes it out of the queue
+        cancelled.cancel();
+        assert!(cancelled.is_done());
+        assert_eq!(ctx.admission_stats().queued, 1);
+
+        assert!(queued.wait(5.0).expect("Wait failed"));
+        assert!(queued.result().unwrap_err().to_string().contains("admission"));
+        let stats = ctx.admission_stats();
+        assert_eq!(stats.timed_out, 1);
+        assert_eq!(stats.queued, 0);
+        assert_eq!(stats.in_flight, 1);
+
+        blocker.cancel();
+        assert_eq!(ctx.admission_stats().in_flight, 0);
+    }
+}
@@ -0,0 +1,95 @@
+mod test_pvxs_alarm_summary {
+    use pvxs_sys::{Server, Context, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn settle() {
+        thread::sleep(Duration::from_millis(1000));
+    }
+
+    #[test]
+    fn test_alarm_summary_groups() -> Result<(), PvxsError> {
+        let mut ctx = Context::from_env()?;
+        let mut summary = ctx.alarm_summary()?;
+
+        assert!(summary.start().is_err(), "Nothing to monitor yet");
+        assert!(summary.add_pv("alarm:groups:a", "").is_err());
+        assert!(summary.add_pv("alarm:groups:a", "TOP:").is_err());
+
+        summary.add_pv("alarm:groups:a", "TOP:SUB:LEAF")?;
+        summary.add_pv("alarm:groups:b", "TOP:OTHER")?;
+        assert!(summary.add_pv("alarm:groups:a", "TOP:OTHER").is_err());
+
+        assert_eq!(summary.groups(), vec!["TOP", "TOP:SUB", "TOP:SUB:LEAF", "TOP:OTHER"]);
+        assert!(summary.group_stats("NOPE").is_none());
+
+        // Nothing is known before the first update
+        let top = summary.group_stats("TOP").expect("group exists");
+        assert_eq!(top.total, 2);
+        assert_eq!(top.disconnected, 2);
+        assert_eq!(top.max_severity, 3);
+        let leaf = summary.group_stats("TOP:SUB:LEAF").expect("group exists");
+        assert_eq!(leaf.total, 1);
+        Ok(())
+    }
+
+    #[test]
+    fn test_alarm_summary_counts_and_publishes() -> Result<(), PvxsError> {
+        let mut upstream = Server::from_env()?;
+        upstream.create_pv_double("alarm:sum:a1", 1.0, NTScalarMetadataBuilder::new())?;
+        upstream.create_pv_double("alarm:sum:a2", 2.0, NTScalarMetadataBuilder::new().alarm(1, 3, "HIGH"))?;
+        upstream.start()?;
+
+        let mut other = Server::from_env()?;
+        other.create_pv_double("alarm:sum:b1", 3.0, NTScalarMetadataBuilder::new().alarm(2, 3, "HIHI"))?;
+        other.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut summary = ctx.alarm_summary()?;
+        summary.add_pv("alarm:sum:a1", "SUM:A")?;
+        summary.add_pv("alarm:sum:a2", "SUM:A")?;
+        summary.add_pv("alarm:sum:b1", "SUM:B")?;
+
+        let mut published = Server::from_env()?;
+        summary.publish(&mut published, "alarm:summary:")?;
+        published.start()?;
+
+        summary.start()?;
+        assert!(summary.is_running());
+        settle();
+
+        let a = summary.group_stats("SUM:A").expect("group exists");
+        assert_eq!((a.total, a.no_alarm, a.minor, a.disconnected), (2, 1, 1, 0));
+        assert_eq!(a.max_severity, 1);
+        let top = summary.group_stats("SUM").expect("group exists");
+        assert_eq!((top.total, top.major), (3, 1));
+        assert_eq!(top.max_severity, 2);
+        assert_eq!(summary.updates(), 3);
+
+        let value = ctx.get("alarm:summary:SUM", 5.0)?;
+        assert_eq!(value.get_field_int32("value")?, 2);
+        assert_eq!(value.get_field_int32("alarm.severity")?, 2);
+        assert_eq!(value.get_field_int32("total")?, 3);
+        assert_eq!(value.get_field_int32("minor")?, 1);
+
+        // Losing a PV makes its groups INVALID
+        other.stop()?;
+        thread::sleep(Duration::from_millis(2000));
+        let b = summary.group_stats("SUM:B").expect("group exists");
+        assert_eq!(b.disconnected, 1);
+        assert_eq!(b.max_severity, 3);
+        assert_eq!(summary.group_stats("SUM:A").unwrap().max_severity, 1);
+        assert_eq!(summary.group_stats("SUM").unwrap().max_severity, 3);
+
+        let value = ctx.get("alarm:summary:SUM", 5.0)?;
+        assert_eq!(value.get_field_int32("disconnected")?, 1);
+
+        summary.stop()?;
+        assert!(!summary.is_running());
+        assert_eq!(summary.group_stats("SUM").unwrap().disconnected, 3);
+
+        published.stop()?;
+        upstream.stop()?;
+        Ok(())
+    }
+}
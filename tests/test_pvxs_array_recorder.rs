@@ -0,0 +1,243 @@
+mod test_pvxs_array_recorder {
+    use pvxs_sys::{Server, Context, ArrayRecorderConfig, ArrayRecordHeader, NTScalarMetadataBuilder, PvxsError};
+    use std::fs;
+    use std::path::PathBuf;
+    use std::thread;
+    use std::time::Duration;
+
+    fn settle() {
+        thread::sleep(Duration::from_millis(500));
+    }
+
+    fn temp_path(name: &str) -> PathBuf {
+        std::env::temp_dir().join(format!("pvxs_sys_{}_{}", std::process::id(), name))
+    }
+
+    // Headers and elements of every record from at, up to the first gap or marker, and that marker
+    fn read_from(bytes: &[u8], mut at: usize) -> (Vec<(ArrayRecordHeader, Vec<f64>)>, Option<ArrayRecordHeader>) {
+        let mut records = Vec::new();
+        while let Some(header) = ArrayRecordHeader::parse(&bytes[at..]) {
+            if header.is_marker() {
+                return (records, Some(header));
+            }
+            let start = at + ArrayRecordHeader::SIZE;
+            let values = bytes[start..start + header.count as usize * 8]
+                .chunks_exact(8)
+                .map(|b| f64::from_ne_bytes(b.try_into().unwrap()))
+                .collect();
+            records.push((header, values));
+            at = start + header.padded_len();
+        }
+        (records, None)
+    }
+
+    fn read_records(bytes: &[u8]) -> Vec<(ArrayRecordHeader, Vec<f64>)> {
+        read_from(bytes, 0).0
+    }
+
+    // Every record of a ring, oldest first
+    fn read_ring(bytes: &[u8]) -> Vec<(ArrayRecordHeader, Vec<f64>)> {
+        let (newest, end) = read_from(bytes, 0);
+        let end = end.expect("A ring ends with a marker");
+        assert!(end.is_end());
+        let mut records = Vec::new();
+        if let Some(oldest) = end.oldest() {
+            let (older, wrap) = read_from(bytes, oldest as usize);
+            assert!(wrap.unwrap().is_wrap());
+            records.extend(older);
+        }
+        records.extend(newest);
+        records
+    }
+
+    #[test]
+    fn test_recorder_writes_updates() -> Result<(), PvxsError> {
+        let name = "recorder:waveform";
+        let path = temp_path("waveform.rec");
+
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double_array(name, vec![0.0; 3], NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut recorder = ctx.array_recorder(name, path.to_str().unwrap(), ArrayRecorderConfig::new())?;
+        recorder.start()?;
+        assert!(recorder.is_running());
+        settle();
+
+        // Spaced out so that pvxs doesn't squash updates in the subscription queue
+        for i in 1..=3 {
+            pv.post_double_array(&vec![i as f64; i + 1])?;
+            thread::sleep(Duration::from_millis(50));
+        }
+        settle();
+        recorder.stop()?;
+        assert!(!recorder.is_running());
+
+        let stats = recorder.stats();
+        assert_eq!(stats.recorded, 4);
+        assert_eq!(stats.dropped, 0);
+        assert_eq!(stats.failed, 0);
+        assert!(stats.batches >= 1);
+
+        let bytes = fs::read(&path).unwrap();
+        assert_eq!(stats.bytes, bytes.len() as u64);
+        let records = read_records(&bytes);
+        assert_eq!(records.len(), 4);
+        assert_eq!(records[0].1, vec![0.0; 3]);
+        for (i, (header, values)) in records.iter().enumerate() {
+            assert_eq!(header.version, ArrayRecordHeader::VERSION);
+            assert_eq!(header.element_size, 8);
+            assert_eq!(header.sequence, i as u64);
+            assert!(header.seconds > 0);
+            if i > 0 {
+                assert_eq!(values, &vec![i as f64; i + 1]);
+            }
+        }
+
+        srv.stop()?;
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[test]
+    fn test_recorder_ring_wraps() -> Result<(), PvxsError> {
+        let name = "recorder:ring";
+        let path = temp_path("ring.rec");
+
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double_array(name, vec![0.0; 4], NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        // Room for two records of 40 + 32 bytes, and a wrap marker
+        let config = ArrayRecorderConfig::new().capacity(200).ring(true);
+        let mut ctx = Context::from_env()?;
+        let mut recorder = ctx.array_recorder(name, path.to_str().unwrap(), config)?;
+        recorder.start()?;
+        settle();
+
+        for i in 1..=2 {
+            pv.post_double_array(&[i as f64; 4])?;
+            thread::sleep(Duration::from_millis(50));
+        }
+        settle();
+        recorder.stop()?;
+        assert_eq!(recorder.stats().recorded, 3);
+
+        // The file keeps its preallocated size; the third update overwrote the first
+        let bytes = fs::read(&path).unwrap();
+        assert_eq!(bytes.len(), 200);
+        let records = read_records(&bytes);
+        assert_eq!(records[0].0.sequence, 2);
+        assert_eq!(records[0].1, vec![2.0; 4]);
+        let marker = ArrayRecordHeader::parse(&bytes[144..]).unwrap();
+        assert!(marker.is_wrap());
+
+        srv.stop()?;
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[test]
+    fn test_recorder_ring_reads_back_after_wrap() -> Result<(), PvxsError> {
+        let name = "recorder:ring:readback";
+        let path = temp_path("ring_readback.rec");
+
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double_array(name, vec![0.0; 4], NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        // Room for five records of 40 + 32 bytes and a wrap marker
+        let config = ArrayRecorderConfig::new().capacity(400).ring(true);
+        let mut ctx = Context::from_env()?;
+        let mut recorder = ctx.array_recorder(name, path.to_str().unwrap(), config)?;
+        recorder.start()?;
+        settle();
+
+        for i in 1..=7 {
+            pv.post_double_array(&[i as f64; 4])?;
+            thread::sleep(Duration::from_millis(50));
+        }
+        settle();
+        recorder.stop()?;
+        assert_eq!(recorder.stats().recorded, 8);
+
+        // Updates 5 to 7 overwrote 0 to 3 at the start of the file. Reading from the start stops
+        // at the end marker instead of running into what is left of update 3, which points on
+        // to update 4, the only one left of the first lap
+        let bytes = fs::read(&path).unwrap();
+        let (newest, end) = read_from(&bytes, 0);
+        assert_eq!(newest.len(), 3);
+        let end = end.unwrap();
+        assert!(end.is_end());
+        assert_eq!(end.oldest(), Some(288));
+
+        let records = read_ring(&bytes);
+        let sequences: Vec<u64> = records.iter().map(|(header, _)| header.sequence).collect();
+        assert_eq!(sequences, vec![4, 5, 6, 7]);
+        for (header, values) in &records {
+            assert_eq!(values, &vec![header.sequence as f64; 4]);
+        }
+
+        srv.stop()?;
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[test]
+    fn test_recorder_drops_when_full() -> Result<(), PvxsError> {
+        let name = "recorder:full";
+        let path = temp_path("full.rec");
+
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double_array(name, vec![0.0; 4], NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let config = ArrayRecorderConfig::new().capacity(100);
+        let mut ctx = Context::from_env()?;
+        let mut recorder = ctx.array_recorder(name, path.to_str().unwrap(), config)?;
+        recorder.start()?;
+        settle();
+        pv.post_double_array(&[1.0; 4])?;
+        settle();
+        recorder.stop()?;
+
+        let stats = recorder.stats();
+        assert_eq!(stats.recorded, 1);
+        assert_eq!(stats.dropped, 1);
+
+        srv.stop()?;
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[test]
+    fn test_recorder_rejects_scalars_and_bad_config() -> Result<(), PvxsError> {
+        let name = "recorder:scalar";
+        let path = temp_path("scalar.rec");
+
+        let mut srv = Server::from_env()?;
+        let _pv = srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        assert!(ctx.array_recorder(name, path.to_str().unwrap(), ArrayRecorderConfig::new().ring(true)).is_err());
+        assert!(ctx.array_recorder(name, path.to_str().unwrap(), ArrayRecorderConfig::new().max_queued(0)).is_err());
+
+        let mut recorder = ctx.array_recorder(name, path.to_str().unwrap(), ArrayRecorderConfig::new())?;
+        recorder.start()?;
+        settle();
+        recorder.stop()?;
+        assert_eq!(recorder.stats().recorded, 0);
+        assert_eq!(recorder.stats().failed, 1);
+
+        // The file can't be created
+        let mut missing = ctx.array_recorder(name, "/nonexistent/dir/x.rec", ArrayRecorderConfig::new())?;
+        assert!(missing.start().is_err());
+        assert!(!missing.is_running());
+
+        srv.stop()?;
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+}
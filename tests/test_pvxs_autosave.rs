@@ -0,0 +1,131 @@
+mod test_pvxs_autosave {
+    use pvxs_sys::{Autosave, Server, NTScalarMetadataBuilder, PvxsError};
+    use std::fs;
+    use std::path::PathBuf;
+    use std::thread;
+    use std::time::Duration;
+
+    fn temp_path(name: &str) -> PathBuf {
+        let path = std::env::temp_dir().join(format!("pvxs_sys_{}_{}", std::process::id(), name));
+        for buffer in [".0", ".1"] {
+            let _ = fs::remove_file(format!("{}{}", path.display(), buffer));
+        }
+        path
+    }
+
+    #[test]
+    fn test_autosave_round_trip() -> Result<(), PvxsError> {
+        let path = temp_path("autosave_round_trip");
+        {
+            let mut srv = Server::from_env()?;
+            let mut speed = srv.create_pv_double("autosave:speed", 0.0, NTScalarMetadataBuilder::new())?;
+            let mut mode = srv.create_pv_int32("autosave:mode", 0, NTScalarMetadataBuilder::new())?;
+            let mut label = srv.create_pv_string("autosave:label", "", NTScalarMetadataBuilder::new())?;
+            let mut table = srv.create_pv_double_array("autosave:table", vec![], NTScalarMetadataBuilder::new())?;
+
+            let mut autosave = Autosave::new(&path, 10.0)?;
+            autosave.add("speed", &speed)?;
+            autosave.add("mode", &mode)?;
+            autosave.add("label", &label)?;
+            autosave.add("table", &table)?;
+            assert!(autosave.add("speed", &mode).is_err());
+
+            speed.post_double(2.5)?;
+            mode.post_int32(3)?;
+            label.post_string("fast")?;
+            table.post_double_array(&[1.0, 2.0, 3.0])?;
+            assert!(autosave.save()?);
+            // Nothing posted since, nothing written
+            assert!(!autosave.save()?);
+
+            let stats = autosave.stats();
+            assert_eq!(stats.saves, 1);
+            assert_eq!(stats.generation, 1);
+            assert!(stats.bytes > 32);
+        }
+
+        let mut srv = Server::from_env()?;
+        let speed = srv.create_pv_double("autosave:speed", 0.0, NTScalarMetadataBuilder::new())?;
+        let mode = srv.create_pv_int32("autosave:mode", 0, NTScalarMetadataBuilder::new())?;
+        let label = srv.create_pv_string("autosave:label", "", NTScalarMetadataBuilder::new())?;
+        let table = srv.create_pv_double_array("autosave:table", vec![], NTScalarMetadataBuilder::new())?;
+
+        let mut autosave = Autosave::new(&path, 10.0)?;
+        assert_eq!(autosave.stats().generation, 1);
+        autosave.add("speed", &speed)?;
+        autosave.add("mode", &mode)?;
+        autosave.add("label", &label)?;
+        autosave.add("table", &table)?;
+        assert_eq!(autosave.restore()?, 4);
+
+        assert_eq!(speed.fetch()?.get_field_double("value")?, 2.5);
+        assert_eq!(mode.fetch()?.get_field_int32("value")?, 3);
+        assert_eq!(label.fetch()?.get_field_string("value")?, "fast");
+        assert_eq!(table.fetch()?.get_field_double_array("value")?, vec![1.0, 2.0, 3.0]);
+        // Restoring doesn't make the PVs dirty
+        assert!(!autosave.save()?);
+        Ok(())
+    }
+
+    #[test]
+    fn test_autosave_writer_thread() -> Result<(), PvxsError> {
+        let path = temp_path("autosave_writer");
+        let mut srv = Server::from_env()?;
+        let mut level = srv.create_pv_int32("autosave:level", 0, NTScalarMetadataBuilder::new())?;
+
+        assert!(Autosave::new(&path, 0.0).is_err());
+        let mut autosave = Autosave::new(&path, 0.05)?;
+        autosave.add("level", &level)?;
+        autosave.start()?;
+        assert!(autosave.is_running());
+        assert!(autosave.add("other", &level).is_err());
+
+        thread::sleep(Duration::from_millis(200));
+        let idle = autosave.stats();
+        assert_eq!(idle.saves, 1);
+
+        // Many posts between wakeups become one snapshot
+        for i in 1..=100 {
+            level.post_int32(i)?;
+        }
+        thread::sleep(Duration::from_millis(200));
+        assert_eq!(autosave.stats().saves, 2);
+
+        level.post_int32(7)?;
+        autosave.stop()?;
+        assert!(!autosave.is_running());
+        let stats = autosave.stats();
+        assert_eq!(stats.saves, 3);
+        assert_eq!(stats.failed, 0);
+        assert_eq!(stats.generation, 3);
+        Ok(())
+    }
+
+    #[test]
+    fn test_autosave_torn_snapshot() -> Result<(), PvxsError> {
+        let path = temp_path("autosave_torn");
+        let mut srv = Server::from_env()?;
+        let mut gain = srv.create_pv_double("autosave:gain", 0.0, NTScalarMetadataBuilder::new())?;
+
+        let mut autosave = Autosave::new(&path, 10.0)?;
+        autosave.add("gain", &gain)?;
+        gain.post_double(1.5)?;
+        assert!(autosave.save()?);
+        gain.post_double(2.5)?;
+        assert!(autosave.save()?);
+
+        // Generation 2 went to the ".0" buffer; tear it as a crash mid-write would
+        let newest = format!("{}.0", path.display());
+        let bytes = fs::read(&newest).unwrap();
+        fs::write(&newest, &bytes[..bytes.len() - 3]).unwrap();
+
+        gain.post_double(0.0)?;
+        assert_eq!(autosave.restore()?, 1);
+        assert_eq!(gain.fetch()?.get_field_double("value")?, 1.5);
+
+        // Both buffers gone bad: nothing to restore
+        fs::write(format!("{}.1", path.display()), b"garbage").unwrap();
+        assert_eq!(autosave.restore()?, 0);
+        Ok(())
+    }
+}
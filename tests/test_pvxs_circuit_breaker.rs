@@ -0,0 +1,107 @@
+mod test_pvxs_circuit_breaker {
+    use pvxs_sys::{Server, Context, CircuitBreakerConfig, CircuitState, NTScalarMetadataBuilder};
+    use std::time::{Duration, Instant};
+
+    #[test]
+    fn test_negative_cache_fails_fast() {
+        // A PV nobody serves times out once, then lands in the negative cache
+        let timeout = 0.5;
+        let name = "breaker:does:not:exist";
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_circuit_breaker(CircuitBreakerConfig::new().negative_cache_ttl(30.0))
+            .expect("Failed to enable circuit breaker");
+        assert_eq!(ctx.circuit_state(name), CircuitState::Closed);
+
+        let first = ctx.get(name, timeout);
+        assert!(first.is_err());
+        assert!(first.unwrap_err().to_string().contains("Timeout"));
+        assert_eq!(ctx.circuit_state(name), CircuitState::Unreachable);
+
+        let start = Instant::now();
+        let second = ctx.get(name, timeout);
+        assert!(second.is_err());
+        assert!(second.unwrap_err().to_string().contains("negative cache"));
+        assert!(start.elapsed() < Duration::from_millis(100), "Negative cache lookup should not wait");
+        assert_eq!(ctx.circuit_fast_fail_count(), 1);
+
+        // Reset forgets the name
+        ctx.reset_circuit_breaker();
+        assert_eq!(ctx.circuit_state(name), CircuitState::Closed);
+        assert_eq!(ctx.circuit_fast_fail_count(), 0);
+    }
+
+    #[test]
+    fn test_circuit_opens_and_recovers_through_probe() {
+        let timeout = 0.5;
+        let name = "breaker:double";
+        let mut srv = Server::from_env().expect("Failed to create server from env");
+        srv.create_pv_double(name, 1.5, NTScalarMetadataBuilder::new())
+            .expect("Failed to create pv on server");
+        srv.start().expect("Failed to start server");
+
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_circuit_breaker(CircuitBreakerConfig::new()
+            .failure_threshold(2)
+            .open_duration(1.0))
+            .expect("Failed to enable circuit breaker");
+
+        // Learn which server answers for the PV
+        ctx.get(name, 5.0).expect("Initial get failed");
+        assert_eq!(ctx.circuit_state(name), CircuitState::Closed);
+
+        srv.stop().expect("Failed to stop server");
+
+        // Two consecutive timeouts open the circuit
+        assert!(ctx.get(name, timeout).is_err());
+        assert_eq!(ctx.circuit_state(name), CircuitState::Closed);
+        assert!(ctx.get(name, timeout).is_err());
+        assert_eq!(ctx.circuit_state(name), CircuitState::Open);
+
+        let start = Instant::now();
+        let rejected = ctx.get(name, timeout);
+        assert!(rejected.is_err());
+        assert!(rejected.unwrap_err().to_string().contains("Circuit open"));
+        assert!(start.elapsed() < Duration::from_millis(100), "Open circuit should fail fast");
+        assert!(ctx.circuit_fast_fail_count() >= 1);
+
+        // Once the window passes, a successful probe closes the circuit
+        srv.start().expect("Failed to restart server");
+        std::thread::sleep(Duration::from_millis(1100));
+        assert_eq!(ctx.circuit_state(name), CircuitState::HalfOpen);
+        let value = ctx.get(name, 5.0).expect("Probe get failed");
+        assert!((value.get_field_double("value").unwrap() - 1.5).abs() < 1e-6);
+        assert_eq!(ctx.circuit_state(name), CircuitState::Closed);
+
+        srv.stop().expect("Failed to stop server");
+    }
+
+    #[test]
+    fn test_circuit_breaker_disabled_by_default() {
+        // Without enabling, repeated failures keep waiting for the full timeout
+        let name = "breaker:disabled:missing";
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        assert!(ctx.get(name, 0.2).is_err());
+        assert!(ctx.get(name, 0.2).is_err());
+        assert_eq!(ctx.circuit_state(name), CircuitState::Closed);
+        assert_eq!(ctx.circuit_fast_fail_count(), 0);
+    }
+
+    #[cfg(feature = "async")]
+    #[test]
+    fn test_async_timeout_counts_against_the_circuit() {
+        // An async operation which expires is recorded like a synchronous timeout
+        let name = "breaker:async:missing";
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        ctx.enable_circuit_breaker(CircuitBreakerConfig::new().negative_cache_ttl(30.0))
+            .expect("Failed to enable circuit breaker");
+
+        let mut op = ctx.start_get(name, 0.2).expect("Failed to start get");
+        assert!(op.wait(5.0).expect("Wait failed"));
+        assert!(op.result().unwrap_err().to_string().contains("Timeout"));
+        assert_eq!(ctx.circuit_state(name), CircuitState::Unreachable);
+
+        let again = ctx.start_get(name, 0.2);
+        assert!(again.is_err());
+        assert!(again.err().unwrap().to_string().contains("negative cache"));
+    }
+}
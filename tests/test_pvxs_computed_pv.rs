@@ -0,0 +1,132 @@
+mod test_pvxs_computed_pv {
+    use pvxs_sys::{Server, Context, NTScalarMetadataBuilder, PvxsError};
+    use std::sync::atomic::{AtomicI32, AtomicU64, Ordering};
+    use std::thread;
+    use std::time::{Duration, Instant};
+
+    const TIMEOUT: f64 = 5.0;
+
+    static CALLS: AtomicU64 = AtomicU64::new(0);
+    static CACHED_CALLS: AtomicI32 = AtomicI32::new(0);
+
+    extern "C" fn count_calls() -> f64 {
+        CALLS.fetch_add(1, Ordering::SeqCst) as f64 + 1.0
+    }
+
+    extern "C" fn count_cached_calls() -> i32 {
+        CACHED_CALLS.fetch_add(1, Ordering::SeqCst) + 1
+    }
+
+    extern "C" fn constant() -> f64 {
+        7.5
+    }
+
+    extern "C" fn slow() -> f64 {
+        thread::sleep(Duration::from_millis(1000));
+        3.0
+    }
+
+    #[test]
+    fn test_computed_on_every_get() -> Result<(), PvxsError> {
+        let name = "computed:every";
+        let mut srv = Server::from_env()?;
+        let pv = srv.create_pv_computed_double(name, count_calls, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        // Nothing is computed until someone reads
+        thread::sleep(Duration::from_millis(200));
+        assert_eq!(CALLS.load(Ordering::SeqCst), 0);
+
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_double("value")?, 1.0);
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_double("value")?, 2.0);
+
+        let stats = pv.computed_stats().unwrap();
+        assert_eq!(stats.evaluations, 2);
+        assert_eq!(stats.cache_hits, 0);
+        // The result is posted, so the PV holds the last one
+        assert_eq!(pv.fetch()?.get_field_double("value")?, 2.0);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_computed_cache_ttl() -> Result<(), PvxsError> {
+        let name = "computed:cached";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_computed_int32(name, count_cached_calls, 0.5, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_int32("value")?, 1);
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_int32("value")?, 1);
+        let stats = pv.computed_stats().unwrap();
+        assert_eq!(stats.evaluations, 1);
+        assert_eq!(stats.cache_hits, 1);
+
+        // Stale after the TTL
+        thread::sleep(Duration::from_millis(700));
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_int32("value")?, 2);
+
+        // Or at once when invalidated
+        pv.invalidate();
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_int32("value")?, 3);
+        assert_eq!(pv.computed_stats().unwrap().evaluations, 3);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_computed_is_read_only() -> Result<(), PvxsError> {
+        let name = "computed:readonly";
+        let mut srv = Server::from_env()?;
+        let _pv = srv.create_pv_computed_double(name, constant, 1.0, NTScalarMetadataBuilder::new())?;
+        let plain = srv.create_pv_double("computed:plain", 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        assert!(ctx.put_double(name, 1.0, TIMEOUT).is_err());
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_double("value")?, 7.5);
+
+        assert!(plain.computed_stats().is_none());
+        assert!(srv.create_pv_computed_double("computed:negative", constant, -1.0, NTScalarMetadataBuilder::new()).is_err());
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_slow_computed_does_not_block_server() -> Result<(), PvxsError> {
+        let name = "computed:slow";
+        let mut srv = Server::from_env()?;
+        let _pv = srv.create_pv_computed_double(name, slow, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.create_pv_double("computed:other", 1.5, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        // Connect first, so only the evaluation is timed below
+        assert_eq!(ctx.get("computed:other", TIMEOUT)?.get_field_double("value")?, 1.5);
+
+        // Subscribing to a stale computed PV returns without waiting for the function
+        let start = Instant::now();
+        let mut monitor = ctx.monitor_builder(name)?.connect_exception(false).exec()?;
+        monitor.start()?;
+        let reader = thread::spawn(|| -> Result<f64, PvxsError> {
+            let mut ctx = Context::from_env()?;
+            ctx.get("computed:slow", TIMEOUT)?.get_field_double("value")
+        });
+        thread::sleep(Duration::from_millis(200));
+
+        // While the function runs, other PVs are served as usual
+        assert_eq!(ctx.get("computed:other", TIMEOUT)?.get_field_double("value")?, 1.5);
+        assert!(start.elapsed() < Duration::from_millis(800), "Server waited on the computed PV");
+
+        assert_eq!(reader.join().unwrap()?, 3.0);
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
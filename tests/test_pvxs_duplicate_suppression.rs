@@ -0,0 +1,98 @@
+mod test_pvxs_duplicate_suppression {
+    use pvxs_sys::{Server, Context, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn drain(monitor: &mut pvxs_sys::Monitor) -> Result<Vec<f64>, PvxsError> {
+        let mut values = Vec::new();
+        while let Ok(Some(value)) = monitor.pop() {
+            values.push(value.get_field_double("value")?);
+        }
+        Ok(values)
+    }
+
+    #[test]
+    fn test_stats_only_with_filter() -> Result<(), PvxsError> {
+        let name = "dup:suppress:plain";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let plain = ctx.monitor_builder(name)?.exec()?;
+        assert!(plain.duplicate_stats().is_none());
+
+        let filtered = ctx.monitor_builder(name)?.suppress_duplicates(&[]).exec()?;
+        let stats = filtered.duplicate_stats().expect("filter configured");
+        assert_eq!(stats.passed, 0);
+        assert_eq!(stats.suppressed, 0);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_repeated_posts_are_dropped() -> Result<(), PvxsError> {
+        // Posts are spaced out so pvxs queues each one separately instead
+        // of squashing them; only the filter may drop the repeats.
+        let name = "dup:suppress:value";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .suppress_duplicates(&["value"])
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        for value in [1.0, 1.0, 2.0, 2.0, 2.0, 1.0] {
+            pv.post_double(value)?;
+            thread::sleep(Duration::from_millis(50));
+        }
+        thread::sleep(Duration::from_millis(500));
+
+        let values = drain(&mut monitor)?;
+        assert_eq!(values, vec![1.0, 2.0, 1.0]);
+
+        let stats = monitor.duplicate_stats().expect("filter configured");
+        assert_eq!(stats.passed, 3);
+        assert!(stats.suppressed >= 3, "Expected repeats to be suppressed, got {:?}", stats);
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_unselected_field_change_is_a_duplicate() -> Result<(), PvxsError> {
+        // Only "alarm" is compared, so value changes alone are dropped
+        let name = "dup:suppress:alarm";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .suppress_duplicates(&["alarm"])
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        for value in [2.0, 3.0, 4.0] {
+            pv.post_double(value)?;
+            thread::sleep(Duration::from_millis(50));
+        }
+        thread::sleep(Duration::from_millis(500));
+
+        let values = drain(&mut monitor)?;
+        assert_eq!(values, vec![1.0]);
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
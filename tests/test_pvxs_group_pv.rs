@@ -0,0 +1,98 @@
+mod test_pvxs_group_pv {
+    use pvxs_sys::{Server, Context, GroupPV, GroupPVBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn motor() -> GroupPVBuilder {
+        GroupPVBuilder::new()
+            .double("position", 1.5)
+            .double("velocity", 0.0)
+            .int32("status", 0)
+            .string("mode", "idle")
+            .double_array("profile", vec![0.0, 1.0])
+    }
+
+    #[test]
+    fn test_group_pv_definition_errors() {
+        assert!(GroupPV::create(GroupPVBuilder::new()).is_err());
+        assert!(GroupPV::create(GroupPVBuilder::new().double("a", 0.0).int32("a", 0)).is_err());
+        assert!(GroupPV::create(GroupPVBuilder::new().double("a.b", 0.0)).is_err());
+    }
+
+    #[test]
+    fn test_group_pv_staging() -> Result<(), PvxsError> {
+        let mut group = GroupPV::create(motor())?;
+
+        let initial = group.fetch()?;
+        assert_eq!(initial.get_field_double("position.value")?, 1.5);
+        assert_eq!(initial.get_field_string("mode.value")?, "idle");
+        assert_eq!(initial.get_field_double_array("profile.value")?, vec![0.0, 1.0]);
+
+        // Nothing staged yet
+        assert!(!group.post()?);
+
+        assert!(group.set_double("nope", 1.0).is_err());
+        assert!(group.set_double("position.value", 1.0).is_err());
+
+        group.set_double("position", 2.5)?.set_int32("status", 3)?;
+        // Staged changes are not visible until posted
+        assert_eq!(group.fetch()?.get_field_double("position.value")?, 1.5);
+        assert!(group.post()?);
+
+        let value = group.fetch()?;
+        assert_eq!(value.get_field_double("position.value")?, 2.5);
+        assert_eq!(value.get_field_int32("status.value")?, 3);
+        assert_eq!(value.get_field_double("velocity.value")?, 0.0);
+        assert!(!group.post()?);
+        Ok(())
+    }
+
+    #[test]
+    fn test_group_pv_single_update_per_post() -> Result<(), PvxsError> {
+        let name = "group:pv:motor";
+        let mut srv = Server::from_env()?;
+        let mut group = srv.create_group_pv(name, motor())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?.connect_exception(false).exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+        while let Ok(Some(_)) = monitor.pop() {}
+
+        for i in 1..=3 {
+            group.set_double("position", i as f64)?
+                .set_double("velocity", -(i as f64))?
+                .set_alarm("status", 1, 1, "moving")?;
+            group.post()?;
+            thread::sleep(Duration::from_millis(100));
+        }
+        thread::sleep(Duration::from_millis(500));
+
+        // One update per post, each with all members consistent
+        let mut updates = Vec::new();
+        while let Ok(Some(value)) = monitor.pop() {
+            updates.push(value);
+        }
+        assert_eq!(updates.len(), 3);
+        for (i, update) in updates.iter().enumerate() {
+            let n = (i + 1) as f64;
+            assert_eq!(update.get_field_double("position.value")?, n);
+            assert_eq!(update.get_field_double("velocity.value")?, -n);
+            assert_eq!(update.get_field_int32("status.alarm.severity")?, 1);
+            assert_eq!(update.get_field_string("mode.value")?, "idle");
+        }
+
+        // Changed members carry the same time stamp
+        let last = &updates[2];
+        assert_eq!(last.get_field_int32("position.timeStamp.nanoseconds")?,
+                   last.get_field_int32("velocity.timeStamp.nanoseconds")?);
+
+        let value = ctx.get(name, 5.0)?;
+        assert_eq!(value.get_field_double("position.value")?, 3.0);
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,109 @@
+mod test_pvxs_histogram {
+    use pvxs_sys::{Server, HistogramConfig, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    const TIMEOUT: f64 = 5.0;
+
+    fn settle() {
+        thread::sleep(Duration::from_millis(500));
+    }
+
+    #[test]
+    fn test_histogram_config_validation() -> Result<(), PvxsError> {
+        let srv = Server::create_isolated()?;
+        let mut ctx = srv.client_context()?;
+        assert!(ctx.histogram("hist:any", HistogramConfig::new().bins(0)).is_err());
+        assert!(ctx.histogram("hist:any", HistogramConfig::new().range(1.0, 1.0)).is_err());
+        assert!(ctx.histogram("hist:any", HistogramConfig::new().window(-1.0, 1)).is_err());
+        assert!(ctx.histogram("hist:any", HistogramConfig::new().window(1.0, 0)).is_err());
+        Ok(())
+    }
+
+    #[test]
+    fn test_histogram_of_array_elements() -> Result<(), PvxsError> {
+        let mut srv = Server::create_isolated()?;
+        let mut wave = srv.create_pv_double_array("hist:wave", vec![0.5], NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = srv.client_context()?;
+        let mut histogram = ctx.histogram("hist:wave", HistogramConfig::new().bins(10).range(0.0, 10.0))?;
+        histogram.publish(&mut srv, "hist:wave:histogram")?;
+        histogram.start()?;
+        settle();
+
+        // Enough elements to take the vectorized path: 100 in each bin, plus out of range ones
+        let mut elements: Vec<f64> = (0..1000).map(|i| (i % 10) as f64 + 0.5).collect();
+        elements.extend_from_slice(&[-1.0, 10.0, 25.0, f64::NAN]);
+        wave.post_double_array(&elements)?;
+        settle();
+
+        let mut expected = vec![100; 10];
+        expected[0] += 1; // the initial 0.5
+        assert_eq!(histogram.counts(), expected);
+        let stats = histogram.stats();
+        assert_eq!(stats.updates, 2);
+        assert_eq!(stats.samples, 1005);
+        assert_eq!(stats.underflow, 2);
+        assert_eq!(stats.overflow, 2);
+
+        // Served with its range and totals
+        let served = ctx.get("hist:wave:histogram", TIMEOUT)?;
+        assert_eq!(served.get_field_double("low")?, 0.0);
+        assert_eq!(served.get_field_double("high")?, 10.0);
+        assert_eq!(served.get_field_native::<u64>("entries")?, 1005);
+        assert_eq!(served.get_field_native_array::<u64>("value")?, expected);
+
+        histogram.stop()?;
+        assert!(!histogram.is_running());
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_histogram_of_scalar_updates() -> Result<(), PvxsError> {
+        let mut srv = Server::create_isolated()?;
+        let mut level = srv.create_pv_int32("hist:level", 0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = srv.client_context()?;
+        let mut histogram = ctx.histogram("hist:level", HistogramConfig::new().bins(4).range(0.0, 4.0))?;
+        histogram.start()?;
+        settle();
+
+        for value in [1, 1, 3] {
+            level.post_int32(value)?;
+            thread::sleep(Duration::from_millis(100));
+        }
+        settle();
+        assert_eq!(histogram.counts(), vec![1, 2, 0, 1]);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_histogram_window_expires_slices() -> Result<(), PvxsError> {
+        let mut srv = Server::create_isolated()?;
+        let mut level = srv.create_pv_double("hist:window", 0.5, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = srv.client_context()?;
+        let config = HistogramConfig::new().bins(2).range(0.0, 2.0).window(0.4, 2);
+        let mut histogram = ctx.histogram("hist:window", config)?;
+        histogram.start()?;
+        settle();
+
+        // Older than the window by the time the next update arrives
+        level.post_double(1.5)?;
+        thread::sleep(Duration::from_millis(900));
+        level.post_double(1.5)?;
+        settle();
+
+        assert_eq!(histogram.counts(), vec![0, 1]);
+        assert!(histogram.stats().expired >= 2);
+
+        srv.stop()?;
+        Ok(())
+    }
+}
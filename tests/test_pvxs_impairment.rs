@@ -0,0 +1,130 @@
+#[path = "common/impairment.rs"]
+mod impairment;
+
+mod test_pvxs_impairment {
+    use super::impairment::{Impairment, ImpairmentProxy};
+    use pvxs_sys::{Server, Context, NTScalarMetadataBuilder, PvxsError};
+    use serial_test::serial;
+    use std::thread;
+    use std::time::{Duration, Instant};
+
+    const TIMEOUT: f64 = 5.0;
+
+    fn isolated_server(names: &[&str]) -> Result<Server, PvxsError> {
+        let mut srv = Server::create_isolated()?;
+        for (i, name) in names.iter().enumerate() {
+            srv.create_pv_double(name, i as f64, NTScalarMetadataBuilder::new())?;
+        }
+        srv.start()?;
+        Ok(srv)
+    }
+
+    fn proxied_context(srv: &Server, impairment: Impairment) -> Result<(ImpairmentProxy, Context), PvxsError> {
+        let proxy = ImpairmentProxy::start(srv.tcp_port(), srv.udp_port(), impairment)
+            .map_err(|e| PvxsError::new(format!("Failed to start proxy: {}", e)))?;
+        proxy.apply_client_env();
+        let ctx = Context::from_env()?;
+        Ok((proxy, ctx))
+    }
+
+    #[test]
+    #[serial]
+    fn test_traffic_flows_through_proxy() -> Result<(), PvxsError> {
+        let name = "impairment:passthrough";
+        let mut srv = isolated_server(&[name])?;
+        let (proxy, mut ctx) = proxied_context(&srv, Impairment::new())?;
+
+        ctx.put_double(name, 42.0, TIMEOUT)?;
+        let value = ctx.get(name, TIMEOUT)?;
+        assert_eq!(value.get_field_double("value")?, 42.0);
+
+        let stats = proxy.stats();
+        assert_eq!(stats.connections, 1);
+        assert!(stats.udp_datagrams >= 2, "Search should go through the proxy");
+        assert!(stats.tcp_bytes > 0);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    #[serial]
+    fn test_delay_adds_round_trip_time() -> Result<(), PvxsError> {
+        let name = "impairment:delay";
+        let rtt = Duration::from_millis(60);
+        let mut srv = isolated_server(&[name])?;
+        let (_proxy, mut ctx) = proxied_context(&srv, Impairment::rtt(rtt).jitter(Duration::from_millis(5)))?;
+
+        // First GET also pays for search and connection setup
+        ctx.get(name, TIMEOUT)?;
+
+        let start = Instant::now();
+        ctx.get(name, TIMEOUT)?;
+        let elapsed = start.elapsed();
+        assert!(elapsed >= rtt, "GET took {:?}, expected at least {:?}", elapsed, rtt);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[cfg(feature = "async")]
+    #[test]
+    #[serial]
+    fn test_batched_gets_share_round_trips() -> Result<(), PvxsError> {
+        use pvxs_sys::OperationSet;
+
+        let names: Vec<String> = (0..20).map(|i| format!("impairment:batch:{}", i)).collect();
+        let refs: Vec<&str> = names.iter().map(|n| n.as_str()).collect();
+        let rtt = Duration::from_millis(50);
+        let mut srv = isolated_server(&refs)?;
+        let (_proxy, mut ctx) = proxied_context(&srv, Impairment::rtt(rtt))?;
+
+        // Warm up every channel so only the GETs themselves are timed
+        for name in &refs {
+            ctx.get(name, TIMEOUT)?;
+        }
+
+        let start = Instant::now();
+        let mut set = OperationSet::new()?;
+        let mut ops = Vec::new();
+        for name in &refs {
+            let op = ctx.start_get(name, TIMEOUT)?;
+            set.add(&op)?;
+            ops.push(op);
+        }
+        assert_eq!(set.wait_all(TIMEOUT)?.len(), refs.len());
+        let elapsed = start.elapsed();
+
+        for (i, op) in ops.iter_mut().enumerate() {
+            assert_eq!(op.result()?.get_field_double("value")?, i as f64);
+        }
+        // Sequential GETs would need one round trip each
+        assert!(elapsed < rtt * 5, "Batch of {} took {:?}", refs.len(), elapsed);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    #[serial]
+    fn test_client_recovers_from_dropped_connection() -> Result<(), PvxsError> {
+        let name = "impairment:drop";
+        let mut srv = isolated_server(&[name])?;
+        let (proxy, mut ctx) = proxied_context(&srv, Impairment::rtt(Duration::from_millis(20)))?;
+
+        ctx.put_double(name, 1.0, TIMEOUT)?;
+        proxy.drop_connections();
+        assert_eq!(proxy.open_connections(), 0);
+        thread::sleep(Duration::from_millis(200));
+
+        // The client searches again and reconnects through the proxy
+        ctx.put_double(name, 2.0, TIMEOUT)?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_double("value")?, 2.0);
+        let stats = proxy.stats();
+        assert_eq!(stats.dropped_connections, 1);
+        assert_eq!(stats.connections, 2);
+
+        srv.stop()?;
+        Ok(())
+    }
+}
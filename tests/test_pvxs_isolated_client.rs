@@ -0,0 +1,62 @@
+mod test_pvxs_isolated_client {
+    use pvxs_sys::{Server, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+
+    const TIMEOUT: f64 = 5.0;
+
+    #[test]
+    fn test_client_context_reaches_its_server() -> Result<(), PvxsError> {
+        let mut srv = Server::create_isolated()?;
+        let pv = srv.create_pv_double("isolated:value", 1.5, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = srv.client_context()?;
+        assert_eq!(ctx.get("isolated:value", TIMEOUT)?.get_field_double("value")?, 1.5);
+        ctx.put_double("isolated:value", 2.5, TIMEOUT)?;
+        assert_eq!(pv.fetch()?.get_field_double("value")?, 2.5);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_parallel_servers_with_the_same_names() -> Result<(), PvxsError> {
+        // Each thread serves "isolated:id" from a private server and must only ever see its own
+        let workers: Vec<_> = (0..4)
+            .map(|id| {
+                thread::spawn(move || -> Result<(), PvxsError> {
+                    let mut srv = Server::create_isolated()?;
+                    srv.create_pv_int32("isolated:id", id, NTScalarMetadataBuilder::new())?;
+                    srv.start()?;
+
+                    let mut ctx = srv.client_context()?;
+                    for _ in 0..10 {
+                        assert_eq!(ctx.get("isolated:id", TIMEOUT)?.get_field_int32("value")?, id);
+                    }
+                    srv.stop()?;
+                    Ok(())
+                })
+            })
+            .collect();
+        for worker in workers {
+            worker.join().unwrap()?;
+        }
+        Ok(())
+    }
+
+    #[test]
+    fn test_client_context_does_not_find_other_servers() -> Result<(), PvxsError> {
+        let mut mine = Server::create_isolated()?;
+        mine.start()?;
+        let mut other = Server::create_isolated()?;
+        other.create_pv_double("isolated:elsewhere", 0.0, NTScalarMetadataBuilder::new())?;
+        other.start()?;
+
+        let mut ctx = mine.client_context()?;
+        assert!(ctx.get("isolated:elsewhere", 0.5).is_err());
+
+        other.stop()?;
+        mine.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,104 @@
+mod test_pvxs_mapped_array {
+    use pvxs_sys::{Server, Context, NTScalarMetadataBuilder, PvxsError};
+    use std::fs::{self, OpenOptions};
+    use std::io::{Seek, SeekFrom, Write};
+    use std::path::PathBuf;
+
+    const TIMEOUT: f64 = 5.0;
+
+    fn temp_file(name: &str, bytes: &[u8]) -> PathBuf {
+        let path = std::env::temp_dir().join(format!("pvxs_sys_{}_{}", std::process::id(), name));
+        fs::write(&path, bytes).unwrap();
+        path
+    }
+
+    fn f64_bytes(values: &[f64]) -> Vec<u8> {
+        values.iter().flat_map(|v| v.to_ne_bytes()).collect()
+    }
+
+    #[test]
+    fn test_mapped_array_follows_file() -> Result<(), PvxsError> {
+        let name = "mapped:table";
+        let path = temp_file("table.bin", &f64_bytes(&[1.0, 2.0, 3.0, 4.0]));
+
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_mapped_array_pv::<f64>(name, &path, 0, 0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+        assert_eq!(pv.len(), 4);
+
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_double_array("value")?, vec![1.0, 2.0, 3.0, 4.0]);
+
+        // The producer rewrites part of the file in place, then republishes
+        let mut file = OpenOptions::new().write(true).open(&path).unwrap();
+        file.seek(SeekFrom::Start(8)).unwrap();
+        file.write_all(&f64_bytes(&[20.0, 30.0])).unwrap();
+        file.flush().unwrap();
+        pv.post()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_double_array("value")?, vec![1.0, 20.0, 30.0, 4.0]);
+
+        srv.stop()?;
+        drop(pv);
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[test]
+    fn test_mapped_region_after_header() -> Result<(), PvxsError> {
+        let name = "mapped:region";
+        let mut bytes = vec![0xffu8; 6];
+        for v in [100u16, 200, 300, 400, 500] {
+            bytes.extend_from_slice(&v.to_ne_bytes());
+        }
+        let path = temp_file("region.bin", &bytes);
+
+        let mut srv = Server::from_env()?;
+        let pv = srv.create_mapped_array_pv::<u16>(name, &path, 6, 3, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_native_array::<u16>("value")?, vec![100, 200, 300]);
+        assert_eq!(pv.fetch()?.get_field_native_array::<u16>("value")?, vec![100, 200, 300]);
+
+        srv.stop()?;
+        drop(pv);
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[test]
+    fn test_mapped_array_errors() -> Result<(), PvxsError> {
+        let path = temp_file("short.bin", &f64_bytes(&[1.0, 2.0]));
+        let mut srv = Server::from_env()?;
+        let meta = NTScalarMetadataBuilder::new;
+
+        // Too short, misaligned, missing and empty
+        assert!(srv.create_mapped_array_pv::<f64>("mapped:short", &path, 0, 3, meta()).is_err());
+        assert!(srv.create_mapped_array_pv::<f64>("mapped:misaligned", &path, 4, 1, meta()).is_err());
+        assert!(srv.create_mapped_array_pv::<f64>("mapped:missing", path.with_extension("missing"), 0, 0, meta()).is_err());
+        assert!(srv.create_mapped_array_pv::<f64>("mapped:empty", &path, 16, 0, meta()).is_err());
+
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+
+    #[cfg(unix)]
+    #[test]
+    fn test_post_refuses_truncated_file() -> Result<(), PvxsError> {
+        // Reading the region past the new end of file would raise SIGBUS,
+        // so post() checks the size first. Nothing here reads the mapping.
+        let path = temp_file("truncated.bin", &f64_bytes(&[1.0, 2.0, 3.0, 4.0]));
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_mapped_array_pv::<f64>("mapped:truncated", &path, 0, 0, NTScalarMetadataBuilder::new())?;
+        pv.post()?;
+
+        OpenOptions::new().write(true).open(&path).unwrap().set_len(8).unwrap();
+        let result = pv.post();
+        assert!(result.is_err());
+        assert!(result.unwrap_err().to_string().contains("truncated"));
+
+        drop(pv);
+        fs::remove_file(&path).ok();
+        Ok(())
+    }
+}
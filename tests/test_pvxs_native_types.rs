@@ -0,0 +1,89 @@
+mod test_pvxs_native_types {
+    use pvxs_sys::{Server, Context, NativeType, NTScalarMetadataBuilder, PvxsError};
+    use std::fmt::Debug;
+
+    const TIMEOUT: f64 = 5.0;
+
+    // Open a PV of T, PUT a second value and read both back at the same width
+    fn round_trip<T: NativeType + PartialEq + Debug>(name: &str, initial: T, written: T) -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let pv = srv.create_pv_native(name, initial, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+        assert_eq!(pv.fetch()?.get_field_native::<T>("value")?, initial);
+
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_native::<T>("value")?, initial);
+        ctx.put_native(name, written, TIMEOUT)?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_native::<T>("value")?, written);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    fn round_trip_array<T: NativeType + PartialEq + Debug>(name: &str, initial: &[T], written: &[T]) -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_native_array(name, initial, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_native_array::<T>("value")?, initial);
+        ctx.put_native_array(name, written, TIMEOUT)?;
+        assert_eq!(ctx.get(name, TIMEOUT)?.get_field_native_array::<T>("value")?, written);
+        pv.post_native_array(initial)?;
+        assert_eq!(pv.fetch()?.get_field_native_array::<T>("value")?, initial);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_native_scalars() -> Result<(), PvxsError> {
+        round_trip("native:int8", -5i8, i8::MIN)?;
+        round_trip("native:uint8", 200u8, u8::MAX)?;
+        round_trip("native:int16", -1234i16, i16::MAX)?;
+        round_trip("native:uint16", 4095u16, u16::MAX)?;
+        round_trip("native:uint32", 7u32, u32::MAX)?;
+        round_trip("native:float32", 1.5f32, -0.25f32)?;
+        round_trip("native:bool", false, true)?;
+        // Past 2^53, so these only survive without a detour through double
+        round_trip("native:int64", i64::MIN + 1, i64::MAX - 1)?;
+        round_trip("native:uint64", (1u64 << 60) + 1, u64::MAX)?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_native_arrays() -> Result<(), PvxsError> {
+        round_trip_array("native:int8:array", &[-1i8, 0, 1], &[i8::MIN, i8::MAX])?;
+        round_trip_array("native:uint8:array", &[0u8, 127, 255], &[1u8; 64])?;
+        round_trip_array("native:int16:array", &[-300i16, 300], &[i16::MIN, 0, i16::MAX])?;
+        round_trip_array("native:uint16:array", &[0u16, 2048, 4095], &[65535u16; 16])?;
+        round_trip_array("native:uint32:array", &[1u32, 2, 3], &[u32::MAX])?;
+        round_trip_array("native:int64:array", &[i64::MIN, i64::MAX], &[-1i64])?;
+        round_trip_array("native:uint64:array", &[u64::MAX, 0], &[1u64 << 63])?;
+        round_trip_array("native:float32:array", &[0.5f32, -2.0], &[1e-3f32, 1e3])?;
+        round_trip_array("native:bool:array", &[true, false, true], &[false])?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_native_generic_covers_existing_types() -> Result<(), PvxsError> {
+        round_trip("native:double", 2.5f64, -7.25f64)?;
+        round_trip("native:int32", 42i32, i32::MIN)?;
+        round_trip_array("native:double:array", &[1.0f64, 2.0], &[3.0f64])?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_native_post_converts_to_pv_type() -> Result<(), PvxsError> {
+        let name = "native:convert";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_native(name, 0u16, NTScalarMetadataBuilder::new())?;
+
+        pv.post_native(1000i32)?;
+        assert_eq!(pv.fetch()?.get_field_native::<u16>("value")?, 1000);
+        assert_eq!(pv.fetch()?.get_field_double("value")?, 1000.0);
+        assert!(pv.post_native_array::<u8>(&[]).is_err());
+        assert!(srv.create_pv_native_array::<u16>("native:empty", &[], NTScalarMetadataBuilder::new()).is_err());
+        Ok(())
+    }
+}
@@ -0,0 +1,116 @@
+#[cfg(feature = "async")]
+mod test_pvxs_operation_set {
+    use pvxs_sys::{Server, Context, OperationSet, NTScalarMetadataBuilder};
+    use std::time::{Duration, Instant};
+
+    #[test]
+    fn test_operation_set_wait_all() {
+        // Start several GET operations at once and wait for all of them
+        // with a single call.
+        let timeout = 5.0;
+        let mut srv = Server::from_env().expect("Failed to create server from env");
+        let names: Vec<String> = (0..5).map(|i| format!("opset:double:{}", i)).collect();
+        for (i, name) in names.iter().enumerate() {
+            srv.create_pv_double(name, i as f64, NTScalarMetadataBuilder::new())
+                .expect("Failed to create pv on server");
+        }
+        srv.start().expect("Failed to start server");
+
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        let mut set = OperationSet::new().expect("Failed to create operation set");
+        let mut ops = Vec::new();
+        for name in &names {
+            let op = ctx.start_get(name, timeout).expect("Failed to start get");
+            assert_eq!(set.add(&op).expect("Failed to add operation"), ops.len());
+            ops.push(op);
+        }
+        assert_eq!(set.len(), names.len());
+
+        let finished = set.wait_all(timeout).expect("wait_all failed");
+        assert_eq!(finished, (0..names.len()).collect::<Vec<_>>());
+
+        for (i, op) in ops.iter_mut().enumerate() {
+            assert!(op.is_done());
+            let value = op.result().expect("Operation failed");
+            assert!((value.get_field_double("value").unwrap() - i as f64).abs() < 1e-6);
+        }
+
+        srv.stop().expect("Failed to stop server");
+    }
+
+    #[test]
+    fn test_operation_set_wait_any_reports_each_once() {
+        // wait_any must hand out every completed index exactly once, and
+        // return an empty vector once nothing new can finish.
+        let timeout = 5.0;
+        let mut srv = Server::from_env().expect("Failed to create server from env");
+        srv.create_pv_double("opset:any:a", 1.0, NTScalarMetadataBuilder::new())
+            .expect("Failed to create pv on server");
+        srv.create_pv_double("opset:any:b", 2.0, NTScalarMetadataBuilder::new())
+            .expect("Failed to create pv on server");
+        srv.start().expect("Failed to start server");
+
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        let mut set = OperationSet::new().expect("Failed to create operation set");
+        let op_a = ctx.start_get("opset:any:a", timeout).expect("Failed to start get");
+        let op_b = ctx.start_put_double("opset:any:b", 4.0, timeout).expect("Failed to start put");
+        set.add(&op_a).unwrap();
+        set.add(&op_b).unwrap();
+
+        let mut seen = Vec::new();
+        while seen.len() < 2 {
+            let finished = set.wait_any(timeout).expect("wait_any failed");
+            assert!(!finished.is_empty(), "Timed out waiting for operations");
+            seen.extend(finished);
+        }
+        seen.sort();
+        assert_eq!(seen, vec![0, 1]);
+
+        // Nothing left to report, so it returns without waiting out the deadline
+        let start = Instant::now();
+        assert!(set.wait_any(5.0).expect("wait_any failed").is_empty());
+        assert!(start.elapsed() < Duration::from_secs(1));
+
+        srv.stop().expect("Failed to stop server");
+    }
+
+    #[test]
+    fn test_operation_set_timeout_on_missing_pv() {
+        // A PV nobody serves never completes before the set deadline.
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        let mut set = OperationSet::new().expect("Failed to create operation set");
+        let mut op = ctx.start_get("opset:does:not:exist", 10.0).expect("Failed to start get");
+        set.add(&op).unwrap();
+
+        let finished = set.wait_all(0.2).expect("wait_all failed");
+        assert!(finished.is_empty());
+        assert!(!op.is_done());
+        op.cancel();
+    }
+
+    #[test]
+    fn test_operation_timeout_bounds_the_operation() {
+        // The timeout given when starting an operation fails it once it
+        // passes, without anyone having to wait on it.
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        let mut set = OperationSet::new().expect("Failed to create operation set");
+        let mut op = ctx.start_get("opset:expires", 0.2).expect("Failed to start get");
+        set.add(&op).unwrap();
+
+        let start = Instant::now();
+        assert_eq!(set.wait_all(5.0).expect("wait_all failed"), vec![0]);
+        assert!(start.elapsed() < Duration::from_secs(2));
+        assert!(op.is_done());
+        let err = op.result().unwrap_err();
+        assert!(err.to_string().contains("Timeout"), "Unexpected error: {}", err);
+    }
+
+    #[test]
+    fn test_cancel_finishes_the_operation() {
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        let mut op = ctx.start_get("opset:cancelled", 10.0).expect("Failed to start get");
+        op.cancel();
+        assert!(op.is_done());
+        assert!(op.result().is_err());
+    }
+}
@@ -0,0 +1,133 @@
+mod test_pvxs_post_stager {
+    use pvxs_sys::{Server, Context, PostStager, NTScalarMetadataBuilder, PvxsError};
+    use std::sync::Arc;
+    use std::thread;
+    use std::time::{Duration, SystemTime, UNIX_EPOCH};
+
+    const TIMEOUT: f64 = 5.0;
+
+    #[test]
+    fn test_stager_validation() -> Result<(), PvxsError> {
+        assert!(PostStager::new(0.0).is_err());
+
+        let mut srv = Server::from_env()?;
+        let text = srv.create_pv_string("stager:validation:text", "x", NTScalarMetadataBuilder::new())?;
+        let level = srv.create_pv_int32("stager:validation:level", 0, NTScalarMetadataBuilder::new())?;
+
+        let mut stager = PostStager::new(0.05)?;
+        assert!(stager.add(&text).is_err());
+        let slot = stager.add(&level)?;
+        assert!(stager.stage_double(slot, 1.0).is_err());
+
+        stager.start()?;
+        assert!(stager.is_running());
+        assert!(stager.add(&level).is_err());
+        stager.stop()?;
+        assert!(!stager.is_running());
+        Ok(())
+    }
+
+    #[test]
+    fn test_stager_coalesces_producers() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let sum = srv.create_pv_double("stager:threads:sum", 0.0, NTScalarMetadataBuilder::new())?;
+        let count = srv.create_pv_int32("stager:threads:count", 0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        // A long interval, so everything staged lands in one flush
+        let mut stager = PostStager::new(0.5)?;
+        let sum_slot = stager.add(&sum)?;
+        let count_slot = stager.add(&count)?;
+        stager.start()?;
+
+        let stager = Arc::new(stager);
+        let producers: Vec<_> = (0..4)
+            .map(|t| {
+                let stager = Arc::clone(&stager);
+                thread::spawn(move || -> Result<(), PvxsError> {
+                    for i in 0..100 {
+                        stager.stage_double(sum_slot, (t * 100 + i) as f64)?;
+                        stager.stage_int32(count_slot, i)?;
+                    }
+                    Ok(())
+                })
+            })
+            .collect();
+        for producer in producers {
+            producer.join().unwrap()?;
+        }
+
+        let mut stager = Arc::try_unwrap(stager).ok().unwrap();
+        stager.stop()?;
+
+        let stats = stager.stats();
+        assert_eq!(stats.staged, 800);
+        assert_eq!(stats.posted + stats.coalesced, 800);
+        assert!(stats.posted >= 2);
+        assert!(stats.flushes >= 1);
+        assert!(stats.max_latency > 0.0);
+        assert!(stats.mean_latency <= stats.max_latency);
+
+        // The last value staged for count is 99 whichever thread staged it
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get("stager:threads:count", TIMEOUT)?.get_field_int32("value")?, 99);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_stager_posts_each_interval() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let pv = srv.create_pv_double("stager:interval", 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut stager = PostStager::new(0.02)?;
+        let slot = stager.add(&pv)?;
+        stager.start()?;
+
+        for i in 1..=3 {
+            stager.stage_double(slot, i as f64)?;
+            thread::sleep(Duration::from_millis(100));
+            assert_eq!(pv.fetch()?.get_field_double("value")?, i as f64);
+        }
+        let stats = stager.stats();
+        assert_eq!(stats.posted, 3);
+        assert_eq!(stats.flushes, 3);
+        assert_eq!(stats.coalesced, 0);
+
+        stager.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_stager_stamps_staging_time() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let pv = srv.create_pv_double("stager:stamp", 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        // The flush comes about 400ms after the value is staged
+        let mut stager = PostStager::new(0.5)?;
+        let slot = stager.add(&pv)?;
+        stager.start()?;
+        thread::sleep(Duration::from_millis(100));
+
+        let before = SystemTime::now().duration_since(UNIX_EPOCH).unwrap();
+        stager.stage_double(slot, 1.0)?;
+        let after = SystemTime::now().duration_since(UNIX_EPOCH).unwrap();
+        thread::sleep(Duration::from_millis(700));
+
+        let value = pv.fetch()?;
+        assert_eq!(value.get_field_double("value")?, 1.0);
+        let stamp = Duration::new(
+            value.get_field_native::<i64>("timeStamp.secondsPastEpoch")? as u64,
+            value.get_field_int32("timeStamp.nanoseconds")? as u32,
+        );
+        assert!(stamp >= before && stamp <= after, "Posted with {:?}, staged between {:?} and {:?}", stamp, before, after);
+
+        stager.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,89 @@
+mod test_pvxs_priority {
+    use pvxs_sys::{Server, Context, AdmissionConfig, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    #[test]
+    fn test_priority_range() {
+        let mut ctx = Context::from_env().expect("Failed to create client context from env");
+        assert_eq!(ctx.priority(), Context::PRIORITY_DEFAULT);
+
+        ctx.set_priority(Context::PRIORITY_MAX).expect("Failed to set priority");
+        assert_eq!(ctx.priority(), Context::PRIORITY_MAX);
+
+        assert!(ctx.set_priority(-1).is_err());
+        assert!(ctx.set_priority(100).is_err());
+        assert_eq!(ctx.priority(), Context::PRIORITY_MAX);
+    }
+
+    #[test]
+    fn test_operations_at_different_priorities() -> Result<(), PvxsError> {
+        // The same PV accessed at two priorities goes over two channels,
+        // both of which must see the same value.
+        let timeout = 5.0;
+        let name = "priority:double";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double(name, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        ctx.enable_admission_control(AdmissionConfig::new().max_in_flight(4))?;
+
+        ctx.set_priority(Context::PRIORITY_MAX)?;
+        ctx.put_double(name, 7.25, timeout)?;
+
+        ctx.set_priority(Context::PRIORITY_DEFAULT)?;
+        let value = ctx.get(name, timeout)?;
+        assert!((value.get_field_double("value")? - 7.25).abs() < 1e-6);
+
+        // Monitors take their priority from the builder
+        let mut monitor = ctx.monitor_builder(name)?
+            .priority(Context::PRIORITY_MAX)
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+        assert!(monitor.is_connected());
+        monitor.stop()?;
+
+        assert_eq!(ctx.admission_stats().admitted, 2);
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[cfg(feature = "async")]
+    #[test]
+    fn test_queued_operations_dispatch_by_priority() -> Result<(), PvxsError> {
+        // With the only slot held, a low priority put is queued before a
+        // high priority one. Once the slot frees up the high priority put
+        // runs first, so the low priority value is the one left behind.
+        let timeout = 5.0;
+        let name = "priority:order";
+        let mut srv = Server::create_isolated()?;
+        srv.create_pv_double(name, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = srv.client_context()?;
+        ctx.enable_admission_control(AdmissionConfig::new().max_in_flight(1))?;
+
+        let mut blocker = ctx.start_get("priority:order:missing", 10.0)?;
+        ctx.set_priority(Context::PRIORITY_DEFAULT)?;
+        let mut low = ctx.start_put_double(name, 1.0, timeout)?;
+        ctx.set_priority(Context::PRIORITY_MAX)?;
+        let mut high = ctx.start_put_double(name, 2.0, timeout)?;
+        assert_eq!(ctx.admission_stats().queued, 2);
+
+        blocker.cancel();
+        assert!(high.wait(timeout)?);
+        high.result()?;
+        assert!(low.wait(timeout)?);
+        low.result()?;
+
+        ctx.set_priority(Context::PRIORITY_DEFAULT)?;
+        let value = ctx.get(name, timeout)?;
+        assert!((value.get_field_double("value")? - 1.0).abs() < 1e-6);
+        assert_eq!(ctx.admission_stats().waited, 2);
+
+        srv.stop()?;
+        Ok(())
+    }
+}
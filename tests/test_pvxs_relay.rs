@@ -0,0 +1,150 @@
+mod test_pvxs_relay {
+    use pvxs_sys::{Server, Context, SharedPV, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn settle() {
+        thread::sleep(Duration::from_millis(500));
+    }
+
+    #[test]
+    fn test_relay_validation() -> Result<(), PvxsError> {
+        let mut ctx = Context::from_env()?;
+        let closed = SharedPV::create_mailbox()?;
+        let mut relay = ctx.relay("relay:validation:src", &closed)?;
+
+        assert!(relay.decimate(0).is_err());
+        assert!(relay.clamp(2.0, 1.0).is_err());
+        assert!(relay.remap("", "value").is_err());
+
+        // The target was never opened
+        assert!(relay.start().is_err());
+        assert!(!relay.is_running());
+        Ok(())
+    }
+
+    #[test]
+    fn test_relay_scales_and_clamps() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let mut src = srv.create_pv_double("relay:scale:src", 1.0, NTScalarMetadataBuilder::new())?;
+        let dst = srv.create_pv_double("relay:scale:dst", 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut relay = ctx.relay("relay:scale:src", &dst)?;
+        relay.scale(10.0, 1.0)?.clamp(0.0, 50.0)?;
+        relay.start()?;
+        settle();
+
+        // Initial value arrives on subscription
+        assert_eq!(dst.fetch()?.get_field_double("value")?, 11.0);
+
+        src.post_double(2.0)?;
+        settle();
+        assert_eq!(dst.fetch()?.get_field_double("value")?, 21.0);
+
+        src.post_double(100.0)?;
+        settle();
+        assert_eq!(dst.fetch()?.get_field_double("value")?, 50.0);
+
+        // Transforms are fixed while running
+        assert!(relay.scale(2.0, 0.0).is_err());
+
+        // Clients of the target see the relayed value
+        let value = ctx.get("relay:scale:dst", 5.0)?;
+        assert_eq!(value.get_field_double("value")?, 50.0);
+
+        let stats = relay.stats();
+        assert_eq!(stats.forwarded, 3);
+        assert_eq!(stats.failed, 0);
+
+        relay.stop()?;
+        assert!(!relay.is_running());
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_relay_decimates() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        let mut src = srv.create_pv_double("relay:decimate:src", 0.0, NTScalarMetadataBuilder::new())?;
+        let dst = srv.create_pv_double("relay:decimate:dst", -1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut relay = ctx.relay("relay:decimate:src", &dst)?;
+        relay.decimate(3)?;
+        relay.start()?;
+        settle();
+
+        // Spaced out so that pvxs doesn't squash updates in the subscription queue
+        for i in 1..=5 {
+            src.post_double(i as f64)?;
+            thread::sleep(Duration::from_millis(50));
+        }
+        settle();
+
+        // Updates 0 and 3 pass, 1, 2, 4 and 5 are dropped
+        let stats = relay.stats();
+        assert_eq!(stats.forwarded, 2);
+        assert_eq!(stats.decimated, 4);
+        assert_eq!(dst.fetch()?.get_field_double("value")?, 3.0);
+
+        relay.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_relay_remaps_and_converts() -> Result<(), PvxsError> {
+        // The upstream display high limit becomes the value of an int32 PV
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double("relay:remap:src", 1.0, NTScalarMetadataBuilder::new()
+            .display(pvxs_sys::DisplayMetadata {
+                limit_low: 0,
+                limit_high: 42,
+                description: String::new(),
+                units: String::new(),
+                precision: 0,
+            }))?;
+        let dst = srv.create_pv_int32("relay:remap:dst", 0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut relay = ctx.relay("relay:remap:src", &dst)?;
+        relay.remap("display.limitHigh", "value")?;
+        relay.start()?;
+        settle();
+
+        assert_eq!(dst.fetch()?.get_field_int32("value")?, 42);
+
+        relay.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_relay_marks_upstream_disconnect() -> Result<(), PvxsError> {
+        let mut upstream = Server::from_env()?;
+        upstream.create_pv_double("relay:disconnect:src", 5.0, NTScalarMetadataBuilder::new())?;
+        upstream.start()?;
+
+        let mut local = Server::from_env()?;
+        let dst = local.create_pv_double("relay:disconnect:dst", 0.0, NTScalarMetadataBuilder::new())?;
+
+        let mut ctx = Context::from_env()?;
+        let mut relay = ctx.relay("relay:disconnect:src", &dst)?;
+        relay.start()?;
+        settle();
+        assert_eq!(dst.fetch()?.get_field_int32("alarm.severity")?, 0);
+
+        upstream.stop()?;
+        thread::sleep(Duration::from_millis(1500));
+        let value = dst.fetch()?;
+        assert_eq!(value.get_field_int32("alarm.severity")?, 3);
+        assert_eq!(value.get_field_double("value")?, 5.0);
+
+        relay.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,99 @@
+mod test_pvxs_server_deadband {
+    use pvxs_sys::{Server, Context, Monitor, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn drain(monitor: &mut Monitor) -> Result<Vec<f64>, PvxsError> {
+        let mut values = Vec::new();
+        while let Ok(Some(value)) = monitor.pop() {
+            values.push(value.get_field_double("value")?);
+        }
+        Ok(values)
+    }
+
+    fn post_all(pv: &mut pvxs_sys::SharedPV, values: &[f64]) -> Result<(), PvxsError> {
+        for value in values {
+            pv.post_double(*value)?;
+            thread::sleep(Duration::from_millis(20));
+        }
+        thread::sleep(Duration::from_millis(500));
+        Ok(())
+    }
+
+    #[test]
+    fn test_absolute_deadband_per_subscriber() -> Result<(), PvxsError> {
+        let name = "server:deadband:abs";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 10.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut fine = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_deadband(0.05)
+            .exec()?;
+        let mut coarse = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_deadband(1.0)
+            .exec()?;
+        fine.start()?;
+        coarse.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        // Drift of 0.3 per step crosses the coarse band every fourth post
+        post_all(&mut pv, &[10.3, 10.6, 10.9, 11.2, 11.5, 11.8, 12.1])?;
+
+        assert_eq!(drain(&mut fine)?.len(), 8);
+        assert_eq!(drain(&mut coarse)?, vec![10.0, 11.2]);
+
+        fine.stop()?;
+        coarse.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_relative_deadband() -> Result<(), PvxsError> {
+        let name = "server:deadband:rel";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 100.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_deadband_percent(5.0)
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        // 5% of 100 is 5, then 5% of 106 is 5.3
+        post_all(&mut pv, &[102.0, 104.0, 106.0, 110.0, 111.5])?;
+        assert_eq!(drain(&mut monitor)?, vec![100.0, 106.0, 111.5]);
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_negative_deadband_is_refused() -> Result<(), PvxsError> {
+        let name = "server:deadband:invalid";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_deadband(-1.0)
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+        assert!(!matches!(monitor.pop(), Ok(Some(_))));
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,99 @@
+mod test_pvxs_server_decimation {
+    use pvxs_sys::{Server, Context, Monitor, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn drain(monitor: &mut Monitor) -> Result<Vec<f64>, PvxsError> {
+        let mut values = Vec::new();
+        while let Ok(Some(value)) = monitor.pop() {
+            values.push(value.get_field_double("value")?);
+        }
+        Ok(values)
+    }
+
+    #[test]
+    fn test_decimation_per_subscriber() -> Result<(), PvxsError> {
+        let name = "server:dec:counted";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut full = ctx.monitor_builder(name)?.connect_exception(false).exec()?;
+        let mut decimated = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_decimation(5)
+            .exec()?;
+        full.start()?;
+        decimated.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        for i in 1..=20 {
+            pv.post_double(i as f64)?;
+            thread::sleep(Duration::from_millis(20));
+        }
+        thread::sleep(Duration::from_millis(500));
+
+        // The plain subscriber sees every post, the other one post out of five
+        // and then the folded tail once the posts stop
+        assert_eq!(drain(&mut full)?.len(), 21);
+        assert_eq!(drain(&mut decimated)?, vec![0.0, 1.0, 6.0, 11.0, 16.0, 20.0]);
+
+        full.stop()?;
+        decimated.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_min_interval_delivers_last_value() -> Result<(), PvxsError> {
+        let name = "server:dec:interval";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_min_interval(Duration::from_millis(300))
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        // A burst shorter than the interval
+        for i in 1..=20 {
+            pv.post_double(i as f64)?;
+            thread::sleep(Duration::from_millis(5));
+        }
+        thread::sleep(Duration::from_millis(800));
+
+        let values = drain(&mut monitor)?;
+        assert!(values.len() <= 4, "Expected the burst to be folded, got {:?}", values);
+        assert_eq!(values.last(), Some(&20.0));
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_invalid_rate_option_is_refused() -> Result<(), PvxsError> {
+        let name = "server:dec:invalid";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .record("dec", "0")
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+        assert!(!matches!(monitor.pop(), Ok(Some(_))));
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
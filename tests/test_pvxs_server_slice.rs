@@ -0,0 +1,106 @@
+mod test_pvxs_server_slice {
+    use pvxs_sys::{Server, Context, Monitor, NTScalarMetadataBuilder, PvxsError};
+    use std::thread;
+    use std::time::Duration;
+
+    fn drain(monitor: &mut Monitor) -> Result<Vec<Vec<f64>>, PvxsError> {
+        let mut values = Vec::new();
+        while let Ok(Some(value)) = monitor.pop() {
+            values.push(value.get_field_double_array("value")?);
+        }
+        Ok(values)
+    }
+
+    fn waveform(len: usize, offset: f64) -> Vec<f64> {
+        (0..len).map(|i| i as f64 + offset).collect()
+    }
+
+    #[test]
+    fn test_slices_per_subscriber() -> Result<(), PvxsError> {
+        let name = "server:slice:waveform";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double_array(name, waveform(1000, 0.0), NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut full = ctx.monitor_builder(name)?.connect_exception(false).exec()?;
+        let mut window = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_slice(10, 5, 1)
+            .exec()?;
+        let mut strided = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_slice(990, 100, 4)
+            .exec()?;
+        full.start()?;
+        window.start()?;
+        strided.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        pv.post_double_array(&waveform(1000, 0.5))?;
+        thread::sleep(Duration::from_millis(500));
+
+        let full = drain(&mut full)?;
+        assert_eq!(full.len(), 2);
+        assert_eq!(full[1].len(), 1000);
+
+        assert_eq!(drain(&mut window)?, vec![
+            vec![10.0, 11.0, 12.0, 13.0, 14.0],
+            vec![10.5, 11.5, 12.5, 13.5, 14.5],
+        ]);
+        // Cut short at the end of the array
+        assert_eq!(drain(&mut strided)?, vec![
+            vec![990.0, 994.0, 998.0],
+            vec![990.5, 994.5, 998.5],
+        ]);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_slice_past_end_is_empty() -> Result<(), PvxsError> {
+        let name = "server:slice:past_end";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double_array(name, waveform(10, 0.0), NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?
+            .connect_exception(false)
+            .server_slice(20, 5, 1)
+            .exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+        assert_eq!(drain(&mut monitor)?, vec![Vec::<f64>::new()]);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_invalid_slices_are_refused() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double_array("server:slice:array", waveform(10, 0.0), NTScalarMetadataBuilder::new())?;
+        srv.create_pv_double("server:slice:scalar", 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut zero_stride = ctx.monitor_builder("server:slice:array")?
+            .connect_exception(false)
+            .server_slice(0, 5, 0)
+            .exec()?;
+        let mut scalar = ctx.monitor_builder("server:slice:scalar")?
+            .connect_exception(false)
+            .server_slice(0, 1, 1)
+            .exec()?;
+        zero_stride.start()?;
+        scalar.start()?;
+        thread::sleep(Duration::from_millis(500));
+        assert!(!matches!(zero_stride.pop(), Ok(Some(_))));
+        assert!(!matches!(scalar.pop(), Ok(Some(_))));
+
+        srv.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,67 @@
+mod test_pvxs_shared_context {
+    use pvxs_sys::{Server, Context, NTScalarMetadataBuilder, PvxsError};
+    use serial_test::serial;
+
+    #[test]
+    #[serial]
+    fn test_shared_context_is_reference_counted() -> Result<(), PvxsError> {
+        assert_eq!(Context::shared_handle_count(), 0);
+
+        let a = Context::shared()?;
+        let b = Context::shared()?;
+        assert!(a.is_shared());
+        assert!(b.is_shared());
+        assert_eq!(Context::shared_handle_count(), 2);
+
+        // A private context does not count
+        let private = Context::from_env()?;
+        assert!(!private.is_shared());
+        assert_eq!(Context::shared_handle_count(), 2);
+
+        drop(a);
+        assert_eq!(Context::shared_handle_count(), 1);
+        drop(b);
+        assert_eq!(Context::shared_handle_count(), 0);
+
+        // Re-created lazily after the last handle went away
+        let c = Context::shared()?;
+        assert_eq!(Context::shared_handle_count(), 1);
+        drop(c);
+        Ok(())
+    }
+
+    #[test]
+    #[serial]
+    fn test_shared_context_opt_out() -> Result<(), PvxsError> {
+        Context::set_sharing_enabled(false);
+        let ctx = Context::shared();
+        Context::set_sharing_enabled(true);
+
+        let ctx = ctx?;
+        assert!(!ctx.is_shared());
+        assert_eq!(Context::shared_handle_count(), 0);
+        Ok(())
+    }
+
+    #[test]
+    #[serial]
+    fn test_shared_handles_keep_separate_settings() -> Result<(), PvxsError> {
+        let timeout = 5.0;
+        let name = "shared:context:double";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double(name, 4.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        let mut control = Context::shared()?;
+        let mut bulk = Context::shared()?;
+        control.set_priority(Context::PRIORITY_MAX)?;
+        assert_eq!(bulk.priority(), Context::PRIORITY_DEFAULT);
+
+        control.put_double(name, 8.0, timeout)?;
+        let value = bulk.get(name, timeout)?;
+        assert!((value.get_field_double("value")? - 8.0).abs() < 1e-6);
+
+        srv.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,99 @@
+mod test_pvxs_slow_consumer {
+    use pvxs_sys::{Server, Context, SendLimits, NTScalarMetadataBuilder, PvxsError};
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::thread;
+    use std::time::Duration;
+
+    static ALERTS: AtomicUsize = AtomicUsize::new(0);
+
+    extern "C" fn count_alert() {
+        ALERTS.fetch_add(1, Ordering::SeqCst);
+    }
+
+    #[test]
+    fn test_send_limits_validation() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        assert!(srv.enable_send_limits(SendLimits::new()).is_err());
+        assert!(srv.enable_send_limits(SendLimits::new()
+            .max_queued_per_client(10)
+            .alert_threshold(20)).is_err());
+        srv.enable_send_limits(SendLimits::new().max_queued_per_client(10))?;
+
+        // Nobody subscribed yet
+        assert!(srv.client_send_stats().is_empty());
+        assert_eq!(srv.send_alert_count(), 0);
+        Ok(())
+    }
+
+    #[test]
+    fn test_subscriptions_accounted_per_client() -> Result<(), PvxsError> {
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double("slow:consumer:a", 1.0, NTScalarMetadataBuilder::new())?;
+        srv.create_pv_double("slow:consumer:b", 2.0, NTScalarMetadataBuilder::new())?;
+        srv.enable_send_limits(SendLimits::new().max_queued_per_client(100))?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut a = ctx.monitor_builder("slow:consumer:a")?.exec()?;
+        let mut b = ctx.monitor_builder("slow:consumer:b")?.exec()?;
+        a.start()?;
+        b.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        // Both subscriptions come from the same client
+        let clients = srv.client_send_stats();
+        assert_eq!(clients.len(), 1);
+        assert_eq!(clients[0].subscriptions, 2);
+        assert!(!clients[0].slow);
+
+        a.stop()?;
+        b.stop()?;
+        thread::sleep(Duration::from_millis(500));
+        assert!(srv.client_send_stats().is_empty());
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_backed_up_client_is_reported_and_gets_latest_value() -> Result<(), PvxsError> {
+        // An alert threshold of one update reports the client as soon as
+        // anything is queued for it; a burst of posts must still end with
+        // the subscriber seeing the last value.
+        let name = "slow:consumer:burst";
+        let mut srv = Server::from_env()?;
+        let mut pv = srv.create_pv_double(name, 0.0, NTScalarMetadataBuilder::new())?;
+        srv.enable_send_limits(SendLimits::new()
+            .max_queued_per_client(2)
+            .alert_threshold(1)
+            .on_alert(count_alert))?;
+        srv.start()?;
+
+        let mut ctx = Context::from_env()?;
+        let mut monitor = ctx.monitor_builder(name)?.exec()?;
+        monitor.start()?;
+        thread::sleep(Duration::from_millis(500));
+
+        for i in 1..=500 {
+            pv.post_double(i as f64)?;
+        }
+        thread::sleep(Duration::from_millis(1000));
+
+        assert!(srv.send_alert_count() >= 1);
+        assert_eq!(ALERTS.load(Ordering::SeqCst) as u64, srv.send_alert_count());
+
+        let mut last = None;
+        while let Ok(Some(value)) = monitor.pop() {
+            last = Some(value.get_field_double("value")?);
+        }
+        assert_eq!(last, Some(500.0));
+
+        let clients = srv.client_send_stats();
+        assert_eq!(clients.len(), 1);
+        assert!(clients[0].max_queued <= 3, "Queue should stay near the limit, got {}", clients[0].max_queued);
+
+        monitor.stop()?;
+        srv.stop()?;
+        Ok(())
+    }
+}
@@ -0,0 +1,76 @@
+mod test_pvxs_tracer {
+    use pvxs_sys::{Server, Context, Tracer, NTScalarMetadataBuilder, PvxsError};
+    use serial_test::serial;
+    use std::thread;
+    use std::time::Duration;
+
+    #[test]
+    #[serial]
+    fn test_tracer_validation() -> Result<(), PvxsError> {
+        assert!(Tracer::enable(0).is_err());
+        assert!(!Tracer::is_enabled());
+
+        Tracer::enable(16)?;
+        assert!(Tracer::is_enabled());
+        Tracer::disable();
+        assert!(!Tracer::is_enabled());
+        Ok(())
+    }
+
+    #[test]
+    #[serial]
+    fn test_trace_records_client_and_server_activity() -> Result<(), PvxsError> {
+        let timeout = 5.0;
+        let name = "tracer:double";
+        let mut srv = Server::from_env()?;
+        srv.create_pv_double(name, 1.0, NTScalarMetadataBuilder::new())?;
+        srv.start()?;
+
+        Tracer::enable(Tracer::DEFAULT_EVENTS_PER_THREAD)?;
+        let mut ctx = Context::from_env()?;
+        {
+            let _span = Tracer::span("batch");
+            ctx.put_double(name, 2.0, timeout)?;
+            ctx.get(name, timeout)?;
+        }
+        Tracer::instant("done");
+        // Let the server thread finish its side of the PUT
+        thread::sleep(Duration::from_millis(200));
+        Tracer::disable();
+
+        let json = Tracer::to_json();
+        assert!(json.starts_with("{\"traceEvents\":["));
+        assert!(json.contains("\"name\":\"get\""));
+        assert!(json.contains("\"name\":\"put\""));
+        assert!(json.contains("\"name\":\"onPut\""));
+        assert!(json.contains("\"name\":\"batch\""));
+        assert!(json.contains("\"name\":\"done\""));
+        assert!(json.contains(&format!("\"pv\":\"{}\"", name)));
+        assert_eq!(Tracer::dropped_events(), 0);
+
+        // Disabled: nothing more is recorded, the recording is kept
+        ctx.get(name, timeout)?;
+        assert_eq!(Tracer::to_json(), json);
+
+        Tracer::clear();
+        assert!(!Tracer::to_json().contains("\"name\":\"get\""));
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    #[serial]
+    fn test_full_buffer_drops_events() -> Result<(), PvxsError> {
+        Tracer::enable(4)?;
+        for _ in 0..10 {
+            Tracer::instant("tick");
+        }
+        Tracer::disable();
+
+        assert_eq!(Tracer::dropped_events(), 6);
+        assert!(Tracer::to_json().contains("\"dropped\":6"));
+        Tracer::clear();
+        Ok(())
+    }
+}
@@ -0,0 +1,115 @@
+mod test_pvxs_warm_start {
+    use pvxs_sys::{Server, Context, DisplayMetadata, NTEnumMetadataBuilder, NTScalarMetadataBuilder, PvxsError};
+    use std::fs;
+    use std::path::PathBuf;
+
+    const TIMEOUT: f64 = 5.0;
+
+    extern "C" fn constant() -> f64 {
+        1.0
+    }
+
+    fn temp_path(name: &str) -> PathBuf {
+        std::env::temp_dir().join(format!("pvxs_sys_{}_{}", std::process::id(), name))
+    }
+
+    #[test]
+    fn test_warm_start_round_trip() -> Result<(), PvxsError> {
+        let path = temp_path("warm_start.snap");
+        {
+            let mut srv = Server::create_isolated()?;
+            let mut speed = srv.create_pv_double("warm:speed", 0.0, NTScalarMetadataBuilder::new()
+                .display(DisplayMetadata {
+                    limit_low: 0,
+                    limit_high: 100,
+                    description: "Conveyor speed".to_string(),
+                    units: "m/s".to_string(),
+                    precision: 2,
+                }))?;
+            let mut table = srv.create_pv_int32_array("warm:table", vec![0], NTScalarMetadataBuilder::new())?;
+            let mut label = srv.create_pv_string("warm:label", "", NTScalarMetadataBuilder::new())?;
+            let mut mode = srv.create_pv_enum("warm:mode", vec!["Off", "Slow", "Fast"], 0, NTEnumMetadataBuilder::new())?;
+            // Not saved: its value is computed, not stored
+            let _computed = srv.create_pv_computed_double("warm:computed", constant, 0.0, NTScalarMetadataBuilder::new())?;
+
+            speed.post_double(2.5)?;
+            table.post_int32_array(&[4, 5, 6])?;
+            label.post_string("line 3")?;
+            mode.post_enum(2)?;
+            assert_eq!(srv.save_snapshot(&path)?, 4);
+        }
+
+        let mut srv = Server::from_env()?;
+        let mut pvs = srv.warm_start(&path)?;
+        srv.start()?;
+        assert_eq!(pvs.len(), 4);
+
+        let speed = pvs["warm:speed"].fetch()?;
+        assert_eq!(speed.get_field_double("value")?, 2.5);
+        assert_eq!(speed.get_field_string("display.units")?, "m/s");
+        assert_eq!(speed.get_field_string("display.description")?, "Conveyor speed");
+        assert_eq!(pvs["warm:table"].fetch()?.get_field_int32_array("value")?, vec![4, 5, 6]);
+        assert_eq!(pvs["warm:mode"].fetch()?.get_field_enum("value.index")?, 2);
+
+        // Served as mailbox PVs, and the handles post to what clients see
+        let mut ctx = Context::from_env()?;
+        assert_eq!(ctx.get("warm:label", TIMEOUT)?.get_field_string("value")?, "line 3");
+        ctx.put_double("warm:speed", 3.0, TIMEOUT)?;
+        assert_eq!(pvs["warm:speed"].fetch()?.get_field_double("value")?, 3.0);
+        pvs.get_mut("warm:label").unwrap().post_string("line 4")?;
+        assert_eq!(ctx.get("warm:label", TIMEOUT)?.get_field_string("value")?, "line 4");
+
+        // Enum PVs keep refusing indices outside their choices
+        let refused = ctx.put_enum("warm:mode", 3, TIMEOUT);
+        assert!(refused.unwrap_err().to_string().contains("out of range"));
+        assert!(ctx.put_enum("warm:mode", -1, TIMEOUT).is_err());
+        ctx.put_enum("warm:mode", 1, TIMEOUT)?;
+        assert_eq!(pvs["warm:mode"].fetch()?.get_field_enum("value.index")?, 1);
+
+        srv.stop()?;
+        Ok(())
+    }
+
+    #[test]
+    fn test_warm_start_all_or_nothing() -> Result<(), PvxsError> {
+        let path = temp_path("warm_start_conflict.snap");
+        {
+            let mut srv = Server::create_isolated()?;
+            srv.create_pv_double("warm:a", 1.0, NTScalarMetadataBuilder::new())?;
+            srv.create_pv_double("warm:b", 2.0, NTScalarMetadataBuilder::new())?;
+            assert_eq!(srv.save_snapshot(&path)?, 2);
+        }
+
+        let mut srv = Server::create_isolated()?;
+        let _taken = srv.create_pv_double("warm:b", 0.0, NTScalarMetadataBuilder::new())?;
+        assert!(srv.warm_start(&path).is_err());
+        // warm:a was not added either, so a later attempt can succeed
+        srv.remove_pv("warm:b")?;
+        assert_eq!(srv.warm_start(&path)?.len(), 2);
+        Ok(())
+    }
+
+    #[test]
+    fn test_warm_start_rejects_corrupt_files() -> Result<(), PvxsError> {
+        let path = temp_path("warm_start_corrupt.snap");
+        {
+            let mut srv = Server::create_isolated()?;
+            srv.create_pv_double("warm:corrupt", 1.0, NTScalarMetadataBuilder::new())?;
+            srv.save_snapshot(&path)?;
+        }
+        let bytes = fs::read(&path).unwrap();
+
+        let mut truncated = bytes.clone();
+        truncated.truncate(bytes.len() - 1);
+        fs::write(&path, &truncated).unwrap();
+        assert!(Server::create_isolated()?.warm_start(&path).is_err());
+
+        let mut flipped = bytes.clone();
+        *flipped.last_mut().unwrap() ^= 0xff;
+        fs::write(&path, &flipped).unwrap();
+        assert!(Server::create_isolated()?.warm_start(&path).is_err());
+
+        assert!(Server::create_isolated()?.warm_start(temp_path("warm_start_missing.snap")).is_err());
+        Ok(())
+    }
+}